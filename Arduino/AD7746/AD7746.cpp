@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2012-04-01 - initial release
+//     2026-10-19 - added RDY-gated streaming with VT interleave and timestamped sample buffer
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -39,6 +40,13 @@ THE SOFTWARE.
  */
 AD7746::AD7746() {
     devAddr = AD7746_DEFAULT_ADDRESS;
+    capOffset = 0;
+    vtEnabled = false;
+    lastVT = 0;
+    vtPending = false;
+    sampleHead = 0;
+    sampleCount = 0;
+    droppedSamples = 0;
 }
 
 /** Specific address constructor.
@@ -48,6 +56,13 @@ AD7746::AD7746() {
  */
 AD7746::AD7746(uint8_t address) {
     devAddr = address;
+    capOffset = 0;
+    vtEnabled = false;
+    lastVT = 0;
+    vtPending = false;
+    sampleHead = 0;
+    sampleCount = 0;
+    droppedSamples = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -136,3 +151,120 @@ void AD7746::writeCapDacBRegister(uint8_t data) {
 void AD7746::write_register(uint8_t addr,uint8_t data) {
     I2Cdev::writeByte(devAddr, addr, data);
 }
+
+/** Set both CAPDAC registers in one burst and cache their offset.
+ * A DAC code of 0 disables that DAC. The offset they add on CIN+ (A) and
+ * CIN- (B) is computed once here, so streamed samples only need one addition
+ * to report the real input capacitance.
+ * @param dacA CAPDAC A code (0-127)
+ * @param dacB CAPDAC B code (0-127)
+ */
+void AD7746::setCapDac(uint8_t dacA, uint8_t dacB) {
+    dacA &= 0x7F;
+    dacB &= 0x7F;
+    buffer[0] = dacA ? (AD7746_DACAEN | dacA) : 0;
+    buffer[1] = dacB ? (AD7746_DACBEN | dacB) : 0;
+    I2Cdev::writeBytes(devAddr, AD7746_RA_CAP_DAC_A, 2, buffer);
+    capOffset = ((int32_t)dacA - (int32_t)dacB) * AD7746_DAC_STEP_AF;
+}
+
+/** Start continuous conversion for streaming.
+ * Capacitive channel setup (CAP_SETUP, EXC_SETUP, CAPDAC via setCapDac())
+ * should already be written. With temperature set, the VT channel is enabled
+ * on the internal temperature sensor and the part alternates conversions
+ * between the two channels; otherwise VT is left as configured and ignored.
+ * @param filters AD7746_VTF_* | AD7746_CAPF_* conversion time selection
+ * @param temperature Interleave internal temperature conversions
+ * @see pollStream()
+ */
+void AD7746::startStreaming(uint8_t filters, bool temperature) {
+    vtEnabled = temperature;
+    if (temperature) writeVtSetupRegister(AD7746_VTEN | AD7746_VTMD_INT_TEMP);
+    vtPending = false;
+    sampleHead = 0;
+    sampleCount = 0;
+    droppedSamples = 0;
+    writeConfigurationRegister((filters & 0xF8) | AD7746_MD_CONTINUOUS_CONVERSION);
+}
+
+/** Put the converter back in idle mode. */
+void AD7746::stopStreaming() {
+    writeConfigurationRegister(AD7746_MD_IDLE);
+}
+
+/** Check for finished conversions and buffer them.
+ * Reads STATUS and the data registers in a single burst (4 bytes, or 7 when
+ * the VT channel is interleaved). Only channels whose active-low RDY flag is
+ * clear are taken, so a result is never delivered twice; reading the data
+ * registers clears the flags again. Call this at least as often as the
+ * conversion rate, e.g. from loop() or on the RDY pin falling edge.
+ * @return AD7746_SAMPLE_CAP and/or AD7746_SAMPLE_VT for each new result, 0 if none
+ * @see readSample()
+ */
+uint8_t AD7746::pollStream() {
+    uint8_t length = vtEnabled ? 7 : 4;
+    if (I2Cdev::readBytes(devAddr, AD7746_RA_STATUS, length, buffer) != length) return 0;
+    uint8_t fresh = ~buffer[0] & (vtEnabled ? AD7746_SAMPLE_CAP | AD7746_SAMPLE_VT : AD7746_SAMPLE_CAP);
+    if (!fresh) return 0;
+
+    if (fresh & AD7746_SAMPLE_VT) {
+        lastVT = ((uint32_t)buffer[4] << 16) | ((uint32_t)buffer[5] << 8) | buffer[6];
+        vtPending = true;
+        if (!(fresh & AD7746_SAMPLE_CAP)) return fresh; // stored with the next capacitance
+    }
+
+    if (sampleCount == AD7746_STREAM_BUFFER_SIZE) {
+        // drop the oldest so the buffer always holds the newest data
+        sampleHead = (sampleHead + 1) % AD7746_STREAM_BUFFER_SIZE;
+        sampleCount--;
+        droppedSamples++;
+    }
+    AD7746Sample *sample = &samples[(sampleHead + sampleCount) % AD7746_STREAM_BUFFER_SIZE];
+    sampleCount++;
+
+    // 0x800000 is zero scale and +/-0x800000 spans +/-4.096pF, which makes
+    // one LSB exactly 125/256 aF
+    int32_t code = (((int32_t)buffer[1] << 16) | ((int32_t)buffer[2] << 8) | buffer[3]) - 0x800000L;
+    sample->timestamp = micros();
+    sample->capacitance = ((code * 125) >> 8) + capOffset;
+    sample->vt = lastVT;
+    sample->channels = AD7746_SAMPLE_CAP | (vtPending ? AD7746_SAMPLE_VT : 0);
+    vtPending = false;
+    return fresh;
+}
+
+/** Get number of buffered samples waiting to be read.
+ * @return Samples available from readSample()
+ */
+uint8_t AD7746::available() {
+    return sampleCount;
+}
+
+/** Take the oldest buffered sample.
+ * @param sample Container for the sample
+ * @return False if the buffer is empty
+ */
+bool AD7746::readSample(AD7746Sample *sample) {
+    if (!sampleCount) return false;
+    *sample = samples[sampleHead];
+    sampleHead = (sampleHead + 1) % AD7746_STREAM_BUFFER_SIZE;
+    sampleCount--;
+    return true;
+}
+
+/** Get number of samples overwritten because the buffer was full.
+ * @return Dropped sample count since startStreaming()
+ */
+uint16_t AD7746::getDroppedSamples() {
+    return droppedSamples;
+}
+
+/** Convert a VT code from the internal temperature sensor.
+ * The datasheet transfer function is T = code / 2048 - 4096 degC.
+ * @param code Raw 24-bit VT data
+ * @return Temperature in thousandths of a degree Celsius
+ */
+int32_t AD7746::vtToMilliCelsius(uint32_t code) {
+    // code * 1000 / 2048 == code * 125 / 256, which fits 32 bits for 24-bit codes
+    return (int32_t)((code * 125) >> 8) - 4096000L;
+}
@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2012-04-01 - initial release
+//     2026-10-19 - added RDY-gated streaming with VT interleave and timestamped sample buffer
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -156,6 +157,23 @@ THE SOFTWARE.
 
 
 #define AD7746_DAC_COEFFICIENT           0.13385826771654F // 17pF/127
+#define AD7746_DAC_STEP_AF               133858            // 17pF/127 in attofarads
+
+// Streaming
+#ifndef AD7746_STREAM_BUFFER_SIZE
+#define AD7746_STREAM_BUFFER_SIZE        8 // samples held between readSample() calls
+#endif
+
+#define AD7746_SAMPLE_CAP                (1 << AD7746_RDYCAP_BIT) // sample holds a new capacitance
+#define AD7746_SAMPLE_VT                 (1 << AD7746_RDYVT_BIT)  // sample holds a new VT result
+
+// One streamed conversion result
+struct AD7746Sample {
+    uint32_t timestamp;   // micros() when the result was read
+    int32_t capacitance;  // attofarads, CAPDAC offset included
+    uint32_t vt;          // raw 24-bit VT code, see vtToMilliCelsius()
+    uint8_t channels;     // AD7746_SAMPLE_CAP and/or AD7746_SAMPLE_VT
+};
 
 
 
@@ -178,10 +196,29 @@ class AD7746 {
         void writeCapDacBRegister(uint8_t data);
         void write_register(uint8_t addr,uint8_t data);
         
+        // streaming
+        void setCapDac(uint8_t dacA, uint8_t dacB);
+        void startStreaming(uint8_t filters=AD7746_VTF_20P1 | AD7746_CAPF_11P0, bool temperature=false);
+        void stopStreaming();
+        uint8_t pollStream();
+        uint8_t available();
+        bool readSample(AD7746Sample *sample);
+        uint16_t getDroppedSamples();
+
+        static int32_t vtToMilliCelsius(uint32_t code);
 
     private:
         uint8_t devAddr;
         uint8_t buffer[19];
+
+        int32_t capOffset;   // CAPDAC A - B in attofarads
+        bool vtEnabled;
+        uint32_t lastVT;
+        bool vtPending;
+        AD7746Sample samples[AD7746_STREAM_BUFFER_SIZE];
+        uint8_t sampleHead;
+        uint8_t sampleCount;
+        uint16_t droppedSamples;
 };
 
 #endif /* _AD7746_H_ */
@@ -134,8 +134,9 @@ int16_t ADS1115::getConversion(bool triggerAndPoll) {
       triggerConversion();
       pollConversion(I2CDEV_DEFAULT_READ_TIMEOUT);
     }
-    I2Cdev::readWord(devAddr, ADS1115_RA_CONVERSION, buffer);
-    return buffer[0];
+    uint16_t value = 0;
+    I2Cdev::readWord(devAddr, ADS1115_RA_CONVERSION, &value);
+    return value;
 }
 /** Get AIN0/N1 differential.
  * This changes the MUX setting to AIN0/N1 if necessary, triggers a new
@@ -306,8 +307,9 @@ float ADS1115::getMvPerCount() {
  * @see ADS1115_CFG_OS_BIT
  */
 bool ADS1115::isConversionReady() {
-    I2Cdev::readBitW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_OS_BIT, buffer);
-    return buffer[0];
+    uint16_t ready = 0;
+    I2Cdev::readBitW(devAddr, ADS1115_RA_CONFIG, ADS1115_CFG_OS_BIT, &ready);
+    return ready;
 }
 /** Trigger a new conversion.
  * Writing to this bit will only have effect while in power-down mode (no conversions active).
@@ -1516,34 +1516,38 @@ void ADXL345::setRange(uint8_t range) {
  * @see ADXL345_RA_DATAX0
  */
 void ADXL345::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, buffer);
-    *x = (((int16_t)buffer[1]) << 8) | buffer[0];
-    *y = (((int16_t)buffer[3]) << 8) | buffer[2];
-    *z = (((int16_t)buffer[5]) << 8) | buffer[4];
+    uint8_t data[6] = { 0 };
+    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, data);
+    *x = (((int16_t)data[1]) << 8) | data[0];
+    *y = (((int16_t)data[3]) << 8) | data[2];
+    *z = (((int16_t)data[5]) << 8) | data[4];
 }
 /** Get X-axis accleration measurement.
  * @return 16-bit signed X-axis acceleration value
  * @see ADXL345_RA_DATAX0
  */
 int16_t ADXL345::getAccelerationX() {
-    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 2, data);
+    return (((int16_t)data[1]) << 8) | data[0];
 }
 /** Get Y-axis accleration measurement.
  * @return 16-bit signed Y-axis acceleration value
  * @see ADXL345_RA_DATAY0
  */
 int16_t ADXL345::getAccelerationY() {
-    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAY0, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAY0, 2, data);
+    return (((int16_t)data[1]) << 8) | data[0];
 }
 /** Get Z-axis accleration measurement.
  * @return 16-bit signed Z-axis acceleration value
  * @see ADXL345_RA_DATAZ0
  */
 int16_t ADXL345::getAccelerationZ() {
-    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAZ0, 2, buffer);
-    return (((int16_t)buffer[1]) << 8) | buffer[0];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, ADXL345_RA_DATAZ0, 2, data);
+    return (((int16_t)data[1]) << 8) | data[0];
 }
 
 // FIFO_CTL register
@@ -1666,3 +1670,33 @@ uint8_t ADXL345::getFIFOLength() {
     I2Cdev::readBits(devAddr, ADXL345_RA_FIFO_STATUS, ADXL345_FIFOSTAT_LENGTH_BIT, ADXL345_FIFOSTAT_LENGTH_LENGTH, buffer);
     return buffer[0];
 }
+/** Drain stored acceleration samples from the FIFO buffer.
+ * FIFO_STATUS is read once to find the number of stored entries. Unlike the
+ * ST parts, the ADXL345 does not wrap its register pointer back to DATAX0, and
+ * an entry is popped at the end of every read of the data registers, so each
+ * entry still costs one 6-byte transaction. This saves the status poll per
+ * sample; the time taken by the address phase of each transaction also covers
+ * the 5us minimum gap the datasheet requires between FIFO reads.
+ * @param samples Buffer for X/Y/Z triplets, must hold 3 * max values
+ * @param max Maximum number of samples to read
+ * @return Number of samples read (0 if the FIFO is empty or on bus error)
+ * @see ADXL345_RA_FIFO_STATUS
+ * @see ADXL345_RA_DATAX0
+ */
+uint8_t ADXL345::readFIFO(int16_t *samples, uint8_t max) {
+    uint8_t status;
+    if (I2Cdev::readByte(devAddr, ADXL345_RA_FIFO_STATUS, &status) != 1) return 0;
+    uint8_t level = (status >> (ADXL345_FIFOSTAT_LENGTH_BIT - ADXL345_FIFOSTAT_LENGTH_LENGTH + 1))
+        & ((1 << ADXL345_FIFOSTAT_LENGTH_LENGTH) - 1);
+    if (level > max) level = max;
+
+    uint8_t count = 0;
+    for (; count < level; count++) {
+        uint8_t *raw = (uint8_t *)(samples + count * 3);
+        if (I2Cdev::readBytes(devAddr, ADXL345_RA_DATAX0, 6, raw) != 6) break;
+        samples[count * 3] = (((int16_t)raw[1]) << 8) | raw[0];
+        samples[count * 3 + 1] = (((int16_t)raw[3]) << 8) | raw[2];
+        samples[count * 3 + 2] = (((int16_t)raw[5]) << 8) | raw[4];
+    }
+    return count;
+}
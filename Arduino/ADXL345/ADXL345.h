@@ -352,6 +352,7 @@ class ADXL345 {
         // FIFO_STATUS register
         bool getFIFOTriggerOccurred();
         uint8_t getFIFOLength();
+        uint8_t readFIFO(int16_t *samples, uint8_t max);
 
     private:
         uint8_t devAddr;
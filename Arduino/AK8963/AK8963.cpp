@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2016-01-02 - initial release based on AK8975 code
+//     2026-10-19 - add non-blocking trigger/read, continuous modes and fixed-point sensitivity adjustment
 //
 
 /* ============================================
@@ -38,6 +39,7 @@ THE SOFTWARE.
  */
 AK8963::AK8963() {
     devAddr = AK8963_DEFAULT_ADDRESS;
+    adjustScale[0] = adjustScale[1] = adjustScale[2] = 256;
 }
 
 /** Specific address constructor.
@@ -47,6 +49,7 @@ AK8963::AK8963() {
  */
 AK8963::AK8963(uint8_t address) {
     devAddr = address;
+    adjustScale[0] = adjustScale[1] = adjustScale[2] = 256;
 }
 
 /** Power on and prepare for general usage.
@@ -92,6 +95,73 @@ bool AK8963::getDataOverrun() {
     return buffer[0];
 }
 
+// Non-blocking measurement
+
+/** Start a single measurement without waiting for it to finish.
+ * The result is ready about 7-9 ms later. Poll it with readMeasurement(),
+ * which returns false until the data is available, instead of sleeping.
+ * @param resolution AK8963_RES_14_BIT or AK8963_RES_16_BIT
+ * @see readMeasurement()
+ */
+void AK8963::triggerMeasurement(uint8_t resolution) {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_SINGLE | (resolution << AK8963_CNTL1_RES_BIT));
+}
+/** Start continuous measurements.
+ * The device must pass through power-down when changing mode, so this writes
+ * CNTL1 twice. New data is then available at the selected rate; read it with
+ * readMeasurement(), which also releases the data registers for the next
+ * sample by reading ST2.
+ * @param mode AK8963_MODE_CONTINUOUS_8HZ or AK8963_MODE_CONTINUOUS_100HZ
+ * @param resolution AK8963_RES_14_BIT or AK8963_RES_16_BIT
+ * @see readMeasurement()
+ */
+void AK8963::setContinuousMode(uint8_t mode, uint8_t resolution) {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_POWERDOWN);
+    delayMicroseconds(100);
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, mode | (resolution << AK8963_CNTL1_RES_BIT));
+}
+/** Fetch a finished measurement if one is available.
+ * ST1, the six data bytes and ST2 are read in a single burst, so the
+ * data-ready check, the data and the overflow check cost one transaction.
+ * Values are corrected by the factory sensitivity adjustment once
+ * loadAdjustment() has been called.
+ * @param x Container for X-axis value
+ * @param y Container for Y-axis value
+ * @param z Container for Z-axis value
+ * @return True if new data was read and is valid, false if no data was ready
+ *         or ST2 flagged HOFL (containers are left unchanged)
+ * @see triggerMeasurement()
+ */
+bool AK8963::readMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    if (I2Cdev::readBytes(devAddr, AK8963_RA_ST1, AK8963_MEASUREMENT_LENGTH, buffer) != AK8963_MEASUREMENT_LENGTH) return false;
+    if (!(buffer[0] & (1 << AK8963_ST1_DRDY_BIT))) return false;
+    if (buffer[7] & (1 << AK8963_ST2_HOFL_BIT)) return false;
+    *x = ((int32_t)(int16_t)((((int16_t)buffer[2]) << 8) | buffer[1]) * adjustScale[0]) >> 8;
+    *y = ((int32_t)(int16_t)((((int16_t)buffer[4]) << 8) | buffer[3]) * adjustScale[1]) >> 8;
+    *z = ((int32_t)(int16_t)((((int16_t)buffer[6]) << 8) | buffer[5]) * adjustScale[2]) >> 8;
+    return true;
+}
+/** Read the factory sensitivity adjustment values and precompute their scale.
+ * The datasheet correction Hadj = H * ((ASA - 128) * 0.5 / 128 + 1) reduces to
+ * H * (ASA + 128) / 256, so the per-axis factor is held in 8.8 fixed point
+ * and readMeasurement() applies it with one multiply and shift. The device
+ * is left in power-down mode.
+ * @return True if the Fuse ROM values were read
+ * @see readMeasurement()
+ */
+bool AK8963::loadAdjustment() {
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_POWERDOWN);
+    delayMicroseconds(100);
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_FUSEROM);
+    delayMicroseconds(100);
+    bool ok = I2Cdev::readBytes(devAddr, AK8963_RA_ASAX, 3, buffer) == 3;
+    I2Cdev::writeByte(devAddr, AK8963_RA_CNTL1, AK8963_MODE_POWERDOWN);
+    delayMicroseconds(100);
+    if (!ok) return false;
+    for (uint8_t i = 0; i < 3; i++) adjustScale[i] = (uint16_t)buffer[i] + 128;
+    return true;
+}
+
 // H* registers
 void AK8963::getHeading(int16_t *x, int16_t *y, int16_t *z) {
     I2Cdev::readBytes(devAddr, AK8963_RA_HXL, 6, buffer);
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2016-01-02 - initial release based on AK8975 code
+//     2026-10-19 - add non-blocking trigger/read, continuous modes and fixed-point sensitivity adjustment
 //
 
 /* ============================================
@@ -62,6 +63,8 @@ THE SOFTWARE.
 #define AK8963_RA_ASAY                  0x11
 #define AK8963_RA_ASAZ                  0x12
 
+#define AK8963_MEASUREMENT_LENGTH       8 // ST1, HXL..HZH, ST2
+
 #define AK8963_ST1_DRDY_BIT             0
 #define AK8963_ST1_DOR_BIT              1
 
@@ -109,6 +112,12 @@ class AK8963 {
         bool getDataReady();
         bool getDataOverrun();
 
+        // Non-blocking measurement (ST1..ST2 burst)
+        void triggerMeasurement(uint8_t resolution=AK8963_RES_16_BIT);
+        void setContinuousMode(uint8_t mode, uint8_t resolution=AK8963_RES_16_BIT);
+        bool readMeasurement(int16_t *x, int16_t *y, int16_t *z);
+        bool loadAdjustment();
+
         // H* registers
         void getHeading(int16_t *x, int16_t *y, int16_t *z);
         int16_t getHeadingX();
@@ -144,8 +153,9 @@ class AK8963 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[8];
         uint8_t mode;
+        uint16_t adjustScale[3];
 };
 
 #endif /* _AK8963_H_ */
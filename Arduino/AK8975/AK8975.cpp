@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-08-27 - initial release
+//     2026-10-19 - add non-blocking trigger/read and fixed-point sensitivity adjustment
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +38,7 @@ THE SOFTWARE.
  */
 AK8975::AK8975() {
     devAddr = AK8975_DEFAULT_ADDRESS;
+    adjustScale[0] = adjustScale[1] = adjustScale[2] = 256;
 }
 
 /** Specific address constructor.
@@ -46,6 +48,7 @@ AK8975::AK8975() {
  */
 AK8975::AK8975(uint8_t address) {
     devAddr = address;
+    adjustScale[0] = adjustScale[1] = adjustScale[2] = 256;
 }
 
 /** Power on and prepare for general usage.
@@ -86,6 +89,58 @@ bool AK8975::getDataReady() {
     return buffer[0];
 }
 
+// Non-blocking measurement
+
+/** Start a single measurement without waiting for it to finish.
+ * The result is ready about 7-9 ms later. Poll it with readMeasurement(),
+ * which returns false until the data is available, instead of sleeping.
+ * @see readMeasurement()
+ */
+void AK8975::triggerMeasurement() {
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
+}
+/** Fetch a finished measurement if one is available.
+ * ST1, the six data bytes and ST2 are read in a single burst, so the
+ * data-ready check, the data and the overflow check cost one transaction.
+ * Values are corrected by the factory sensitivity adjustment once
+ * loadAdjustment() has been called.
+ * @param x Container for X-axis value
+ * @param y Container for Y-axis value
+ * @param z Container for Z-axis value
+ * @return True if new data was read and is valid, false if no data was ready
+ *         or ST2 flagged HOFL or DERR (containers are left unchanged)
+ * @see triggerMeasurement()
+ */
+bool AK8975::readMeasurement(int16_t *x, int16_t *y, int16_t *z) {
+    if (I2Cdev::readBytes(devAddr, AK8975_RA_ST1, AK8975_MEASUREMENT_LENGTH, buffer) != AK8975_MEASUREMENT_LENGTH) return false;
+    if (!(buffer[0] & (1 << AK8975_ST1_DRDY_BIT))) return false;
+    if (buffer[7] & ((1 << AK8975_ST2_HOFL_BIT) | (1 << AK8975_ST2_DERR_BIT))) return false;
+    *x = ((int32_t)(int16_t)((((int16_t)buffer[2]) << 8) | buffer[1]) * adjustScale[0]) >> 8;
+    *y = ((int32_t)(int16_t)((((int16_t)buffer[4]) << 8) | buffer[3]) * adjustScale[1]) >> 8;
+    *z = ((int32_t)(int16_t)((((int16_t)buffer[6]) << 8) | buffer[5]) * adjustScale[2]) >> 8;
+    return true;
+}
+/** Read the factory sensitivity adjustment values and precompute their scale.
+ * The datasheet correction Hadj = H * ((ASA - 128) * 0.5 / 128 + 1) reduces to
+ * H * (ASA + 128) / 256, so the per-axis factor is held in 8.8 fixed point
+ * and readMeasurement() applies it with one multiply and shift. The device
+ * is left in power-down mode.
+ * @return True if the Fuse ROM values were read
+ * @see readMeasurement()
+ */
+bool AK8975::loadAdjustment() {
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_POWERDOWN);
+    delayMicroseconds(100);
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_FUSEROM);
+    delayMicroseconds(100);
+    bool ok = I2Cdev::readBytes(devAddr, AK8975_RA_ASAX, 3, buffer) == 3;
+    I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_POWERDOWN);
+    delayMicroseconds(100);
+    if (!ok) return false;
+    for (uint8_t i = 0; i < 3; i++) adjustScale[i] = (uint16_t)buffer[i] + 128;
+    return true;
+}
+
 // H* registers
 void AK8975::getHeading(int16_t *x, int16_t *y, int16_t *z) {
     I2Cdev::writeByte(devAddr, AK8975_RA_CNTL, AK8975_MODE_SINGLE);
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-08-27 - initial release
+//     2026-10-19 - add non-blocking trigger/read and fixed-point sensitivity adjustment
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -61,6 +62,8 @@ THE SOFTWARE.
 #define AK8975_RA_ASAY            0x11
 #define AK8975_RA_ASAZ            0x12
 
+#define AK8975_MEASUREMENT_LENGTH 8 // ST1, HXL..HZH, ST2
+
 #define AK8975_ST1_DRDY_BIT       0
 
 #define AK8975_ST2_HOFL_BIT       3
@@ -95,6 +98,11 @@ class AK8975 {
         // ST1 register
         bool getDataReady();
         
+        // Non-blocking measurement (ST1..ST2 burst)
+        void triggerMeasurement();
+        bool readMeasurement(int16_t *x, int16_t *y, int16_t *z);
+        bool loadAdjustment();
+
         // H* registers
         void getHeading(int16_t *x, int16_t *y, int16_t *z);
         int16_t getHeadingX();
@@ -128,8 +136,9 @@ class AK8975 {
 
     private:
         uint8_t devAddr;
-        uint8_t buffer[6];
+        uint8_t buffer[8];
         uint8_t mode;
+        uint16_t adjustScale[3];
 };
 
 #endif /* _AK8975_H_ */
\ No newline at end of file
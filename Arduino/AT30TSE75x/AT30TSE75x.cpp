@@ -628,3 +628,38 @@ void AT30TSE75x::reset() {
    setTempHighLimit(0x5000);
 }
 
+/** Register map used for snapshots: volatile registers first (these are the
+ * ones restored), then their non-volatile counterparts (read only, since
+ * rewriting them costs an NV write cycle and they survive power loss anyway).
+ */
+static const I2CdevRegisterBlock at30tse75xStateBlocks[AT30TSE75x_STATE_BLOCKS] = {
+   { AT30TSE75x_RA_CONFIGURATION,    2 },
+   { AT30TSE75x_RA_TLOW_LIMIT,       2 },
+   { AT30TSE75x_RA_THIGH_LIMIT,      2 },
+   { AT30TSE75x_RA_NV_CONFIGURATION, 2 },
+   { AT30TSE75x_RA_NV_TLOW_LIMIT,    2 },
+   { AT30TSE75x_RA_NV_THIGH_LIMIT,   2 },
+};
+
+/** Read the volatile and non-volatile configuration in one pass
+ * Each 16-bit register is read with a single 2-byte transfer, replacing the
+ * per-field read-modify cycles of the getConfiguration()/getNV* getters.
+ * Registers are stored MSB first in the order of the register map above.
+ * @param state Buffer of at least AT30TSE75x_STATE_SIZE bytes
+ * @return Status of operation (true = success)
+ */
+bool AT30TSE75x::saveState(uint8_t *state) {
+   return I2Cdev::readRegisterMap(AT30TSE75x_ADDRESS_TEMP_SENSOR | devAddr,
+                                  at30tse75xStateBlocks, AT30TSE75x_STATE_BLOCKS, state);
+}
+
+/** Write the volatile configuration and alert limits back from a snapshot
+ * The non-volatile registers in the snapshot are left untouched.
+ * @param state Buffer previously filled by saveState()
+ * @return Status of operation (true = success)
+ */
+bool AT30TSE75x::restoreState(const uint8_t *state) {
+   return I2Cdev::writeRegisterMap(AT30TSE75x_ADDRESS_TEMP_SENSOR | devAddr,
+                                   at30tse75xStateBlocks, AT30TSE75x_STATE_VOLATILE_BLOCKS, state);
+}
+
@@ -161,6 +161,17 @@ THE SOFTWARE.
 /** @} */
 
 
+/** @defgroup state Register map snapshot parameters
+ *  Registers are 16 bits wide and selected through the pointer register with
+ *  no auto-increment, so every register is its own 2-byte block.
+ *  @{
+ */
+#define AT30TSE75x_STATE_BLOCKS          6   /*!< Number of registers in a full snapshot */
+#define AT30TSE75x_STATE_VOLATILE_BLOCKS 3   /*!< Leading snapshot registers that restoreState() writes back */
+#define AT30TSE75x_STATE_SIZE            12  /*!< Snapshot buffer size in bytes */
+/** @} */
+
+
 
 class AT30TSE75x {
     public:
@@ -262,6 +273,10 @@ class AT30TSE75x {
         // Reset Non-volatile config to default values
         void reset();
 
+        // Register map snapshot
+        bool saveState(uint8_t *state);
+        bool restoreState(const uint8_t *state);
+
 
     private:
         uint8_t devAddr;
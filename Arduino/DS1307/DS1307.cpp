@@ -319,8 +319,10 @@ void DS1307::setTime24(uint8_t hours, uint8_t minutes, uint8_t seconds) {
 }
 
 void DS1307::getDateTime12(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds, uint8_t *ampm) {
-    getTime12(hours, minutes, seconds, ampm);
-    getDate(year, month, day);
+    if (!readDateTime24(year, month, day, hours, minutes, seconds)) return;
+    *ampm = *hours > 11;
+    if (*hours > 12) *hours -= 12;
+    else if (*hours == 0) *hours = 12;
 }
 void DS1307::setDateTime12(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds, uint8_t ampm) {
     setTime12(hours, minutes, seconds, ampm);
@@ -328,17 +330,74 @@ void DS1307::setDateTime12(uint16_t year, uint8_t month, uint8_t day, uint8_t ho
 }
 
 void DS1307::getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
-    getTime24(hours, minutes, seconds);
-    getDate(year, month, day);
+    readDateTime24(year, month, day, hours, minutes, seconds);
 }
 void DS1307::setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds) {
     setTime24(hours, minutes, seconds);
     setDate(year, month, day);
 }
 
+/** Read the complete date and time in a single burst.
+ * The DS1307 copies its timekeeping registers into a secondary buffer on every
+ * START condition, so one 7-byte read of SECONDS through YEAR is always
+ * coherent. Reading the fields one transaction at a time can tear across a
+ * rollover (e.g. 23:59:59 read as 00:59:59 of the same day).
+ * @return Status of read operation (true = success); outputs are untouched on failure
+ */
+bool DS1307::readDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds) {
+    uint8_t regs[DS1307_TIME_REGISTERS];
+    if (I2Cdev::readBytes(devAddr, DS1307_RA_SECONDS, DS1307_TIME_REGISTERS, regs) != DS1307_TIME_REGISTERS) return false;
+
+    clockHalt = regs[DS1307_RA_SECONDS] & 0x80;
+    *seconds = (regs[DS1307_RA_SECONDS] & 0x0F) + ((regs[DS1307_RA_SECONDS] & 0x70) >> 4) * 10;
+    *minutes = (regs[DS1307_RA_MINUTES] & 0x0F) + ((regs[DS1307_RA_MINUTES] & 0x70) >> 4) * 10;
+
+    uint8_t h = regs[DS1307_RA_HOURS];
+    mode12 = h & 0x40;
+    if (mode12) {
+        // Byte: [5 = AM/PM] [4 = 10HR] [3:0 = 1HR]
+        *hours = (h & 0x0F) + ((h & 0x10) >> 4) * 10;
+        if (h & 0x20) {
+            if (*hours < 12) *hours += 12;
+        } else {
+            if (*hours == 12) *hours = 0;
+        }
+    } else {
+        // Byte: [5:4 = 10HR] [3:0 = 1HR]
+        *hours = (h & 0x0F) + ((h & 0x30) >> 4) * 10;
+    }
+
+    *day = (regs[DS1307_RA_DATE] & 0x0F) + ((regs[DS1307_RA_DATE] & 0x30) >> 4) * 10;
+    *month = (regs[DS1307_RA_MONTH] & 0x0F) + ((regs[DS1307_RA_MONTH] & 0x10) >> 4) * 10;
+    *year = 2000 + (regs[DS1307_RA_YEAR] & 0x0F) + ((regs[DS1307_RA_YEAR] & 0xF0) >> 4) * 10;
+    return true;
+}
+
+/** Get the current time as Unix epoch seconds.
+ * Uses the single-burst readDateTime24() and converts without any lookup
+ * tables, so it is cheap enough to call for every logged record. Valid for
+ * the DS1307 year range 2000-2099.
+ * @return Seconds since 1970-01-01 00:00:00 (0 on read failure)
+ */
+uint32_t DS1307::getEpoch() {
+    uint16_t year;
+    uint8_t month, day, hours, minutes, seconds;
+    if (!readDateTime24(&year, &month, &day, &hours, &minutes, &seconds)) return 0;
+
+    uint16_t y = year - 2000;
+    // days before the 1st of this month in a non-leap year
+    uint16_t days = (month <= 2) ? (month - 1) * 31 : (153 * (month - 3) + 2) / 5 + 59;
+    if (month > 2 && y % 4 == 0) days++;
+    days += day - 1 + 365 * y + (y + 3) / 4;
+    return 946684800UL + ((days * 24UL + hours) * 60 + minutes) * 60 + seconds;
+}
+
 #ifdef DS1307_INCLUDE_DATETIME_METHODS
     DateTime DS1307::getDateTime() {
-        DateTime dt = DateTime(getYear(), getMonth(), getDay(), getHours24(), getMinutes(), getSeconds());
+        uint16_t year = 2000;
+        uint8_t month = 1, day = 1, hours = 0, minutes = 0, seconds = 0;
+        readDateTime24(&year, &month, &day, &hours, &minutes, &seconds);
+        DateTime dt = DateTime(year, month, day, hours, minutes, seconds);
         return dt;
     }
     void DS1307::setDateTime(DateTime dt) {
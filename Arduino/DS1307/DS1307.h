@@ -100,6 +100,8 @@ THE SOFTWARE.
 #define DS1307_SQW_RATE_8192        0x2
 #define DS1307_SQW_RATE_32768       0x3
 
+#define DS1307_TIME_REGISTERS       7 // SECONDS through YEAR, read as one burst
+
 #ifdef DS1307_INCLUDE_DATETIME_CLASS
     // DateTime class courtesy of public domain JeeLabs code
     // simple general-purpose date/time class (no TZ / DST / leap second handling!)
@@ -198,6 +200,9 @@ class DS1307 {
         
         void getDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
         void setDateTime24(uint16_t year, uint8_t month, uint8_t day, uint8_t hours, uint8_t minutes, uint8_t seconds);
+
+        bool readDateTime24(uint16_t *year, uint8_t *month, uint8_t *day, uint8_t *hours, uint8_t *minutes, uint8_t *seconds);
+        uint32_t getEpoch(); // seconds since 1970-01-01 00:00:00
         
         #ifdef DS1307_INCLUDE_DATETIME_METHODS
             DateTime getDateTime();
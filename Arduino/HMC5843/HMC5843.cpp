@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - add RDY-checked continuous reads and gain scale
 //     2011-08-22 - initial release
 
 /* ============================================
@@ -37,6 +38,10 @@ THE SOFTWARE.
  */
 HMC5843::HMC5843() {
     devAddr = HMC5843_DEFAULT_ADDRESS;
+    gain = HMC5843_GAIN_1300;
+    mode = HMC5843_MODE_SINGLE;
+    dataRate = HMC5843_RATE_10;
+    headingDue = 0;
 }
 
 /** Specific address constructor.
@@ -46,6 +51,10 @@ HMC5843::HMC5843() {
  */
 HMC5843::HMC5843(uint8_t address) {
     devAddr = address;
+    gain = HMC5843_GAIN_1300;
+    mode = HMC5843_MODE_SINGLE;
+    dataRate = HMC5843_RATE_10;
+    headingDue = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -62,6 +71,8 @@ void HMC5843::initialize() {
         (HMC5843_RATE_10     << (HMC5843_CRA_RATE_BIT - HMC5843_CRA_RATE_LENGTH + 1)) |
         (HMC5843_BIAS_NORMAL << (HMC5843_CRA_BIAS_BIT - HMC5843_CRA_BIAS_LENGTH + 1)));
 
+    dataRate = HMC5843_RATE_10;
+
     // write CONFIG_B register
     setGain(HMC5843_GAIN_1300);
     
@@ -117,6 +128,8 @@ uint8_t HMC5843::getDataRate() {
  */
 void HMC5843::setDataRate(uint8_t rate) {
     I2Cdev::writeBits(devAddr, HMC5843_RA_CONFIG_A, HMC5843_CRA_RATE_BIT, HMC5843_CRA_RATE_LENGTH, rate);
+    dataRate = rate;
+    headingDue = micros() + getOutputPeriod();
 }
 /** Get measurement bias value.
  * @return Current bias value (0-2 for normal/positive/negative respectively)
@@ -170,17 +183,18 @@ uint8_t HMC5843::getGain() {
     return buffer[0];
 }
 /** Set magnetic field gain value.
- * @param gain New magnetic field gain value
+ * @param newGain New magnetic field gain value
  * @see getGain()
  * @see HMC5843_RA_CONFIG_B
  * @see HMC5843_CRB_GAIN_BIT
  * @see HMC5843_CRB_GAIN_LENGTH
  */
-void HMC5843::setGain(uint8_t gain) {
+void HMC5843::setGain(uint8_t newGain) {
     // use this method to guarantee that bits 4-0 are set to zero, which is a
     // requirement specified in the datasheet; it's actually more efficient than
     // using the I2Cdev.writeBits method
-    I2Cdev::writeByte(devAddr, HMC5843_RA_CONFIG_B, gain << (HMC5843_CRB_GAIN_BIT - HMC5843_CRB_GAIN_LENGTH + 1));
+    I2Cdev::writeByte(devAddr, HMC5843_RA_CONFIG_B, newGain << (HMC5843_CRB_GAIN_BIT - HMC5843_CRB_GAIN_LENGTH + 1));
+    gain = newGain; // track for getScaleMilliGauss()
 }
 
 // MODE register
@@ -229,6 +243,7 @@ void HMC5843::setMode(uint8_t newMode) {
     // using the I2Cdev.writeBits method
     I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, newMode << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
     mode = newMode; // track to tell if we have to clear bit 7 after a read
+    headingDue = micros() + getOutputPeriod();
 }
 
 // DATA* registers
@@ -284,6 +299,66 @@ int16_t HMC5843::getHeadingZ() {
     if (mode == HMC5843_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, HMC5843_MODE_SINGLE << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
     return (((int16_t)buffer[4]) << 8) | buffer[5];
 }
+/** Get 3-axis heading measurements only if a new measurement is available.
+ * Intended for continuous-measurement mode (setMode(HMC5843_MODE_CONTINUOUS)),
+ * where the device refreshes the data registers at the configured output
+ * rate (up to 50 Hz with HMC5843_RATE_50). The RDY status bit is not
+ * cleared by reading the data, so it cannot tell a new sample from one
+ * already returned; instead the output period of the rate last set with
+ * setDataRate() is timed on micros(), and the data registers are read (one
+ * transaction) only once a new sample is due. Reads are scheduled on the
+ * device's output grid rather than at the polling times, so a late poll does
+ * not push the following ones past a sample. The device and host clocks
+ * drift apart slowly; callers that need every sample exactly once should
+ * wait for the DRDY pin and call getHeading() instead.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return True if a new measurement has been read, false otherwise
+ * @see setDataRate()
+ * @see getHeading()
+ */
+bool HMC5843::getHeadingIfReady(int16_t *x, int16_t *y, int16_t *z) {
+    uint32_t now = micros();
+    if ((int32_t)(now - headingDue) < 0) return false;
+    if (I2Cdev::readBytes(devAddr, HMC5843_RA_DATAX_H, 6, buffer) != 6) return false;
+    if (mode == HMC5843_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5843_RA_MODE, HMC5843_MODE_SINGLE << (HMC5843_MODEREG_BIT - HMC5843_MODEREG_LENGTH + 1));
+    uint32_t period = getOutputPeriod();
+    headingDue += period;
+    // single measurements restart on the read, and a caller that fell more
+    // than a period behind resynchronizes instead of catching up
+    if (mode == HMC5843_MODE_SINGLE || (int32_t)(now - headingDue) >= 0) headingDue = now + period;
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
+    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    return true;
+}
+/** Get the time between measurements in the current mode and data rate.
+ * @return Output period in microseconds
+ */
+uint32_t HMC5843::getOutputPeriod() {
+    // a single measurement takes no longer than one 50 Hz period
+    if (mode == HMC5843_MODE_SINGLE) return 20000;
+    switch (dataRate) {
+        case HMC5843_RATE_0P5: return 2000000;
+        case HMC5843_RATE_1: return 1000000;
+        case HMC5843_RATE_2: return 500000;
+        case HMC5843_RATE_5: return 200000;
+        case HMC5843_RATE_10: return 100000;
+        case HMC5843_RATE_20: return 50000;
+        default: return 20000; // HMC5843_RATE_50
+    }
+}
+/** Get the field represented by one LSB at the current gain setting.
+ * Uses the gain last written with setGain() (or the power-on default), so no
+ * bus access is needed.
+ * @return Milligauss per LSB
+ * @see setGain()
+ */
+float HMC5843::getScaleMilliGauss() {
+    static const uint16_t lsbPerGauss[8] = { 1620, 1300, 970, 780, 530, 460, 390, 280 };
+    return 1000.0f / lsbPerGauss[gain & 0x07];
+}
 
 // STATUS register
 
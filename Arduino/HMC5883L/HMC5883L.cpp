@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - add RDY-checked continuous reads and gain scale
 //     2012-06-12 - fixed swapped Y/Z axes
 //     2011-08-22 - small Doxygen comment fixes
 //     2011-07-31 - initial release
@@ -39,6 +40,10 @@ THE SOFTWARE.
  */
 HMC5883L::HMC5883L() {
     devAddr = HMC5883L_DEFAULT_ADDRESS;
+    gain = HMC5883L_GAIN_1090;
+    mode = HMC5883L_MODE_SINGLE;
+    dataRate = HMC5883L_RATE_15;
+    headingDue = 0;
 }
 
 /** Specific address constructor.
@@ -48,6 +53,10 @@ HMC5883L::HMC5883L() {
  */
 HMC5883L::HMC5883L(uint8_t address) {
     devAddr = address;
+    gain = HMC5883L_GAIN_1090;
+    mode = HMC5883L_MODE_SINGLE;
+    dataRate = HMC5883L_RATE_15;
+    headingDue = 0;
 }
 
 /** Power on and prepare for general usage.
@@ -65,6 +74,8 @@ void HMC5883L::initialize() {
         (HMC5883L_RATE_15     << (HMC5883L_CRA_RATE_BIT - HMC5883L_CRA_RATE_LENGTH + 1)) |
         (HMC5883L_BIAS_NORMAL << (HMC5883L_CRA_BIAS_BIT - HMC5883L_CRA_BIAS_LENGTH + 1)));
 
+    dataRate = HMC5883L_RATE_15;
+
     // write CONFIG_B register
     setGain(HMC5883L_GAIN_1090);
     
@@ -142,6 +153,8 @@ uint8_t HMC5883L::getDataRate() {
  */
 void HMC5883L::setDataRate(uint8_t rate) {
     I2Cdev::writeBits(devAddr, HMC5883L_RA_CONFIG_A, HMC5883L_CRA_RATE_BIT, HMC5883L_CRA_RATE_LENGTH, rate);
+    dataRate = rate;
+    headingDue = micros() + getOutputPeriod();
 }
 /** Get measurement bias value.
  * @return Current bias value (0-2 for normal/positive/negative respectively)
@@ -195,17 +208,18 @@ uint8_t HMC5883L::getGain() {
     return buffer[0];
 }
 /** Set magnetic field gain value.
- * @param gain New magnetic field gain value
+ * @param newGain New magnetic field gain value
  * @see getGain()
  * @see HMC5883L_RA_CONFIG_B
  * @see HMC5883L_CRB_GAIN_BIT
  * @see HMC5883L_CRB_GAIN_LENGTH
  */
-void HMC5883L::setGain(uint8_t gain) {
+void HMC5883L::setGain(uint8_t newGain) {
     // use this method to guarantee that bits 4-0 are set to zero, which is a
     // requirement specified in the datasheet; it's actually more efficient than
     // using the I2Cdev.writeBits method
-    I2Cdev::writeByte(devAddr, HMC5883L_RA_CONFIG_B, gain << (HMC5883L_CRB_GAIN_BIT - HMC5883L_CRB_GAIN_LENGTH + 1));
+    I2Cdev::writeByte(devAddr, HMC5883L_RA_CONFIG_B, newGain << (HMC5883L_CRB_GAIN_BIT - HMC5883L_CRB_GAIN_LENGTH + 1));
+    gain = newGain; // track for getScaleMilliGauss()
 }
 
 // MODE register
@@ -252,6 +266,7 @@ void HMC5883L::setMode(uint8_t newMode) {
     // using the I2Cdev.writeBits method
     I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, newMode << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
     mode = newMode; // track to tell if we have to clear bit 7 after a read
+    headingDue = micros() + getOutputPeriod();
 }
 
 // DATA* registers
@@ -307,6 +322,66 @@ int16_t HMC5883L::getHeadingZ() {
     if (mode == HMC5883L_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
     return (((int16_t)buffer[2]) << 8) | buffer[3];
 }
+/** Get 3-axis heading measurements only if a new measurement is available.
+ * Intended for continuous-measurement mode (setMode(HMC5883L_MODE_CONTINUOUS)),
+ * where the device refreshes the data registers at the configured output
+ * rate (up to 75 Hz with HMC5883L_RATE_75). The RDY status bit is not
+ * cleared by reading the data, so it cannot tell a new sample from one
+ * already returned; instead the output period of the rate last set with
+ * setDataRate() is timed on micros(), and the data registers are read (one
+ * transaction) only once a new sample is due. Reads are scheduled on the
+ * device's output grid rather than at the polling times, so a late poll does
+ * not push the following ones past a sample. The device and host clocks
+ * drift apart slowly; callers that need every sample exactly once should
+ * wait for the DRDY pin and call getHeading() instead.
+ * @param x 16-bit signed integer container for X-axis heading
+ * @param y 16-bit signed integer container for Y-axis heading
+ * @param z 16-bit signed integer container for Z-axis heading
+ * @return True if a new measurement has been read, false otherwise
+ * @see setDataRate()
+ * @see getHeading()
+ */
+bool HMC5883L::getHeadingIfReady(int16_t *x, int16_t *y, int16_t *z) {
+    uint32_t now = micros();
+    if ((int32_t)(now - headingDue) < 0) return false;
+    if (I2Cdev::readBytes(devAddr, HMC5883L_RA_DATAX_H, 6, buffer) != 6) return false;
+    if (mode == HMC5883L_MODE_SINGLE) I2Cdev::writeByte(devAddr, HMC5883L_RA_MODE, HMC5883L_MODE_SINGLE << (HMC5883L_MODEREG_BIT - HMC5883L_MODEREG_LENGTH + 1));
+    uint32_t period = getOutputPeriod();
+    headingDue += period;
+    // single measurements restart on the read, and a caller that fell more
+    // than a period behind resynchronizes instead of catching up
+    if (mode == HMC5883L_MODE_SINGLE || (int32_t)(now - headingDue) >= 0) headingDue = now + period;
+    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
+    *y = (((int16_t)buffer[4]) << 8) | buffer[5];
+    *z = (((int16_t)buffer[2]) << 8) | buffer[3];
+    return true;
+}
+/** Get the time between measurements in the current mode and data rate.
+ * @return Output period in microseconds
+ */
+uint32_t HMC5883L::getOutputPeriod() {
+    // a single measurement takes about 6 ms
+    if (mode == HMC5883L_MODE_SINGLE) return 6000;
+    switch (dataRate) {
+        case HMC5883L_RATE_0P75: return 1333333;
+        case HMC5883L_RATE_1P5: return 666667;
+        case HMC5883L_RATE_3: return 333333;
+        case HMC5883L_RATE_7P5: return 133333;
+        case HMC5883L_RATE_15: return 66667;
+        case HMC5883L_RATE_30: return 33333;
+        default: return 13333; // HMC5883L_RATE_75
+    }
+}
+/** Get the field represented by one LSB at the current gain setting.
+ * Uses the gain last written with setGain() (or the power-on default), so no
+ * bus access is needed.
+ * @return Milligauss per LSB
+ * @see setGain()
+ */
+float HMC5883L::getScaleMilliGauss() {
+    static const uint16_t lsbPerGauss[8] = { 1370, 1090, 820, 660, 440, 390, 330, 220 };
+    return 1000.0f / lsbPerGauss[gain & 0x07];
+}
 
 // STATUS register
 
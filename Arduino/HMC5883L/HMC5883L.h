@@ -4,6 +4,7 @@
 // Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - add rate-timed continuous reads and gain scale
 //     2012-06-12 - fixed swapped Y/Z axes
 //     2011-08-22 - small Doxygen comment fixes
 //     2011-07-31 - initial release
@@ -129,6 +130,8 @@ class HMC5883L {
         int16_t getHeadingX();
         int16_t getHeadingY();
         int16_t getHeadingZ();
+        bool getHeadingIfReady(int16_t *x, int16_t *y, int16_t *z);
+        float getScaleMilliGauss();
 
         // STATUS register
         bool getLockStatus();
@@ -143,6 +146,11 @@ class HMC5883L {
         uint8_t devAddr;
         uint8_t buffer[6];
         uint8_t mode;
+        uint8_t gain;
+        uint8_t dataRate;           // output rate last written, see getHeadingIfReady()
+        uint32_t headingDue;        // micros() after which the next sample is ready
+
+        uint32_t getOutputPeriod();
 };
 
 #endif /* _HMC5883L_H_ */
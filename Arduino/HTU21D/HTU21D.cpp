@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2016-03-24 - initial release
+//     2026-10-19 - added no-hold trigger/fetch, CRC check and combined temperature+RH cycle
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -32,16 +33,40 @@ THE SOFTWARE.
 
 #include "HTU21D.h"
 
+// CRC-8, polynomial x^8 + x^5 + x^4 + 1 (0x31), initial value 0x00
+static const uint8_t htu21dCRCTable[256] PROGMEM = {
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E,
+    0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D,
+    0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8,
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB,
+    0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13,
+    0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95,
+    0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6,
+    0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17,
+    0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2,
+    0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69,
+    0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A,
+    0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC
+};
 
 /** Default constructor, uses default I2C address.
  * @see HTU21D_DEFAULT_ADDRESS
  */
 HTU21D::HTU21D() {
     devAddr = HTU21D_DEFAULT_ADDRESS;
+    cycleState = HTU21D_CYCLE_IDLE;
+    resetStart = 0;
+    lastTemperature = NAN;
+    lastHumidity = NAN;
 }
 
 /** Power on and prepare for general usage.
- * This operation calls reset() on the HTU21D device and it takes at least 15milliseconds.
+ * This operation calls reset() on the HTU21D device; the first command after
+ * it is held back until the 15ms reset time has passed.
  */
 void HTU21D::initialize() {
     reset();
@@ -54,44 +79,234 @@ void HTU21D::initialize() {
  */
 bool HTU21D::testConnection() {
     reset();
+    waitReset();
     buffer[0] = 0;
     I2Cdev::readByte(devAddr, HTU21D_READ_USER_REGISTER, buffer);
     return buffer[0] == 0x2;
 }
 
-/** Reads and returns the temperature, ignores the CRC field.
- * @return The measured temperature, or NaN if the operation failed.
+/** Measures and returns the temperature.
+ * Uses the no-hold-master command, so the bus is free for other devices while
+ * the conversion runs. Blocks for about 50ms.
+ * @return The measured temperature, or NaN if the operation or CRC check failed.
+ * @see triggerTemperature()
  */
 float HTU21D::getTemperature() {
-    // Ignore the CRC byte
-    uint16_t t = 0;
-    if (1!=I2Cdev::readWord(devAddr, HTU21D_RA_TEMPERATURE, &t)){
-        return NAN;
+    float celsius = NAN;
+    if (!triggerTemperature()) return NAN;
+    delay(HTU21D_TEMPERATURE_DELAY);
+    for (uint8_t retry = 0; retry < 5; retry++) {
+        int8_t status = fetchTemperature(&celsius);
+        if (status != 0) return status > 0 ? celsius : NAN;
+        delay(2);
     }
-    // clear the status bits (bit0 & bit1) and calculate the temperature 
-    // as per the formula in the datasheet
-    return ((float)(t&0xFFFC))*175.72/65536.0-46.85;
+    return NAN;
 }
 
-/** Reads and returns the humidity, ignores the CRC field
- * @return The measured humidity, or NaN if the operation failed.
+/** Measures and returns the humidity, not compensated for temperature.
+ * Uses the no-hold-master command and blocks for about 16ms.
+ * @return The measured humidity, or NaN if the operation or CRC check failed.
+ * @see triggerHumidity()
+ * @see getMeasurement()
  */
 float HTU21D::getHumidity() {
-    // Ignore the CRC byte
-    uint16_t t = 0;
-    if (1!=I2Cdev::readWord(devAddr, HTU21D_RA_HUMIDITY, &t)){
-        return NAN;
+    float humidity = NAN;
+    if (!triggerHumidity()) return NAN;
+    delay(HTU21D_HUMIDITY_DELAY);
+    for (uint8_t retry = 0; retry < 5; retry++) {
+        int8_t status = fetchHumidity(&humidity);
+        if (status != 0) return status > 0 ? humidity : NAN;
+        delay(2);
     }
-    // clear the status bits (bit0 & bit1) and calculate the humidity 
+    return NAN;
+}
+
+/** Start a temperature conversion without holding the bus.
+ * Fetch the result with fetchTemperature() once HTU21D_TEMPERATURE_DELAY
+ * milliseconds have passed.
+ * @return True if the command was acknowledged
+ */
+bool HTU21D::triggerTemperature() {
+    return trigger(HTU21D_TRIGGER_TEMPERATURE);
+}
+
+/** Start a humidity conversion without holding the bus.
+ * Fetch the result with fetchHumidity() once HTU21D_HUMIDITY_DELAY
+ * milliseconds have passed.
+ * @return True if the command was acknowledged
+ */
+bool HTU21D::triggerHumidity() {
+    return trigger(HTU21D_TRIGGER_HUMIDITY);
+}
+
+/** Read the result of a conversion started with triggerTemperature().
+ * @param celsius Container for the temperature in degC
+ * @return 1 on success, 0 if the conversion is still running, -1 if the CRC
+ *         or status bits were wrong (the measurement must be retriggered)
+ */
+int8_t HTU21D::fetchTemperature(float *celsius) {
+    uint16_t raw;
+    int8_t status = fetch(HTU21D_TRIGGER_TEMPERATURE, &raw);
+    // clear the status bits (bit0 & bit1) and calculate the temperature
     // as per the formula in the datasheet
-    return ((float)(t&0xFFFC))*125.0/65536.0-6.0;
+    if (status > 0) *celsius = ((float)(raw & 0xFFFC)) * 175.72 / 65536.0 - 46.85;
+    return status;
+}
+
+/** Read the result of a conversion started with triggerHumidity().
+ * @param humidity Container for the relative humidity in %, not compensated
+ * @return 1 on success, 0 if the conversion is still running, -1 if the CRC
+ *         or status bits were wrong (the measurement must be retriggered)
+ */
+int8_t HTU21D::fetchHumidity(float *humidity) {
+    uint16_t raw;
+    int8_t status = fetch(HTU21D_TRIGGER_HUMIDITY, &raw);
+    // clear the status bits (bit0 & bit1) and calculate the humidity
+    // as per the formula in the datasheet
+    if (status > 0) *humidity = ((float)(raw & 0xFFFC)) * 125.0 / 65536.0 - 6.0;
+    return status;
+}
+
+/** Start a combined temperature and humidity cycle.
+ * Triggers the temperature conversion; keep calling updateMeasurement() from
+ * the main loop until it returns 1. No bus traffic is generated until each
+ * conversion is due.
+ * @return True if the cycle was started
+ * @see updateMeasurement()
+ */
+bool HTU21D::startMeasurement() {
+    if (!triggerTemperature()) {
+        cycleState = HTU21D_CYCLE_IDLE;
+        return false;
+    }
+    cycleState = HTU21D_CYCLE_TEMPERATURE;
+    cycleStart = millis();
+    return true;
+}
+
+/** Advance a combined cycle started with startMeasurement().
+ * Once the temperature is in, the humidity conversion is triggered, and when
+ * that completes the humidity is compensated for temperature as given in the
+ * datasheet: RH = RH_actual + (25 - T) * HTU21D_RH_TEMP_COEFF.
+ * @return 1 when new values are available from getLastTemperature() and
+ *         getLastHumidity(), 0 while the cycle is running, -1 if a CRC check
+ *         or bus operation failed or no cycle was started
+ */
+int8_t HTU21D::updateMeasurement() {
+    int8_t status;
+    switch (cycleState) {
+        case HTU21D_CYCLE_TEMPERATURE:
+            if (millis() - cycleStart < HTU21D_TEMPERATURE_DELAY) return 0;
+            status = fetchTemperature(&lastTemperature);
+            if (status == 0) return 0;
+            if (status < 0 || !triggerHumidity()) break;
+            cycleState = HTU21D_CYCLE_HUMIDITY;
+            cycleStart = millis();
+            return 0;
+
+        case HTU21D_CYCLE_HUMIDITY:
+            if (millis() - cycleStart < HTU21D_HUMIDITY_DELAY) return 0;
+            status = fetchHumidity(&lastHumidity);
+            if (status == 0) return 0;
+            if (status < 0) break;
+            lastHumidity += (25.0f - lastTemperature) * HTU21D_RH_TEMP_COEFF;
+            cycleState = HTU21D_CYCLE_IDLE;
+            return 1;
+    }
+    cycleState = HTU21D_CYCLE_IDLE;
+    return -1;
+}
+
+/** Run a complete combined cycle, blocking for about 70ms.
+ * @param celsius Container for the temperature in degC
+ * @param humidity Container for the temperature-compensated humidity in %
+ * @return True if both values were read with valid CRCs
+ * @see startMeasurement()
+ */
+bool HTU21D::getMeasurement(float *celsius, float *humidity) {
+    if (!startMeasurement()) return false;
+    uint32_t t1 = millis();
+    int8_t status;
+    while ((status = updateMeasurement()) == 0) {
+        if (millis() - t1 > 2 * (HTU21D_TEMPERATURE_DELAY + HTU21D_HUMIDITY_DELAY)) {
+            cycleState = HTU21D_CYCLE_IDLE;
+            return false;
+        }
+        delay(1);
+    }
+    if (status < 0) return false;
+    *celsius = lastTemperature;
+    *humidity = lastHumidity;
+    return true;
+}
+
+/** Get the temperature from the last completed combined cycle.
+ * @return Temperature in degC, or NaN if no cycle has completed
+ */
+float HTU21D::getLastTemperature() {
+    return lastTemperature;
+}
+
+/** Get the compensated humidity from the last completed combined cycle.
+ * @return Relative humidity in %, or NaN if no cycle has completed
+ */
+float HTU21D::getLastHumidity() {
+    return lastHumidity;
 }
 
 /** Does a soft reset of the HTU21D
- * This operation takes at least 15milliseconds.
+ * The device needs 15 milliseconds to come back; rather than sleeping here,
+ * the next command waits for whatever is left of that time.
  */
 void HTU21D::reset() {
-    I2Cdev::writeByte(devAddr, HTU21D_RESET, 0);
-    delay(15);
+    buffer[0] = HTU21D_RESET;
+    I2Cdev::writeRaw(devAddr, 1, buffer);
+    resetStart = millis();
+    if (!resetStart) resetStart = 1; // 0 means no reset pending
+    cycleState = HTU21D_CYCLE_IDLE;
+}
+
+/** Calculate the CRC-8 the HTU21D appends to each measurement.
+ * @param data Bytes to check (MSB first)
+ * @param length Number of bytes
+ * @return CRC over the data; 0 if the data ends with a matching CRC byte
+ */
+uint8_t HTU21D::crc8(const uint8_t *data, uint8_t length) {
+    uint8_t crc = 0;
+    while (length--) crc = pgm_read_byte(&htu21dCRCTable[crc ^ *data++]);
+    return crc;
 }
 
+/** Send a no-hold measurement command.
+ * @param command HTU21D_TRIGGER_TEMPERATURE or HTU21D_TRIGGER_HUMIDITY
+ * @return True if the command was acknowledged
+ */
+bool HTU21D::trigger(uint8_t command) {
+    waitReset();
+    buffer[0] = command;
+    return I2Cdev::writeRaw(devAddr, 1, buffer);
+}
+
+/** Read and validate a 3-byte no-hold measurement result.
+ * The HTU21D NACKs its read address until the conversion has finished, so a
+ * short or failed read simply means "not ready yet". The result is read
+ * with I2Cdev::readRaw(), without sending a register address first.
+ * @param command Trigger command the result is expected to belong to
+ * @param raw Container for the 16-bit raw value including status bits
+ * @return 1 on success, 0 if not ready, -1 on CRC or status mismatch
+ */
+int8_t HTU21D::fetch(uint8_t command, uint16_t *raw) {
+    if (I2Cdev::readRaw(devAddr, 3, buffer) != 3) return 0;
+    if (crc8(buffer, 3) != 0) return -1;
+    if (((buffer[1] & HTU21D_STATUS_HUMIDITY) != 0) != (command == HTU21D_TRIGGER_HUMIDITY)) return -1;
+    *raw = (((uint16_t)buffer[0]) << 8) | buffer[1];
+    return 1;
+}
+
+/** Wait out whatever is left of the reset time, if a reset is pending. */
+void HTU21D::waitReset() {
+    if (!resetStart) return;
+    uint32_t elapsed = millis() - resetStart;
+    if (elapsed < HTU21D_RESET_DELAY) delay(HTU21D_RESET_DELAY - elapsed);
+    resetStart = 0;
+}
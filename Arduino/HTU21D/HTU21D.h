@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2016-03-24 - initial release
+//     2026-10-19 - added no-hold trigger/fetch, CRC check and combined temperature+RH cycle
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -42,6 +43,23 @@ THE SOFTWARE.
 #define HTU21D_RESET               0xFE
 #define HTU21D_WRITE_USER_REGISTER 0xE6
 #define HTU21D_READ_USER_REGISTER  0xE7
+#define HTU21D_TRIGGER_TEMPERATURE 0xF3 // no hold master
+#define HTU21D_TRIGGER_HUMIDITY    0xF5 // no hold master
+
+// worst-case conversion and reset times in milliseconds (default 14-bit T, 12-bit RH)
+#define HTU21D_TEMPERATURE_DELAY   50
+#define HTU21D_HUMIDITY_DELAY      16
+#define HTU21D_RESET_DELAY         15
+
+// status bit 1 of the LSB tells which measurement the result belongs to
+#define HTU21D_STATUS_HUMIDITY     0x02
+
+// temperature coefficient for RH compensation, %RH per degC
+#define HTU21D_RH_TEMP_COEFF       -0.15f
+
+#define HTU21D_CYCLE_IDLE          0
+#define HTU21D_CYCLE_TEMPERATURE   1
+#define HTU21D_CYCLE_HUMIDITY      2
 
 class HTU21D {
     public:
@@ -53,11 +71,33 @@ class HTU21D {
         float getTemperature();
         float getHumidity();
 
+        bool triggerTemperature();
+        bool triggerHumidity();
+        int8_t fetchTemperature(float *celsius);
+        int8_t fetchHumidity(float *humidity);
+
+        bool startMeasurement();
+        int8_t updateMeasurement();
+        bool getMeasurement(float *celsius, float *humidity);
+        float getLastTemperature();
+        float getLastHumidity();
+
         void reset();
 
+        static uint8_t crc8(const uint8_t *data, uint8_t length);
+
     private:
+        int8_t fetch(uint8_t command, uint16_t *raw);
+        bool trigger(uint8_t command);
+        void waitReset();
+
         uint8_t devAddr;
-        uint8_t buffer[2];
+        uint8_t buffer[3];
+        uint8_t cycleState;
+        uint32_t cycleStart;
+        uint32_t resetStart;
+        float lastTemperature;
+        float lastHumidity;
 };
 
 #endif /* _HTU21D_H_ */
@@ -3,6 +3,9 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - add interrupt-driven FastwireQueue transaction engine for AVR (I2CDEV_FASTWIRE_QUEUE)
+//      2026-10-19 - add readBytesLong()/writeBytesLong() for transfers of 256 to 32767 bytes
+//      2026-10-19 - add readMasked()/writeMasked() for precomputed-mask field access (see helper_field.h)
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -310,6 +313,111 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
     return count;
 }
 
+/** Read up to I2CDEV_LONG_MAX_LENGTH (32767) bytes from an 8-bit device register.
+ * The Wire buffer limits a single transaction, so longer reads are split into
+ * buffer-sized chunks. Every chunk re-addresses the same register, exactly as
+ * readBytes() already does, which suits FIFO data ports (e.g. MPU6050
+ * FIFO_R_W) but not auto-incrementing register blocks.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param length Number of bytes to read (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure or a length over the limit)
+ */
+int16_t I2Cdev::readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout, void *wireObj) {
+    if (length > I2CDEV_LONG_MAX_LENGTH) return -1;
+    uint16_t count = 0;
+    while (count < length) {
+        // keep each chunk within the Wire buffer and within readBytes()'s int8_t return
+        uint16_t chunk = length - count;
+        if (chunk > I2CDEVLIB_WIRE_BUFFER_LENGTH) chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH;
+        if (chunk > 127) chunk = 127;
+        if (readBytes(devAddr, regAddr, chunk, data + count, timeout, wireObj) != (int8_t)chunk) return -1;
+        count += chunk;
+    }
+    return count;
+}
+
+/** Read bytes from a device without writing a register address first.
+ * For command-style devices that answer a plain read with the result of the
+ * last command (e.g. HTU21D no-hold measurements). A device that is still
+ * busy typically NACKs its address, which shows up as a short read. The
+ * transfer cannot be split, so length is limited to the Wire buffer.
+ * @param devAddr I2C slave device address
+ * @param length Number of bytes to read (at most I2CDEVLIB_WIRE_BUFFER_LENGTH)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure)
+ */
+int8_t I2Cdev::readRaw(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout, void *wireObj) {
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") reading ");
+        Serial.print(length, DEC);
+        Serial.print(" bytes...");
+    #endif
+
+    if (length > I2CDEVLIB_WIRE_BUFFER_LENGTH || length > 127) return -1;
+    int8_t count = 0;
+    uint32_t t1 = millis();
+
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
+        TwoWire *useWire = &Wire;
+        if (wireObj) useWire = (TwoWire *)wireObj;
+
+        useWire->requestFrom((uint8_t)devAddr, (uint8_t)length);
+        for (; useWire->available() && count < length && (timeout == 0 || millis() - t1 < timeout); count++) {
+            #if (ARDUINO < 100)
+                data[count] = useWire->receive();
+            #else
+                data[count] = useWire->read();
+            #endif
+            #ifdef I2CDEV_SERIAL_DEBUG
+                Serial.print(data[count], HEX);
+                if (count + 1 < length) Serial.print(" ");
+            #endif
+        }
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
+
+        if (Fastwire::readBuf(devAddr << 1, data, length) == 0) {
+            count = length; // success
+        } else {
+            count = -1; // error (including a busy device NACKing its address)
+        }
+
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
+
+        // NBWire has a single bus object; wireObj does not apply
+        Wire.requestFrom((uint8_t)devAddr, (int)length, timeout);
+        for (; Wire.available() && count < length; count++) {
+            data[count] = Wire.receive();
+            #ifdef I2CDEV_SERIAL_DEBUG
+                Serial.print(data[count], HEX);
+                if (count + 1 < length) Serial.print(" ");
+            #endif
+        }
+
+    #else
+
+        count = -1; // backend has no raw transfer
+
+    #endif
+
+    // check for timeout
+    if (timeout > 0 && millis() - t1 >= timeout && count < length) count = -1; // timeout
+
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print(". Done (");
+        Serial.print(count, DEC);
+        Serial.println(" read).");
+    #endif
+
+    return count;
+}
+
 /** Read multiple words from a 16-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
@@ -580,7 +688,7 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
     #endif
     uint8_t status = 0;
 
-#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
     TwoWire *useWire = &Wire;
     if (wireObj) useWire = (TwoWire *)wireObj;
 #endif
@@ -593,9 +701,6 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
             || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
         useWire->beginTransmission(devAddr);
         useWire->write((uint8_t) regAddr); // send address
-    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::beginTransmission(devAddr);
-        Fastwire::write(regAddr);
     #endif
     for (uint8_t i = 0; i < length; i++) {
         #ifdef I2CDEV_SERIAL_DEBUG
@@ -608,8 +713,6 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
                 || (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE && ARDUINO >= 100) \
                 || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
             useWire->write((uint8_t) data[i]);
-        #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-            Fastwire::write((uint8_t) data[i]);
         #endif
     }
     #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
@@ -619,8 +722,99 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
             || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
         status = useWire->endTransmission();
     #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::stop();
-        //status = Fastwire::endTransmission();
+        // one call for the whole transfer so it can go through FastwireQueue
+        status = Fastwire::writeBuf(devAddr << 1, regAddr, data, length);
+        #ifndef I2CDEV_FASTWIRE_QUEUE
+            Fastwire::stop();
+        #endif
+    #endif
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.println(". Done.");
+    #endif
+    return status == 0;
+}
+
+/** Write up to I2CDEV_LONG_MAX_LENGTH (32767) bytes to an 8-bit device register.
+ * Split into Wire-buffer-sized transactions (less the register address byte)
+ * where needed; every chunk re-addresses the same register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register address to write to
+ * @param length Number of bytes to write (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, void *wireObj) {
+    if (length > I2CDEV_LONG_MAX_LENGTH) return false;
+    uint16_t count = 0;
+    do {
+        uint16_t chunk = length - count;
+        if (chunk > I2CDEVLIB_WIRE_BUFFER_LENGTH - 1) chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH - 1;
+        if (!writeBytes(devAddr, regAddr, chunk, data + count, wireObj)) return false;
+        count += chunk;
+    } while (count < length);
+    return true;
+}
+
+/** Write bytes to a device without a register address.
+ * For command-style devices where the first byte is a command rather than a
+ * register (e.g. HTU21D trigger and reset commands).
+ * @param devAddr I2C slave device address
+ * @param length Number of bytes to write (at least 1)
+ * @param data Buffer to copy the command and any arguments from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeRaw(uint8_t devAddr, uint8_t length, uint8_t *data, void *wireObj) {
+    #ifdef I2CDEV_SERIAL_DEBUG
+        Serial.print("I2C (0x");
+        Serial.print(devAddr, HEX);
+        Serial.print(") writing ");
+        Serial.print(length, DEC);
+        Serial.print(" bytes...");
+    #endif
+    if (length == 0) return false;
+    uint8_t status = 0;
+
+    #if (I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
+        TwoWire *useWire = &Wire;
+        if (wireObj) useWire = (TwoWire *)wireObj;
+
+        useWire->beginTransmission(devAddr);
+        for (uint8_t i = 0; i < length; i++) {
+            #ifdef I2CDEV_SERIAL_DEBUG
+                Serial.print(data[i], HEX);
+                if (i + 1 < length) Serial.print(" ");
+            #endif
+            #if (ARDUINO < 100)
+                useWire->send((uint8_t) data[i]);
+            #else
+                useWire->write((uint8_t) data[i]);
+            #endif
+        }
+        #if (ARDUINO < 100)
+            useWire->endTransmission();
+        #else
+            status = useWire->endTransmission();
+        #endif
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
+        // on the wire the first byte is indistinguishable from a register address
+        status = Fastwire::writeBuf(devAddr << 1, data[0], data + 1, length - 1);
+        #ifndef I2CDEV_FASTWIRE_QUEUE
+            Fastwire::stop();
+        #endif
+    #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
+        // NBWire has a single bus object; wireObj does not apply
+        if (length > NBWIRE_BUFFER_LENGTH) return false;
+        Wire.beginTransmission(devAddr);
+        for (uint8_t i = 0; i < length; i++) {
+            #ifdef I2CDEV_SERIAL_DEBUG
+                Serial.print(data[i], HEX);
+                if (i + 1 < length) Serial.print(" ");
+            #endif
+            Wire.send((uint8_t) data[i]);
+        }
+        status = Wire.endTransmission();
+    #else
+        status = 1; // backend has no raw transfer
     #endif
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.println(". Done.");
@@ -629,6 +823,8 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
 }
 
 /** Write multiple words to a 16-bit device register.
+ * With Fastwire the words are staged big-endian in a buffer of
+ * I2CDEVLIB_WIRE_BUFFER_LENGTH bytes, so longer writes are rejected.
  * @param devAddr I2C slave device address
  * @param regAddr First register address to write to
  * @param length Number of words to write
@@ -647,7 +843,7 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
     #endif
     uint8_t status = 0;
 
-#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE
+#if I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_SBWIRE || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
     TwoWire *useWire = &Wire;
     if (wireObj) useWire = (TwoWire *)wireObj;
 #endif
@@ -661,8 +857,9 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
         useWire->beginTransmission(devAddr);
         useWire->write(regAddr); // send address
     #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::beginTransmission(devAddr);
-        Fastwire::write(regAddr);
+        // writeBuf() takes a byte count, which also caps this at 127 words
+        uint8_t bytes[I2CDEVLIB_WIRE_BUFFER_LENGTH];
+        if (length > sizeof(bytes) / 2 || length > 127) return false;
     #endif
     for (uint8_t i = 0; i < length; i++) { 
         #ifdef I2CDEV_SERIAL_DEBUG
@@ -678,9 +875,8 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
             useWire->write((uint8_t)(data[i] >> 8));    // send MSB
             useWire->write((uint8_t)data[i]);         // send LSB
         #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-            Fastwire::write((uint8_t)(data[i] >> 8));       // send MSB
-            status = Fastwire::write((uint8_t)data[i]);   // send LSB
-            if (status != 0) break;
+            bytes[2*i] = data[i] >> 8;                  // MSB
+            bytes[2*i + 1] = data[i];                   // LSB
         #endif
     }
     #if ((I2CDEV_IMPLEMENTATION == I2CDEV_ARDUINO_WIRE && ARDUINO < 100) || I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE)
@@ -690,8 +886,10 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
             || I2CDEV_IMPLEMENTATION == I2CDEV_TEENSY_3X_WIRE)
         status = useWire->endTransmission();
     #elif (I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_FASTWIRE)
-        Fastwire::stop();
-        //status = Fastwire::endTransmission();
+        status = Fastwire::writeBuf(devAddr << 1, regAddr, bytes, length * 2);
+        #ifndef I2CDEV_FASTWIRE_QUEUE
+            Fastwire::stop();
+        #endif
     #endif
     #ifdef I2CDEV_SERIAL_DEBUG
         Serial.println(". Done.");
@@ -699,6 +897,110 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
     return status == 0;
 }
 
+/** Read the masked bits of an 8-bit device register.
+ * Counterpart to writeMasked() for callers that already hold the mask (e.g.
+ * I2CdevField, where it is a compile-time constant). The shift is taken from
+ * the mask here rather than passed in, which keeps every call site down to
+ * immediates and fewer arguments than readBits().
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to read from
+ * @param mask Bits to extract (contiguous)
+ * @param data Container for right-aligned value (untouched on failure)
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Status of read operation (1 = success, 0 or -1 = failure)
+ */
+int8_t I2Cdev::readMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t *data, uint16_t timeout, void *wireObj) {
+    uint8_t b;
+    int8_t count = readByte(devAddr, regAddr, &b, timeout, wireObj);
+    if (count > 0) {
+        b &= mask;
+        for (; mask && !(mask & 0x01); mask >>= 1) b >>= 1;
+        *data = b;
+    }
+    return count;
+}
+
+/** Replace the masked bits of an 8-bit device register.
+ * Read-modify-write for callers that already hold the mask (e.g.
+ * I2CdevField, where it is a compile-time constant). The value is moved into
+ * position here, so callers pass it right-aligned and do no shifting of
+ * their own. A single-bit mask keeps writeBit() semantics (any non-zero
+ * value sets the bit); a full 0xFF mask skips the read.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register regAddr to write to
+ * @param mask Bits to replace (contiguous)
+ * @param value Right-aligned new value
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t value, void *wireObj) {
+    uint8_t bits = value ? mask : 0;
+    if (mask & (mask - 1)) {
+        for (uint8_t m = mask; !(m & 0x01); m >>= 1) value <<= 1;
+        bits = value & mask;
+    }
+    uint8_t b = 0;
+    if (mask != 0xFF && readByte(devAddr, regAddr, &b, readTimeout, wireObj) <= 0) return false;
+    return writeByte(devAddr, regAddr, (b & ~mask) | bits, wireObj);
+}
+
+/** Read a set of register blocks into one snapshot buffer.
+ * Each block is read with auto-increment bursts, split only where the bus
+ * buffer is smaller than the block (each piece is re-addressed at its own
+ * offset). Data for all blocks is packed back to back in block order.
+ * @param devAddr I2C slave device address
+ * @param blocks Array of register blocks describing the register map
+ * @param count Number of blocks in the array
+ * @param data Snapshot buffer, at least getRegisterMapSize() bytes long
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::readRegisterMap(uint8_t devAddr, const I2CdevRegisterBlock *blocks, uint8_t count, uint8_t *data, uint16_t timeout, void *wireObj) {
+    for (uint8_t i = 0; i < count; i++) {
+        for (uint8_t k = 0; k < blocks[i].length;) {
+            uint8_t chunk = blocks[i].length - k;
+            if (chunk > I2CDEVLIB_WIRE_BUFFER_LENGTH) chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH;
+            if (readBytes(devAddr, blocks[i].regAddr + k, chunk, data, timeout, wireObj) != (int8_t)chunk) return false;
+            data += chunk;
+            k += chunk;
+        }
+    }
+    return true;
+}
+
+/** Write a snapshot buffer back to a set of register blocks.
+ * Blocks are written in array order, so a register map can put power and
+ * clock registers first and enable bits last. Bursts are split only where
+ * the bus buffer (less the register address byte) is smaller than the block.
+ * @param devAddr I2C slave device address
+ * @param blocks Array of register blocks describing the register map
+ * @param count Number of blocks in the array
+ * @param data Snapshot buffer previously filled by readRegisterMap()
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeRegisterMap(uint8_t devAddr, const I2CdevRegisterBlock *blocks, uint8_t count, const uint8_t *data, void *wireObj) {
+    for (uint8_t i = 0; i < count; i++) {
+        for (uint8_t k = 0; k < blocks[i].length;) {
+            uint8_t chunk = blocks[i].length - k;
+            if (chunk > I2CDEVLIB_WIRE_BUFFER_LENGTH - 1) chunk = I2CDEVLIB_WIRE_BUFFER_LENGTH - 1;
+            if (!writeBytes(devAddr, blocks[i].regAddr + k, chunk, (uint8_t *)data, wireObj)) return false;
+            data += chunk;
+            k += chunk;
+        }
+    }
+    return true;
+}
+
+/** Get the number of bytes needed to hold a register map snapshot.
+ * @param blocks Array of register blocks describing the register map
+ * @param count Number of blocks in the array
+ * @return Snapshot size in bytes
+ */
+uint16_t I2Cdev::getRegisterMapSize(const I2CdevRegisterBlock *blocks, uint8_t count) {
+    uint16_t size = 0;
+    for (uint8_t i = 0; i < count; i++) size += blocks[i].length;
+    return size;
+}
+
 /** Default timeout value for read operations.
  * Set this to 0 to disable timeout detection.
  */
@@ -776,6 +1078,12 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
     }
 
     byte Fastwire::writeBuf(byte device, byte address, byte *data, byte num) {
+    #ifdef I2CDEV_FASTWIRE_QUEUE
+        // the queue owns TWI_vect, so blocking transfers wait their turn in it
+        // (STOP included, no separate stop() needed)
+        FastwireTransaction t = { (uint8_t)(device >> 1), address, false, false, num, data, 0, 0, 0 };
+        return FastwireQueue::transfer(&t) == num ? 0 : 1;
+    #else
         byte twst, retry;
 
         retry = 2;
@@ -814,6 +1122,7 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         //Serial.print("\n");
 
         return 0;
+    #endif
     }
 
     byte Fastwire::write(byte value) {
@@ -828,6 +1137,10 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
     }
 
     byte Fastwire::readBuf(byte device, byte address, byte *data, byte num) {
+    #ifdef I2CDEV_FASTWIRE_QUEUE
+        FastwireTransaction t = { (uint8_t)(device >> 1), address, true, false, num, data, 0, 0, 0 };
+        return FastwireQueue::transfer(&t) == num ? 0 : 16;
+    #else
         byte twst, retry;
 
         retry = 2;
@@ -888,6 +1201,49 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         stop();
 
         return 0;
+    #endif
+    }
+
+    // read without writing a register address first (command-style devices)
+    byte Fastwire::readBuf(byte device, byte *data, byte num) {
+    #ifdef I2CDEV_FASTWIRE_QUEUE
+        FastwireTransaction t = { (uint8_t)(device >> 1), 0, true, true, num, data, 0, 0, 0 };
+        return FastwireQueue::transfer(&t) == num ? 0 : 16;
+    #else
+        byte twst, retry;
+
+        if (num == 0) return 16;
+        retry = 2;
+        do {
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO) | (1 << TWSTA);
+            if (!waitInt()) return 22;
+            twst = TWSR & 0xF8;
+            if (twst != TW_START && twst != TW_REP_START) return 23;
+
+            TWDR = device | 0x01; // send device address with the read bit (1)
+            TWCR = (1 << TWINT) | (1 << TWEN);
+            if (!waitInt()) return 24;
+            twst = TWSR & 0xF8;
+        } while (twst == TW_MR_SLA_NACK && retry-- > 0);
+        if (twst != TW_MR_SLA_ACK) {
+            stop();
+            return 25;
+        }
+
+        for (uint8_t i = 0; i < num; i++) {
+            if (i == num - 1)
+                TWCR = (1 << TWINT) | (1 << TWEN);
+            else
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWEA);
+            if (!waitInt()) return 26;
+            twst = TWSR & 0xF8;
+            if (twst != TW_MR_DATA_ACK && twst != TW_MR_DATA_NACK) return twst;
+            data[i] = TWDR;
+        }
+        stop();
+
+        return 0;
+    #endif
     }
 
     void Fastwire::reset() {
@@ -899,6 +1255,231 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
         if (!waitInt()) return 1;
         return 0;
     }
+
+    #ifdef I2CDEV_FASTWIRE_QUEUE
+    // Interrupt-driven transaction queue. Every TWINT raises TWI_vect and
+    // service() moves the transaction at the head of the queue one bus step
+    // forward, so the CPU is free between bytes instead of spinning in
+    // waitInt(). When a transaction ends, the same interrupt issues STOP+START
+    // for the next one, so a queued chain (e.g. FIFO drain then magnetometer
+    // read) completes without the main loop touching the bus.
+
+    FastwireTransaction *FastwireQueue::queue[FASTWIRE_QUEUE_LENGTH];
+    volatile uint8_t FastwireQueue::head = 0;
+    volatile uint8_t FastwireQueue::count = 0;
+    uint16_t FastwireQueue::index = 0;
+
+    /** Queue a register read (register address write, repeated start, read).
+     * @param t Transaction storage, owned by the caller until completion
+     * @param device 7-bit I2C slave device address
+     * @param regAddr Register to read from
+     * @param length Number of bytes to read (at least 1)
+     * @param data Buffer to store read data in
+     * @param callback Optional completion callback, runs inside TWI_vect
+     * @param context Passed through to callback
+     * @return True if queued, false if the queue is full or length is 0
+     */
+    bool FastwireQueue::read(FastwireTransaction *t, uint8_t device, uint8_t regAddr, uint16_t length, uint8_t *data, FastwireCallback callback, void *context) {
+        t->device = device;
+        t->regAddr = regAddr;
+        t->read = true;
+        t->raw = false;
+        t->length = length;
+        t->data = data;
+        t->callback = callback;
+        t->context = context;
+        return submit(t);
+    }
+
+    /** Queue a register write (register address followed by length bytes).
+     * @see read()
+     */
+    bool FastwireQueue::write(FastwireTransaction *t, uint8_t device, uint8_t regAddr, uint16_t length, uint8_t *data, FastwireCallback callback, void *context) {
+        t->device = device;
+        t->regAddr = regAddr;
+        t->read = false;
+        t->raw = false;
+        t->length = length;
+        t->data = data;
+        t->callback = callback;
+        t->context = context;
+        return submit(t);
+    }
+
+    /** Queue a filled-in transaction, starting the bus if it is idle.
+     * Safe to call from a completion callback to chain further transfers.
+     * @return True if queued; otherwise result is set to -1 straight away
+     */
+    bool FastwireQueue::submit(FastwireTransaction *t) {
+        if (t->read && t->length == 0) {
+            t->result = -1;
+            return false;
+        }
+        uint8_t sreg = SREG;
+        cli();
+        if (count == FASTWIRE_QUEUE_LENGTH) {
+            SREG = sreg;
+            t->result = -1;
+            return false;
+        }
+        t->result = FASTWIRE_PENDING;
+        queue[(head + count) % FASTWIRE_QUEUE_LENGTH] = t;
+        count++;
+        // TWIE stays set for as long as service() owns the bus, including
+        // while a completion callback runs; it will start this one itself
+        if (!(TWCR & (1 << TWIE))) {
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWSTA);
+        }
+        SREG = sreg;
+        return true;
+    }
+
+    /** Queue a filled-in transaction and block until it completes.
+     * Used by the blocking Fastwire/I2Cdev calls. Where submit() fails at
+     * once on a full queue, this waits for a slot to free up first; the
+     * timeout covers both the wait for a slot and the transfer itself.
+     * Never call this (or any blocking I2Cdev function) from a completion
+     * callback: it would spin inside TWI_vect waiting for TWI_vect.
+     * @param t Transaction to run, with callback normally left 0
+     * @param timeout Timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+     * @return Number of data bytes transferred, or -1 on failure or timeout
+     */
+    int16_t FastwireQueue::transfer(FastwireTransaction *t, uint16_t timeout) {
+        uint32_t t1 = millis();
+        while (!submit(t)) {
+            if (t->read && t->length == 0) return -1;
+            if (timeout > 0 && millis() - t1 >= timeout) return -1;
+        }
+        if (timeout > 0) {
+            uint16_t elapsed = millis() - t1;
+            timeout = elapsed < timeout ? timeout - elapsed : 1;
+        }
+        return wait(t, timeout);
+    }
+
+    /** Check whether any transaction is queued or on the bus.
+     * @return True if the queue is not empty
+     */
+    bool FastwireQueue::busy() {
+        return count != 0;
+    }
+
+    /** Block until a queued transaction completes.
+     * On timeout the whole queue is abandoned with reset(), since a device
+     * stretching the clock forever would stall every later transaction too.
+     * @param t Transaction to wait for
+     * @param timeout Timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+     * @return Number of data bytes transferred, or -1 on failure or timeout
+     */
+    int16_t FastwireQueue::wait(FastwireTransaction *t, uint16_t timeout) {
+        uint32_t t1 = millis();
+        while (t->result == FASTWIRE_PENDING) {
+            if (timeout > 0 && millis() - t1 >= timeout) {
+                reset();
+                break;
+            }
+        }
+        return t->result;
+    }
+
+    /** Drop the transfer in progress and fail every queued transaction.
+     * Callbacks still run (with -1) so their owners can recover.
+     */
+    void FastwireQueue::reset() {
+        uint8_t sreg = SREG;
+        cli();
+        TWCR = 0; // release the bus
+        TWCR = 1 << TWEN;
+        for (uint8_t n = count; n > 0; n--) finish(-1);
+        SREG = sreg;
+    }
+
+    /** Remove the head transaction and report its result.
+     * The caller has already sent STOP (and START if count stays non-zero).
+     */
+    void FastwireQueue::finish(int16_t result) {
+        FastwireTransaction *t = queue[head];
+        head = (head + 1) % FASTWIRE_QUEUE_LENGTH;
+        count--;
+        index = 0;
+        t->result = result;
+        if (t->callback) t->callback(result, t->context);
+    }
+
+    /** Advance the current transaction by one TWI event.
+     * Called from TWI_vect; TWINT is set on entry.
+     */
+    void FastwireQueue::service() {
+        int16_t result;
+        if (count == 0) {
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+            return;
+        }
+        FastwireTransaction *t = queue[head];
+        switch (TWSR & 0xF8) {
+            case TW_START:
+                // raw reads go straight to SLA+R and continue at TW_MR_SLA_ACK
+                TWDR = (t->device << 1) | (t->raw ? 0x01 : 0x00);
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                return;
+            case TW_REP_START:
+                TWDR = (t->device << 1) | 0x01;
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                return;
+            case TW_MT_SLA_ACK:
+                TWDR = t->regAddr;
+                TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                return;
+            case TW_MT_DATA_ACK:
+                if (t->read) {
+                    // register address sent, turn the bus around
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWSTA);
+                    return;
+                }
+                if (index < t->length) {
+                    TWDR = t->data[index++];
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                    return;
+                }
+                result = index;
+                break;
+            case TW_MR_DATA_ACK:
+                t->data[index++] = TWDR;
+                // fall through
+            case TW_MR_SLA_ACK:
+                // ACK all but the last byte so the device lets go of SDA for STOP
+                if (index + 1 < t->length) {
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWEA);
+                } else {
+                    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE);
+                }
+                return;
+            case TW_MR_DATA_NACK:
+                t->data[index++] = TWDR;
+                result = index;
+                break;
+            default:
+                // address or data NACK, lost arbitration or bus error
+                result = -1;
+                break;
+        }
+
+        if (count > 1) {
+            // STOP, then START for the next transaction in the queue
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWIE) | (1 << TWSTO) | (1 << TWSTA);
+        } else {
+            TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWSTO);
+            // TWINT is not set after STOP; let it reach the bus before anything
+            // submitted from the callback below issues a new START
+            while (TWCR & (1 << TWSTO));
+        }
+        finish(result);
+    }
+
+    ISR(TWI_vect) {
+        FastwireQueue::service();
+    }
+    #endif
 #endif
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
@@ -3,6 +3,10 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - add readRaw()/writeRaw() for command-style devices without register addressing
+//      2026-10-19 - add interrupt-driven FastwireQueue transaction engine for AVR (I2CDEV_FASTWIRE_QUEUE)
+//      2026-10-19 - add readBytesLong()/writeBytesLong() for transfers of 256 to 32767 bytes
+//      2026-10-19 - add readMasked()/writeMasked() for precomputed-mask field access (see helper_field.h)
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -84,6 +88,14 @@ THE SOFTWARE.
 // -----------------------------------------------------------------------------
 //#define I2CDEV_SERIAL_DEBUG
 
+// -----------------------------------------------------------------------------
+// Interrupt-driven Fastwire transaction queue (uncomment to enable, AVR only)
+// Claims TWI_vect, so it cannot be linked together with the Wire library.
+// Blocking I2Cdev calls must not be made from a completion callback: they
+// wait for TWI_vect, which cannot run while the callback is inside it
+// -----------------------------------------------------------------------------
+//#define I2CDEV_FASTWIRE_QUEUE
+
 #ifdef ARDUINO
     #if ARDUINO < 100
         #include "WProgram.h"
@@ -129,6 +141,17 @@ THE SOFTWARE.
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     1000
 
+// longest readBytesLong()/writeBytesLong() transfer; the byte count comes
+// back as int16_t, so anything longer is rejected
+#define I2CDEV_LONG_MAX_LENGTH          32767
+
+// Contiguous run of registers that can be moved in one auto-increment burst;
+// an array of these describes a device's register map for snapshot/restore
+struct I2CdevRegisterBlock {
+    uint8_t regAddr;
+    uint8_t length;
+};
+
 class I2Cdev {
     public:
         I2Cdev();
@@ -141,6 +164,8 @@ class I2Cdev {
         static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
         static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
         static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
+        static int16_t readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
+        static int8_t readRaw(uint8_t devAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
 
         static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data, void *wireObj=0);
         static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data, void *wireObj=0);
@@ -150,6 +175,14 @@ class I2Cdev {
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data, void *wireObj=0);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void *wireObj=0);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, void *wireObj=0);
+        static bool writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, void *wireObj=0);
+        static bool writeRaw(uint8_t devAddr, uint8_t length, uint8_t *data, void *wireObj=0);
+        static int8_t readMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
+        static bool writeMasked(uint8_t devAddr, uint8_t regAddr, uint8_t mask, uint8_t value, void *wireObj=0);
+
+        static bool readRegisterMap(uint8_t devAddr, const I2CdevRegisterBlock *blocks, uint8_t count, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0);
+        static bool writeRegisterMap(uint8_t devAddr, const I2CdevRegisterBlock *blocks, uint8_t count, const uint8_t *data, void *wireObj=0);
+        static uint16_t getRegisterMapSize(const I2CdevRegisterBlock *blocks, uint8_t count);
 
         static uint16_t readTimeout;
 };
@@ -193,9 +226,62 @@ class I2Cdev {
             static byte write(byte value);
             static byte writeBuf(byte device, byte address, byte *data, byte num);
             static byte readBuf(byte device, byte address, byte *data, byte num);
+            static byte readBuf(byte device, byte *data, byte num);
             static void reset();
             static byte stop();
     };
+
+    #ifdef I2CDEV_FASTWIRE_QUEUE
+        // maximum number of transactions waiting for or using the bus
+        #ifndef FASTWIRE_QUEUE_LENGTH
+            #define FASTWIRE_QUEUE_LENGTH   4
+        #endif
+
+        // FastwireTransaction::result while queued or on the bus
+        #define FASTWIRE_PENDING            -2
+
+        // called from TWI_vect when a queued transaction ends; result is the
+        // number of data bytes transferred or -1 if the transfer failed. Only
+        // non-blocking FastwireQueue calls may be made from here
+        typedef void (*FastwireCallback)(int16_t result, void *context);
+
+        // One register access: the register address is written first, then
+        // either length bytes are written or, after a repeated start, length
+        // bytes are read (raw reads skip the address phase). Storage is owned
+        // by the caller and must stay valid (along with data) until result is
+        // no longer FASTWIRE_PENDING.
+        struct FastwireTransaction {
+            uint8_t device;             // 7-bit device address
+            uint8_t regAddr;
+            bool read;
+            bool raw;                   // read without the register address phase
+            uint16_t length;
+            uint8_t *data;
+            FastwireCallback callback;
+            void *context;
+            volatile int16_t result;
+        };
+
+        class FastwireQueue {
+            private:
+                static FastwireTransaction *queue[FASTWIRE_QUEUE_LENGTH];
+                static volatile uint8_t head;
+                static volatile uint8_t count;
+                static uint16_t index;
+
+                static void finish(int16_t result);
+
+            public:
+                static bool read(FastwireTransaction *t, uint8_t device, uint8_t regAddr, uint16_t length, uint8_t *data, FastwireCallback callback=0, void *context=0);
+                static bool write(FastwireTransaction *t, uint8_t device, uint8_t regAddr, uint16_t length, uint8_t *data, FastwireCallback callback=0, void *context=0);
+                static bool submit(FastwireTransaction *t);
+                static int16_t transfer(FastwireTransaction *t, uint16_t timeout=I2Cdev::readTimeout);
+                static bool busy();
+                static int16_t wait(FastwireTransaction *t, uint16_t timeout=I2Cdev::readTimeout);
+                static void reset();
+                static void service();
+        };
+    #endif
 #endif
 
 #if I2CDEV_IMPLEMENTATION == I2CDEV_BUILTIN_NBWIRE
@@ -0,0 +1,171 @@
+// I2Cdev library collection - compile-time register field descriptors
+// Bitfield read/modify/write with masks and shifts resolved by the compiler
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_FIELD_H_
+#define _HELPER_FIELD_H_
+
+#include "I2Cdev.h"
+
+/** Bitfield inside an 8-bit device register, described at compile time.
+ * Uses the same convention as I2Cdev::readBits()/writeBits(): BitStart is
+ * the most significant bit of the field and Length counts down from it, so
+ * the driver's existing _BIT and _LENGTH defines plug straight in:
+ *
+ * <pre>
+ * typedef I2CdevField<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT,
+ *     MPU6050_GCONFIG_FS_SEL_LENGTH> GyroRange;
+ * GyroRange::write(devAddr, MPU6050_GYRO_FS_2000);
+ * </pre>
+ *
+ * Each access is a single I2Cdev::readMasked()/writeMasked() call taking
+ * the device, the register and mask as immediates, and the right-aligned
+ * value; shifting happens once inside those functions instead of at every
+ * call site, so a setter is smaller than the writeBits() call it replaces
+ * and a getter smaller than readBits(). A field that does not fit in the
+ * register fails to compile. Single-bit fields (Length 1) keep writeBit()
+ * semantics: any non-zero value sets the bit. Whole-register fields
+ * (Length 8) are written without reading the register first.
+ */
+template <uint8_t Reg, uint8_t BitStart, uint8_t Length=1>
+struct I2CdevField {
+    static_assert(Length >= 1 && Length <= 8, "register field must be 1 to 8 bits long");
+    static_assert(BitStart < 8 && BitStart + 1 >= Length, "register field runs outside bits 7..0");
+
+    static const uint8_t reg = Reg;
+    static const uint8_t shift = BitStart - Length + 1;
+    static const uint8_t mask = (uint8_t)(((1 << Length) - 1) << shift);
+
+    /** Position a value within the register.
+     * @param value Right-aligned field value
+     * @return Value shifted into place and masked to the field
+     */
+    static constexpr uint8_t encode(uint8_t value) {
+        return Length == 1 ? (value ? mask : 0) : (uint8_t)((value << shift) & mask);
+    }
+
+    /** Extract the field from a raw register value (no bus access).
+     * @param raw Register value
+     * @return Right-aligned field value
+     */
+    static constexpr uint8_t decode(uint8_t raw) {
+        return (raw & mask) >> shift;
+    }
+
+    /** Read the field.
+     * @param devAddr I2C slave device address
+     * @param data Container for right-aligned field value (untouched on failure)
+     * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+     * @return Status of read operation (1 = success, 0 or -1 = failure)
+     */
+    static int8_t read(uint8_t devAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0) {
+        return I2Cdev::readMasked(devAddr, Reg, mask, data, timeout, wireObj);
+    }
+
+    /** Write the field, leaving the other bits of the register unchanged.
+     * @param devAddr I2C slave device address
+     * @param value Right-aligned field value
+     * @return Status of operation (true = success)
+     */
+    static bool write(uint8_t devAddr, uint8_t value, void *wireObj=0) {
+        return I2Cdev::writeMasked(devAddr, Reg, mask, value, wireObj);
+    }
+};
+
+/** Several fields of the same register updated with one read-modify-write.
+ * Fields must share a register and must not overlap, both checked at
+ * compile time. Values are passed in the order the fields are listed:
+ *
+ * <pre>
+ * typedef I2CdevFieldSet<ClockSource, Sleep> Power;
+ * Power::write(devAddr, Power::encode(MPU6050_CLOCK_PLL_XGYRO, false));
+ * </pre>
+ *
+ * replaces two separate read-modify-write sequences (four transactions)
+ * with one (two transactions).
+ */
+template <typename... Fields>
+struct I2CdevFieldSet;
+
+template <typename Field>
+struct I2CdevFieldSet<Field> {
+    static const uint8_t reg = Field::reg;
+    static const uint8_t shift = Field::shift;
+    static const uint8_t mask = Field::mask;
+
+    static constexpr uint8_t encode(uint8_t value) {
+        return Field::encode(value);
+    }
+
+    /** Read the register once; decode individual fields with Field::decode().
+     * @param devAddr I2C slave device address
+     * @param raw Container for the raw register value (untouched on failure)
+     * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+     * @return Status of read operation (1 = success, 0 or -1 = failure)
+     */
+    static int8_t read(uint8_t devAddr, uint8_t *raw, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0) {
+        return I2Cdev::readByte(devAddr, reg, raw, timeout, wireObj);
+    }
+
+    /** Write all fields of the set, leaving other bits unchanged.
+     * @param devAddr I2C slave device address
+     * @param bits Field values combined with encode()
+     * @return Status of operation (true = success)
+     */
+    static bool write(uint8_t devAddr, uint8_t bits, void *wireObj=0) {
+        return I2Cdev::writeMasked(devAddr, reg, mask, (bits & mask) >> shift, wireObj);
+    }
+};
+
+template <typename Field, typename Next, typename... Rest>
+struct I2CdevFieldSet<Field, Next, Rest...> {
+    typedef I2CdevFieldSet<Next, Rest...> Tail;
+    static_assert(Field::reg == Tail::reg, "fields in a set must share one register");
+    static_assert((Field::mask & Tail::mask) == 0, "fields in a set must not overlap");
+
+    static const uint8_t reg = Field::reg;
+    static const uint8_t shift = Field::shift < Tail::shift ? Field::shift : Tail::shift;
+    static const uint8_t mask = Field::mask | Tail::mask;
+
+    template <typename... Values>
+    static constexpr uint8_t encode(uint8_t value, Values... rest) {
+        return Field::encode(value) | Tail::encode(rest...);
+    }
+
+    static int8_t read(uint8_t devAddr, uint8_t *raw, uint16_t timeout=I2Cdev::readTimeout, void *wireObj=0) {
+        return I2Cdev::readByte(devAddr, reg, raw, timeout, wireObj);
+    }
+
+    static bool write(uint8_t devAddr, uint8_t bits, void *wireObj=0) {
+        return I2Cdev::writeMasked(devAddr, reg, mask, (bits & mask) >> shift, wireObj);
+    }
+};
+
+#endif /* _HELPER_FIELD_H_ */
@@ -0,0 +1,164 @@
+// I2Cdev library collection - magnetometer calibration helper
+// Hard/soft-iron correction, gain scaling and fast heading
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_MAGCAL_H_
+#define _HELPER_MAGCAL_H_
+
+#include <stdint.h>
+
+/** Magnetometer calibration applied as one precomputed affine transform.
+ * Corrected output is S * M * (raw - b), where b is the hard-iron offset in raw
+ * counts, M is the 3x3 soft-iron correction matrix (identity if uncalibrated)
+ * and S is the gain scale in output units per LSB (e.g. from
+ * HMC5883L::getScaleMilliGauss()). The three are folded into a single matrix
+ * and offset whenever one of them changes, so each sample costs nine
+ * multiplies and nine adds:
+ *
+ * <pre>
+ * MagCalibration cal;
+ * cal.setScale(mag.getScaleMilliGauss());
+ * cal.setHardIron(-42.0f, 17.5f, 8.0f);
+ * ...
+ * if (mag.getHeadingIfReady(&mx, &my, &mz)) {
+ *     cal.apply(mx, my, mz, &fx, &fy, &fz);
+ *     float heading = MagCalibration::fastHeading(fx, fy);
+ * }
+ * </pre>
+ */
+class MagCalibration {
+    public:
+        MagCalibration() {
+            for (uint8_t i = 0; i < 3; i++) {
+                hardIron[i] = 0.0f;
+                for (uint8_t j = 0; j < 3; j++) softIron[i][j] = i == j ? 1.0f : 0.0f;
+            }
+            scale = 1.0f;
+            update();
+        }
+
+        /** Set hard-iron offset, subtracted from the raw reading.
+         * @param x X-axis offset in raw counts
+         * @param y Y-axis offset in raw counts
+         * @param z Z-axis offset in raw counts
+         */
+        void setHardIron(float x, float y, float z) {
+            hardIron[0] = x;
+            hardIron[1] = y;
+            hardIron[2] = z;
+            update();
+        }
+
+        /** Set soft-iron correction matrix, applied after the hard-iron offset.
+         * @param m Row-major 3x3 matrix
+         */
+        void setSoftIron(const float m[3][3]) {
+            for (uint8_t i = 0; i < 3; i++) {
+                for (uint8_t j = 0; j < 3; j++) softIron[i][j] = m[i][j];
+            }
+            update();
+        }
+
+        /** Set gain scale from raw counts to output units.
+         * @param unitsPerLSB Output units per raw count
+         */
+        void setScale(float unitsPerLSB) {
+            scale = unitsPerLSB;
+            update();
+        }
+
+        /** Correct and scale one raw sample.
+         * @param x Raw X-axis value
+         * @param y Raw Y-axis value
+         * @param z Raw Z-axis value
+         * @param ox Container for corrected X-axis value
+         * @param oy Container for corrected Y-axis value
+         * @param oz Container for corrected Z-axis value
+         */
+        void apply(int16_t x, int16_t y, int16_t z, float *ox, float *oy, float *oz) {
+            *ox = m[0][0] * x + m[0][1] * y + m[0][2] * z - offset[0];
+            *oy = m[1][0] * x + m[1][1] * y + m[1][2] * z - offset[1];
+            *oz = m[2][0] * x + m[2][1] * y + m[2][2] * z - offset[2];
+        }
+
+        /** Correct and scale a block of raw samples.
+         * @param raw Interleaved raw X/Y/Z samples
+         * @param out Container for interleaved corrected X/Y/Z samples
+         * @param count Number of 3-axis samples
+         */
+        void apply(const int16_t *raw, float *out, uint16_t count) {
+            for (uint16_t i = 0; i < count; i++, raw += 3, out += 3) {
+                apply(raw[0], raw[1], raw[2], &out[0], &out[1], &out[2]);
+            }
+        }
+
+        /** Approximate compass heading from horizontal field components.
+         * Uses a rational arctangent approximation (max error about 0.1
+         * degree) instead of atan2(), which is several times slower on parts
+         * without an FPU.
+         * @param x Field component along the heading reference axis
+         * @param y Field component 90 degrees clockwise of x
+         * @return Heading in degrees, 0 to 360
+         */
+        static float fastHeading(float x, float y) {
+            float ax = x < 0.0f ? -x : x;
+            float ay = y < 0.0f ? -y : y;
+            if (ax == 0.0f && ay == 0.0f) return 0.0f;
+
+            // atan on [0, 1] in degrees, then unfold the octant
+            float r = ax > ay ? ay / ax : ax / ay;
+            float a = r * (45.0f - (r - 1.0f) * (14.02f + 3.80f * r));
+            if (ay > ax) a = 90.0f - a;
+            if (x < 0.0f) a = 180.0f - a;
+            if (y < 0.0f) a = 360.0f - a;
+            return a >= 360.0f ? a - 360.0f : a;
+        }
+
+    private:
+        float hardIron[3];
+        float softIron[3][3];
+        float scale;
+
+        // folded transform: out = m * raw - offset
+        float m[3][3];
+        float offset[3];
+
+        void update() {
+            for (uint8_t i = 0; i < 3; i++) {
+                offset[i] = 0.0f;
+                for (uint8_t j = 0; j < 3; j++) {
+                    m[i][j] = scale * softIron[i][j];
+                    offset[i] += m[i][j] * hardIron[j];
+                }
+            }
+        }
+};
+
+#endif /* _HELPER_MAGCAL_H_ */
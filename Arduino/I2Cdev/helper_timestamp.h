@@ -0,0 +1,211 @@
+// I2Cdev library collection - FIFO sample timestamp reconstruction helper
+// Assigns host timestamps to samples drained from a sensor FIFO
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_TIMESTAMP_H_
+#define _HELPER_TIMESTAMP_H_
+
+#include <stdint.h>
+
+// smallest loop gain used once the clock has settled; lower is smoother but
+// slower to follow oscillator drift
+#define SAMPLECLOCK_MIN_GAIN        0.02f
+
+// the sensor oscillator is never trusted to be off by more than this fraction
+#define SAMPLECLOCK_MAX_DRIFT       0.10f
+
+// number of updates before the period estimate is considered locked
+#define SAMPLECLOCK_LOCK_UPDATES    16
+
+/** Per-sample timestamp reconstruction for FIFO-buffered sensors.
+ * Samples drained from a FIFO (MPU6050, L3G4200D, ADXL345, LSM303DLHC...) carry
+ * no time of their own; the host only knows when the burst was read. Feed this
+ * class the host time (e.g. micros()) at which the FIFO depth was sampled and
+ * the depth itself in samples, and it tracks both the phase of the sensor's
+ * sample clock and its real period (the on-chip oscillator is typically a few
+ * percent off nominal) with an alpha-beta filter whose gains settle to the
+ * Benedict-Bordner relation.
+ *
+ * Typical use with an MPU6050 streaming 12-byte accel+gyro packets:
+ *
+ * <pre>
+ * SampleClock clock(mpu.getSampleRate());
+ * ...
+ * uint32_t now = micros();
+ * uint16_t depth = mpu.getFIFOCount() / 12;
+ * clock.update(now, depth);
+ * for (uint16_t i = 0; i < depth; i++) {
+ *     mpu.getFIFOBytes(packet, 12);
+ *     uint32_t t = clock.getSampleTime(0);
+ *     clock.consume(1);
+ *     ...
+ * }
+ * </pre>
+ *
+ * Rates for other drivers come from L3G4200D::getOutputDataRate(),
+ * LSM303DLHC::getAccelOutputDataRate() or, for the ADXL345, 3200.0f /
+ * (1 << (15 - getRate())). Timestamps are 32-bit microseconds and wrap
+ * exactly as micros() does.
+ */
+class SampleClock {
+    public:
+        SampleClock(float rate=0.0f) {
+            latency = 0;
+            setSampleRate(rate);
+        }
+
+        /** Set nominal sample rate and restart tracking.
+         * @param rate Configured output data rate in Hz
+         */
+        void setSampleRate(float rate) {
+            nominalPeriod = rate > 0.0f ? 1000000.0f / rate : 0.0f;
+            reset();
+        }
+
+        /** Set fixed delay between the timestamp passed to update() and the
+         * moment the FIFO depth was actually latched by the sensor.
+         * @param us Latency in microseconds (may be negative)
+         */
+        void setLatency(int32_t us) {
+            latency = us;
+        }
+
+        /** Discard all timing state (call after a FIFO reset or overflow). */
+        void reset() {
+            period = nominalPeriod;
+            newestBase = 0;
+            newestFrac = 0.0f;
+            queued = 0;
+            updates = 0;
+        }
+
+        /** Fold a new FIFO depth observation into the clock model.
+         * @param hostTime Host monotonic time in microseconds when depth was read
+         * @param depth Number of complete samples currently stored in the FIFO
+         * @return Number of samples that arrived since the previous update
+         */
+        uint16_t update(uint32_t hostTime, uint16_t depth) {
+            uint32_t t = hostTime - latency;
+            if (updates == 0 || depth < queued) {
+                // first observation, or the FIFO lost samples: resync phase
+                // to the middle of the possible window and keep the period
+                newestBase = t;
+                newestFrac = -0.5f * period;
+                queued = depth;
+                updates = 1;
+                return depth;
+            }
+
+            uint16_t arrived = depth - queued;
+            float now = (float)(int32_t)(t - newestBase);
+            if (arrived > 0) {
+                // the newest sample was taken somewhere in (t - period, t],
+                // so compare the prediction against the middle of that window
+                float predicted = newestFrac + arrived * period;
+                float residual = (now - 0.5f * period) - predicted;
+
+                // growing-memory gains give a least-squares line fit while
+                // settling, then hold at a floor so drift can be followed;
+                // the first residual is the second point of the fit (k = 2)
+                float k = updates + 1;
+                float alpha = 2.0f * (2.0f * k - 1.0f) / (k * (k + 1.0f));
+                float beta = 6.0f / (k * (k + 1.0f));
+                if (alpha < SAMPLECLOCK_MIN_GAIN) {
+                    alpha = SAMPLECLOCK_MIN_GAIN;
+                    beta = alpha * alpha / (2.0f - alpha);
+                }
+
+                newestFrac = predicted + alpha * residual;
+                period += beta * residual / arrived;
+                if (period > nominalPeriod * (1.0f + SAMPLECLOCK_MAX_DRIFT)) period = nominalPeriod * (1.0f + SAMPLECLOCK_MAX_DRIFT);
+                else if (period < nominalPeriod * (1.0f - SAMPLECLOCK_MAX_DRIFT)) period = nominalPeriod * (1.0f - SAMPLECLOCK_MAX_DRIFT);
+                if (updates < 0xFFFF) updates++;
+            }
+
+            // a sample can never be newer than the read that found it
+            if (newestFrac > now) newestFrac = now;
+
+            // keep the fractional part small so float precision holds
+            int32_t whole = (int32_t)newestFrac;
+            newestBase += whole;
+            newestFrac -= whole;
+            queued = depth;
+            return arrived;
+        }
+
+        /** Get timestamp of a sample still held in the FIFO.
+         * @param index Sample position, 0 being the oldest (next to be read)
+         * @return Estimated host time in microseconds when the sample was taken
+         */
+        uint32_t getSampleTime(uint16_t index) {
+            float offset = newestFrac - (float)((int32_t)queued - 1 - index) * period;
+            return newestBase + (int32_t)(offset < 0.0f ? offset - 0.5f : offset + 0.5f);
+        }
+
+        /** Mark samples as read out of the FIFO.
+         * @param count Number of samples drained since the last update/consume
+         */
+        void consume(uint16_t count) {
+            queued = count < queued ? queued - count : 0;
+        }
+
+        /** Get current estimate of the true sample period.
+         * @return Sample period in microseconds
+         */
+        float getSamplePeriod() {
+            return period;
+        }
+
+        /** Get ratio of true to nominal sensor clock rate.
+         * @return Clock drift in parts per million (positive = sensor is fast)
+         */
+        float getDriftPPM() {
+            if (period <= 0.0f) return 0.0f;
+            return (nominalPeriod / period - 1.0f) * 1000000.0f;
+        }
+
+        /** Check whether enough observations have been seen to trust timestamps.
+         * @return True once the period estimate has settled
+         */
+        bool isLocked() {
+            return updates >= SAMPLECLOCK_LOCK_UPDATES;
+        }
+
+    private:
+        float nominalPeriod;
+        float period;
+        int32_t latency;
+        uint32_t newestBase;
+        float newestFrac;
+        uint16_t queued;
+        uint16_t updates;
+};
+
+#endif /* _HELPER_TIMESTAMP_H_ */
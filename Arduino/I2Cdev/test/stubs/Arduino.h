@@ -0,0 +1,45 @@
+// Host stand-in for the Arduino core and the AVR TWI registers used by the
+// Fastwire backend of I2Cdev.cpp; the registers are modelled in
+// ../twi_sim.cpp.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HEX 16
+#define DEC 10
+#define F_CPU 16000000UL
+#define BUFFER_LENGTH 32
+
+unsigned long millis();
+void delay(unsigned long ms);
+
+template<class A, class B> auto min(A a, B b) -> decltype(a < b ? a : b) { return a < b ? a : b; }
+
+struct HostSerial {
+    template<class T> void print(T, int = 0) {}
+    template<class T> void println(T, int = 0) {}
+    void println() {}
+};
+extern HostSerial Serial;
+
+// TWCR is a proxy so that writes reach the bus model
+enum { TWIE = 0, TWEN = 2, TWWC = 3, TWSTO = 4, TWSTA = 5, TWEA = 6, TWINT = 7 };
+struct TwcrReg {
+    operator uint8_t() const;
+    TwcrReg &operator=(uint8_t v);
+};
+extern TwcrReg TWCR;
+extern uint8_t TWSR, TWDR, TWBR, PORTC, PORTD, SREG;
+
+inline void cli() { SREG &= 0x7F; }
+inline void sei() { SREG |= 0x80; }
+
+#define ISR(vector) void vector(void)
+#define TWI_vect sim_twi_vect
+void sim_twi_vect(void);
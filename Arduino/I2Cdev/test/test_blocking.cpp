@@ -0,0 +1,60 @@
+// I2Cdev library collection - Arduino host test
+// Blocking Fastwire backend on the simulated TWI: register and word access,
+// raw transfers and the bounded writeWords() buffer. Built both with and
+// without I2CDEV_FASTWIRE_QUEUE.
+
+#include <assert.h>
+#include <stdio.h>
+#include "I2Cdev.h"
+#include "twi_sim.h"
+
+static void setupDevices() {
+    simReset();
+    simPresent[0x68] = simPresent[0x40] = true;
+    for (int i = 0; i < 256; i++) simRegs[0x68][i] = simRegs[0x40][i] = i;
+    Fastwire::setup(400, 0);
+}
+
+static void testRegisters() {
+    uint8_t v;
+    uint16_t words[2] = { 0x1234, 0xABCD }, readBack[2];
+    setupDevices();
+    assert(I2Cdev::writeByte(0x68, 0x20, 0x5A));
+    assert(I2Cdev::readByte(0x68, 0x20, &v) == 1 && v == 0x5A);
+    assert(I2Cdev::writeWords(0x68, 0x30, 2, words));
+    assert(I2Cdev::readWords(0x68, 0x30, 2, readBack) == 2 && readBack[1] == 0xABCD);
+    assert(!I2Cdev::writeByte(0x33, 0x20, 1));
+    assert(I2Cdev::readByte(0x33, 0x20, &v) == -1);
+}
+
+static void testRaw() {
+    uint8_t cmd = 0xF3, r[3];
+    setupDevices();
+    assert(I2Cdev::writeRaw(0x40, 1, &cmd));
+    assert(I2Cdev::readRaw(0x40, 3, r) == 3);
+    assert(r[0] == 0xF3 && r[2] == 0xF5);
+    // no address phase on the wire, the first byte is the command
+    assert(simLog == "S >40 f3 P S <40 P");
+    assert(I2Cdev::readRaw(0x41, 3, r) == -1);
+    assert(!I2Cdev::writeRaw(0x40, 0, &cmd));
+    assert(I2Cdev::readRaw(0x40, 3, r) == 3 && r[0] == 0xF6);
+}
+
+static void testWordBuffer() {
+    uint16_t w[130], r[16];
+    setupDevices();
+    for (int i = 0; i < 130; i++) w[i] = 0x1100 * (i & 15) + i;
+    assert(I2Cdev::writeWords(0x68, 0x40, I2CDEVLIB_WIRE_BUFFER_LENGTH / 2, w));
+    assert(I2Cdev::readWords(0x68, 0x40, 16, r) == 16);
+    for (int i = 0; i < 16; i++) assert(r[i] == w[i]);
+    assert(!I2Cdev::writeWords(0x68, 0x40, I2CDEVLIB_WIRE_BUFFER_LENGTH / 2 + 1, w));
+    assert(!I2Cdev::writeWords(0x68, 0x40, 128, w));
+}
+
+int main() {
+    testRegisters();
+    testRaw();
+    testWordBuffer();
+    puts("Fastwire: all tests passed");
+    return 0;
+}
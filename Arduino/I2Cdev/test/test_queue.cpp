@@ -0,0 +1,153 @@
+// I2Cdev library collection - Arduino host test
+// FastwireQueue on the simulated TWI: background transfers, completion
+// callbacks, queue limits, timeouts, and the blocking I2Cdev calls routed
+// through the queue (built with I2CDEV_FASTWIRE_QUEUE).
+
+#include <assert.h>
+#include <stdio.h>
+#include "I2Cdev.h"
+#include "twi_sim.h"
+
+static int callbackCalls;
+static int16_t callbackResults[8];
+static FastwireTransaction chained;
+static uint8_t chainedData[6];
+
+static void onDone(int16_t result, void *) {
+    callbackResults[callbackCalls++] = result;
+}
+
+static void onDoneChain(int16_t result, void *) {
+    callbackResults[callbackCalls++] = result;
+    FastwireQueue::read(&chained, 0x0C, 0x03, 6, chainedData, onDone);
+}
+
+static void drain() {
+    while (FastwireQueue::busy()) simStep();
+}
+
+static void setupDevices() {
+    simReset();
+    simPresent[0x68] = simPresent[0x0C] = true;
+    for (int i = 0; i < 256; i++) {
+        simRegs[0x68][i] = i;
+        simRegs[0x0C][i] = 0xA0 + (i & 15);
+    }
+    Fastwire::setup(400, 0);
+    callbackCalls = 0;
+}
+
+static void testBackground() {
+    uint8_t fifo[40], mag[6];
+    FastwireTransaction a, b;
+    setupDevices();
+    assert(FastwireQueue::read(&a, 0x68, 0x10, 40, fifo, onDone));
+    assert(FastwireQueue::read(&b, 0x0C, 0x03, 6, mag, onDone));
+    // the caller keeps running while the interrupt moves the bytes
+    long work = 0;
+    while (FastwireQueue::busy()) {
+        work++;
+        simStep();
+    }
+    assert(a.result == 40 && b.result == 6 && callbackCalls == 2 && work > 40);
+    for (int i = 0; i < 40; i++) assert(fifo[i] == 0x10 + i);
+    for (int i = 0; i < 6; i++) assert(mag[i] == 0xA3 + i);
+    assert(simLog.compare(0, 18, "S >68 10 Sr <68 P ") == 0);
+}
+
+static void testNackInQueue() {
+    uint8_t w[3] = { 1, 2, 3 }, r[3] = { 0 };
+    FastwireTransaction c, d, e;
+    setupDevices();
+    FastwireQueue::write(&c, 0x68, 0x40, 3, w);
+    FastwireQueue::read(&d, 0x55, 0x00, 2, r);
+    FastwireQueue::read(&e, 0x68, 0x40, 3, r);
+    assert(FastwireQueue::wait(&e) == 3);
+    assert(c.result == 3 && d.result == -1 && r[0] == 1 && r[2] == 3);
+    assert(simLog == "S >68 40 01 02 03 P S >55 P S >68 40 Sr <68 P");
+}
+
+static void testLimits() {
+    FastwireTransaction q[FASTWIRE_QUEUE_LENGTH + 1];
+    uint8_t junk[4];
+    setupDevices();
+    for (int i = 0; i < FASTWIRE_QUEUE_LENGTH; i++) assert(FastwireQueue::read(&q[i], 0x68, 0, 4, junk));
+    assert(!FastwireQueue::read(&q[FASTWIRE_QUEUE_LENGTH], 0x68, 0, 4, junk));
+    assert(q[FASTWIRE_QUEUE_LENGTH].result == -1);
+    assert(FastwireQueue::wait(&q[FASTWIRE_QUEUE_LENGTH - 1]) == 4);
+    assert(!FastwireQueue::read(&q[0], 0x68, 0, 0, junk));
+}
+
+static void testChainFromCallback() {
+    FastwireTransaction f;
+    uint8_t one;
+    setupDevices();
+    FastwireQueue::read(&f, 0x68, 0x00, 1, &one, onDoneChain);
+    drain();
+    assert(callbackCalls == 2 && callbackResults[1] == 6 && chainedData[0] == 0xA3);
+}
+
+static void testBlockingCalls() {
+    uint8_t v;
+    uint16_t words[2] = { 0x1234, 0xABCD }, readBack[2];
+    setupDevices();
+    assert(I2Cdev::writeByte(0x68, 0x20, 0x5A));
+    assert(I2Cdev::readByte(0x68, 0x20, &v) == 1 && v == 0x5A);
+    assert(I2Cdev::writeWords(0x68, 0x30, 2, words));
+    assert(I2Cdev::readWords(0x68, 0x30, 2, readBack) == 2);
+    assert(readBack[0] == 0x1234 && readBack[1] == 0xABCD);
+    assert(I2Cdev::writeBits(0x68, 0x20, 3, 2, 1));
+    assert(I2Cdev::readByte(0x68, 0x20, &v) == 1 && v == 0x56);
+    assert(I2Cdev::readByte(0x33, 0x20, &v) == -1);
+}
+
+static void testBlockingWaitsForSlot() {
+    FastwireTransaction q[FASTWIRE_QUEUE_LENGTH];
+    uint8_t junk[FASTWIRE_QUEUE_LENGTH][16], v = 0, raw[2];
+    setupDevices();
+    for (int i = 0; i < FASTWIRE_QUEUE_LENGTH; i++) assert(FastwireQueue::read(&q[i], 0x68, 0x10, 16, junk[i]));
+    assert(I2Cdev::readByte(0x68, 0x42, &v) == 1 && v == 0x42);
+    for (int i = 0; i < FASTWIRE_QUEUE_LENGTH; i++) assert(q[i].result == 16);
+
+    for (int i = 0; i < FASTWIRE_QUEUE_LENGTH; i++) assert(FastwireQueue::read(&q[i], 0x68, 0x10, 16, junk[i]));
+    assert(I2Cdev::writeByte(0x68, 0x20, 0x77) && simRegs[0x68][0x20] == 0x77);
+
+    for (int i = 0; i < FASTWIRE_QUEUE_LENGTH; i++) assert(FastwireQueue::read(&q[i], 0x68, 0x10, 16, junk[i]));
+    assert(I2Cdev::readRaw(0x68, 2, raw) == 2);
+    drain();
+}
+
+static void testStalledBus() {
+    FastwireTransaction q[FASTWIRE_QUEUE_LENGTH], g, h;
+    uint8_t junk[FASTWIRE_QUEUE_LENGTH][16], v;
+    setupDevices();
+
+    // a timeout resets the queue and fails everything still in it
+    simStall = true;
+    FastwireQueue::read(&g, 0x68, 0, 2, junk[0]);
+    FastwireQueue::read(&h, 0x68, 0, 2, junk[1], onDone);
+    assert(FastwireQueue::wait(&g, 5) == -1);
+    assert(h.result == -1 && callbackCalls == 1 && !FastwireQueue::busy());
+    simStall = false;
+    assert(I2Cdev::readByte(0x68, 0x20, &v) == 1 && v == 0x20);
+
+    // a blocking call waiting for a slot is bounded by its timeout too
+    simStall = true;
+    for (int i = 0; i < FASTWIRE_QUEUE_LENGTH; i++) assert(FastwireQueue::read(&q[i], 0x68, 0x10, 16, junk[i]));
+    assert(I2Cdev::readByte(0x68, 0x42, &v, 5) == -1);
+    simStall = false;
+    while (FastwireQueue::busy()) FastwireQueue::wait(&q[FASTWIRE_QUEUE_LENGTH - 1], 5);
+    assert(I2Cdev::readByte(0x68, 0x42, &v) == 1 && v == 0x42);
+}
+
+int main() {
+    testBackground();
+    testNackInQueue();
+    testLimits();
+    testChainFromCallback();
+    testBlockingCalls();
+    testBlockingWaitsForSlot();
+    testStalledBus();
+    puts("FastwireQueue: all tests passed");
+    return 0;
+}
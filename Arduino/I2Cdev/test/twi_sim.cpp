@@ -0,0 +1,116 @@
+// I2Cdev library collection - Arduino host test support
+// See twi_sim.h. TWCR writes advance the bus by one step, as the hardware
+// does when TWINT is cleared; millis() also delivers pending interrupts so
+// that blocking waits make progress.
+
+#include <stdio.h>
+#include "Arduino.h"
+#include "twi_sim.h"
+
+HostSerial Serial;
+TwcrReg TWCR;
+uint8_t TWSR = 0xF8, TWDR, TWBR, PORTC, PORTD, SREG = 0x80;
+
+uint8_t simRegs[128][256];
+bool simPresent[128];
+bool simStall = false;
+int simIsrCalls = 0;
+std::string simLog;
+
+static uint8_t control;         // TWCR without TWINT
+static bool twint;
+static bool owned, addressNext, receiving, inIsr;
+static int device = -1;
+static int pointer = -1;
+static unsigned long ticks;
+
+// builds without the interrupt-driven queue have no TWI_vect
+__attribute__((weak)) void sim_twi_vect(void) {}
+
+static void logBus(const char *fmt, int value) {
+    char s[8];
+    snprintf(s, sizeof(s), fmt, value);
+    simLog += s;
+}
+
+TwcrReg::operator uint8_t() const {
+    return control | (twint ? 0x80 : 0);
+}
+
+TwcrReg &TwcrReg::operator=(uint8_t v) {
+    control = v & 0x7F;
+    if (!(v & (1 << TWEN))) {
+        owned = twint = false;
+        return *this;
+    }
+    if (!(v & (1 << TWINT))) return *this;
+    twint = false;
+    if (v & (1 << TWSTO)) {
+        if (owned) logBus(" P", 0);
+        owned = false;
+        control &= ~(1 << TWSTO);
+        device = -1;
+    }
+    if (v & (1 << TWSTA)) {
+        logBus(owned ? " Sr" : (simLog.empty() ? "S" : " S"), 0);
+        TWSR = owned ? 0x10 : 0x08;
+        owned = addressNext = true;
+        control &= ~(1 << TWSTA);
+    } else if (v & (1 << TWSTO)) {
+        return *this;
+    } else if (!owned) {
+        TWSR = 0x00;
+    } else if (addressNext) {
+        addressNext = false;
+        int address = TWDR >> 1;
+        receiving = TWDR & 1;
+        logBus(receiving ? " <%02x" : " >%02x", address);
+        if (simPresent[address]) {
+            device = address;
+            TWSR = receiving ? 0x40 : 0x18;
+            if (!receiving) pointer = -1;
+        } else {
+            TWSR = receiving ? 0x48 : 0x20;
+        }
+    } else if (!receiving) {
+        if (pointer < 0) pointer = TWDR;
+        else simRegs[device][pointer++ & 0xFF] = TWDR;
+        logBus(" %02x", TWDR);
+        TWSR = 0x28;
+    } else {
+        TWDR = simRegs[device][pointer++ & 0xFF];
+        TWSR = (v & (1 << TWEA)) ? 0x50 : 0x58;
+    }
+    if (!simStall) twint = true;
+    return *this;
+}
+
+bool simStep() {
+    if (inIsr || !twint || !(control & (1 << TWIE)) || !(SREG & 0x80)) return false;
+    inIsr = true;
+    uint8_t sreg = SREG;
+    SREG &= 0x7F;
+    simIsrCalls++;
+    sim_twi_vect();
+    SREG = sreg;
+    inIsr = false;
+    return true;
+}
+
+void simReset() {
+    memset(simRegs, 0, sizeof(simRegs));
+    memset(simPresent, 0, sizeof(simPresent));
+    simStall = false;
+    simIsrCalls = 0;
+    simLog.clear();
+}
+
+// four calls per simulated millisecond
+unsigned long millis() {
+    simStep();
+    return ticks++ / 4;
+}
+
+void delay(unsigned long ms) {
+    ticks += ms * 4;
+}
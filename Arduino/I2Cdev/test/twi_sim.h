@@ -0,0 +1,23 @@
+// I2Cdev library collection - Arduino host test support
+// Model of the AVR TWI peripheral with up to 128 register-file slaves. Bus
+// traffic is logged as e.g. "S >68 3b Sr <68 P".
+
+#ifndef _TWI_SIM_H_
+#define _TWI_SIM_H_
+
+#include <stdint.h>
+#include <string>
+
+extern uint8_t simRegs[128][256];   // register file per device
+extern bool simPresent[128];        // device ACKs its address
+extern bool simStall;               // hold the bus: TWINT never rises
+extern int simIsrCalls;
+extern std::string simLog;
+
+/** Deliver a pending TWI interrupt; returns true if TWI_vect ran. */
+bool simStep();
+
+/** Forget all devices and bus history. */
+void simReset();
+
+#endif /* _TWI_SIM_H_ */
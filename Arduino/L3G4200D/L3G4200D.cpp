@@ -31,12 +31,14 @@ THE SOFTWARE.
 */
 
 #include "L3G4200D.h"
+#include "helper_field.h"
 
 /** Default constructor, uses default I2C address.
  * @see L3G4200D_DEFAULT_ADDRESS
  */
 L3G4200D::L3G4200D() {
     devAddr = L3G4200D_DEFAULT_ADDRESS;
+    endianMode = L3G4200D_LITTLE_ENDIAN;
 }
 
 /** Specific address constructor.
@@ -46,6 +48,7 @@ L3G4200D::L3G4200D() {
  */
 L3G4200D::L3G4200D(uint8_t address) {
     devAddr = address;
+    endianMode = L3G4200D_LITTLE_ENDIAN;
 }
 
 /** Power on and prepare for general usage.
@@ -62,6 +65,7 @@ void L3G4200D::initialize() {
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG3, 0b00000000);
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG4, 0b00000000);
     I2Cdev::writeByte(devAddr, L3G4200D_RA_CTRL_REG5, 0b00000000);
+    endianMode = L3G4200D_LITTLE_ENDIAN;
 }
 
 /** Verify the I2C connection.
@@ -109,8 +113,7 @@ void L3G4200D::setOutputDataRate(uint16_t rate) {
 		writeVal = L3G4200D_RATE_800;
 	}
 	
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT,
-		L3G4200D_ODR_LENGTH, writeVal); 
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT, L3G4200D_ODR_LENGTH>::write(devAddr, writeVal); 
 }
 
 /** Get the current output data rate
@@ -124,8 +127,7 @@ void L3G4200D::setOutputDataRate(uint16_t rate) {
  * @see L3G4200D_RATE_800
  */
 uint16_t L3G4200D::getOutputDataRate() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT, 
-		L3G4200D_ODR_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_ODR_BIT, L3G4200D_ODR_LENGTH>::read(devAddr, buffer);
 	uint8_t rate = buffer[0];
 
 	if (rate == L3G4200D_RATE_100) {
@@ -149,8 +151,7 @@ uint16_t L3G4200D::getOutputDataRate() {
  * @see L3G4200D_BW_HIGH
  */
 void L3G4200D::setBandwidthCutOffMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, 
-		L3G4200D_BW_LENGTH, mode);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, L3G4200D_BW_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the current bandwidth cut-off mode
@@ -164,8 +165,7 @@ void L3G4200D::setBandwidthCutOffMode(uint8_t mode) {
  * @see L3G4200D_BW_HIGH
  */
 uint8_t L3G4200D::getBandwidthCutOffMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, 
-		L3G4200D_BW_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_BW_BIT, L3G4200D_BW_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -234,7 +234,7 @@ float L3G4200D::getBandwidthCutOff() {
  * @see L3G4200D_PD_BIT
  */
 void L3G4200D::setPowerOn(bool on) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT, on);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT>::write(devAddr, on);
 }
 
 /** Get the current power state
@@ -243,7 +243,7 @@ void L3G4200D::setPowerOn(bool on) {
  * @see L3G4200D_PD_BIT
  */
 bool L3G4200D::getPowerOn() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_PD_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -253,7 +253,7 @@ bool L3G4200D::getPowerOn() {
  * @see L3G4200D_ZEN_BIT
  */
 void L3G4200D::setZEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT, enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether Z axis data is enabled
@@ -262,7 +262,7 @@ void L3G4200D::setZEnabled(bool enabled) {
  * @see L3G4200D_ZEN_BIT
  */
 bool L3G4200D::getZEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_ZEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -272,7 +272,7 @@ bool L3G4200D::getZEnabled() {
  * @see L3G4200D_YEN_BIT
  */
 void L3G4200D::setYEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT, enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether Y axis data is enabled
@@ -281,7 +281,7 @@ void L3G4200D::setYEnabled(bool enabled) {
  * @see L3G4200D_YEN_BIT
  */
 bool L3G4200D::getYEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_YEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -291,7 +291,7 @@ bool L3G4200D::getYEnabled() {
  * @see L3G4200D_XEN_BIT
  */
 void L3G4200D::setXEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT, enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether X axis data is enabled
@@ -300,7 +300,7 @@ void L3G4200D::setXEnabled(bool enabled) {
  * @see L3G4200D_XEN_BIT
  */
 bool L3G4200D::getXEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG1, L3G4200D_XEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -317,8 +317,7 @@ bool L3G4200D::getXEnabled() {
  * @see L3G4200D_HPM_AUTORESET
  */
 void L3G4200D::setHighPassMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, 
-		L3G4200D_HPM_LENGTH, mode);
+	I2CdevField<L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, L3G4200D_HPM_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the high pass mode
@@ -332,8 +331,7 @@ void L3G4200D::setHighPassMode(uint8_t mode) {
  * @see L3G4200D_HPM_AUTORESET
  */
 uint8_t L3G4200D::getHighPassMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, 
-		L3G4200D_HPM_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG2, L3G4200D_HPM_BIT, L3G4200D_HPM_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -354,8 +352,7 @@ uint8_t L3G4200D::getHighPassMode() {
  * @see L3G4200D_HPCF10
  */
 void L3G4200D::setHighPassFilterCutOffFrequencyLevel(uint8_t level) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, 
-		L3G4200D_HPCF_LENGTH, level);
+	I2CdevField<L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, L3G4200D_HPCF_LENGTH>::write(devAddr, level);
 }
 
 /** Get the high pass filter cut off frequency level (1 - 10)
@@ -375,8 +372,7 @@ void L3G4200D::setHighPassFilterCutOffFrequencyLevel(uint8_t level) {
  * @see L3G4200D_HPCF10
  */
 uint8_t L3G4200D::getHighPassFilterCutOffFrequencyLevel() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, 
-		L3G4200D_HPCF_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG2, L3G4200D_HPCF_BIT, L3G4200D_HPCF_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -388,8 +384,7 @@ uint8_t L3G4200D::getHighPassFilterCutOffFrequencyLevel() {
  * @see L3G4200D_I1_INT1_BIT
  */
 void L3G4200D::setINT1InterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT>::write(devAddr, enabled);
 }
 
 /** Get the INT1 interrupt enabled state
@@ -398,8 +393,7 @@ void L3G4200D::setINT1InterruptEnabled(bool enabled) {
  * @see L3G4200D_I1_INT1_BIT
  */
 bool L3G4200D::getINT1InterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_INT1_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -409,8 +403,7 @@ bool L3G4200D::getINT1InterruptEnabled() {
  * @see L3G4200D_I1_BOOT_BIT
  */
 void L3G4200D::setINT1BootStatusEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT>::write(devAddr, enabled);
 }
 
 /** Get the INT1 boot status enabled state
@@ -419,8 +412,7 @@ void L3G4200D::setINT1BootStatusEnabled(bool enabled) {
  * @see L3G4200D_I1_BOOT_BIT
  */
 bool L3G4200D::getINT1BootStatusEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I1_BOOT_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -429,7 +421,7 @@ bool L3G4200D::getINT1BootStatusEnabled() {
  * @see L3G4200D_H_LACTIVE_BIT
  */
 void L3G4200D::interruptActiveINT1Config() {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_H_LACTIVE_BIT, 1);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_H_LACTIVE_BIT>::write(devAddr, 1);
 }
 
 /** Set output mode to push-pull or open-drain
@@ -440,8 +432,7 @@ void L3G4200D::interruptActiveINT1Config() {
  * @see L3G4200D_OPEN_DRAIN
  */
 void L3G4200D::setOutputMode(bool mode) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT, 
-		mode);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT>::write(devAddr, mode);
 }
 
 /** Get whether mode is push-pull or open drain
@@ -452,8 +443,7 @@ void L3G4200D::setOutputMode(bool mode) {
  * @see L3G4200D_OPEN_DRAIN
  */
 bool L3G4200D::getOutputMode() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_PP_OD_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -463,8 +453,7 @@ bool L3G4200D::getOutputMode() {
  * @see L3G4200D_I2_DRDY_BIT
  */
 void L3G4200D::setINT2DataReadyEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the data ready interrupt is enabled on the INT2 pin
@@ -473,8 +462,7 @@ void L3G4200D::setINT2DataReadyEnabled(bool enabled) {
  * @see L3G4200D_I2_DRDY_BIT
  */
 bool L3G4200D::getINT2DataReadyEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_DRDY_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -488,8 +476,7 @@ bool L3G4200D::getINT2DataReadyEnabled() {
  * @see L3G4200D_I2_WTM_BIT
  */
 void L3G4200D::setINT2FIFOWatermarkInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT>::write(devAddr, enabled);
 }
 
 /** Get the INT2 FIFO watermark interrupt enabled state
@@ -498,8 +485,7 @@ void L3G4200D::setINT2FIFOWatermarkInterruptEnabled(bool enabled) {
  * @see L3G4200D_I2_WTM_BIT
  */ 
 bool L3G4200D::getINT2FIFOWatermarkInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_WTM_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -509,8 +495,7 @@ bool L3G4200D::getINT2FIFOWatermarkInterruptEnabled() {
  * @see L3G4200D_I2_ORUN_BIT
  */
 void L3G4200D::setINT2FIFOOverrunInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether an interrupt is triggered on INT2 when the FIFO is overrun
@@ -519,8 +504,7 @@ void L3G4200D::setINT2FIFOOverrunInterruptEnabled(bool enabled) {
  * @see L3G4200D_I2_ORUN_BIT
  */
 bool L3G4200D::getINT2FIFOOverrunInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT,
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_ORUN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -530,8 +514,7 @@ bool L3G4200D::getINT2FIFOOverrunInterruptEnabled() {
  * @see L3G4200D_I2_EMPTY_BIT
  */
 void L3G4200D::setINT2FIFOEmptyInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the INT2 FIFO empty interrupt is enabled
@@ -540,8 +523,7 @@ void L3G4200D::setINT2FIFOEmptyInterruptEnabled(bool enabled) {
  * @see L3G4200D_I2_EMPTY_BIT
  */
 bool L3G4200D::getINT2FIFOEmptyInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG3, L3G4200D_I2_EMPTY_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -553,7 +535,7 @@ bool L3G4200D::getINT2FIFOEmptyInterruptEnabled() {
  * @see L3G4200D_BDU_BIT
  */
 void L3G4200D::setBlockDataUpdateEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT, enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT>::write(devAddr, enabled);
 }
 
 /** Get the BDU enabled state
@@ -562,7 +544,7 @@ void L3G4200D::setBlockDataUpdateEnabled(bool enabled) {
  * @see L3G4200D_BDU_BIT
  */
 bool L3G4200D::getBlockDataUpdateEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_BDU_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -577,8 +559,8 @@ bool L3G4200D::getBlockDataUpdateEnabled() {
  * @see L3G4200D_LITTLE_ENDIAN
  */
 void L3G4200D::setEndianMode(bool endianness) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT, 
-		endianness);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT>::write(devAddr, endianness);
+	endianMode = getEndianMode();
 }
 
 /** Get the data endian mode
@@ -589,8 +571,7 @@ void L3G4200D::setEndianMode(bool endianness) {
  * @see L3G4200D_LITTLE_ENDIAN
  */
 bool L3G4200D::getEndianMode() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT,
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_BLE_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -614,8 +595,7 @@ void L3G4200D::setFullScale(uint16_t scale) {
 		writeBits = L3G4200D_FS_2000;
 	}
 
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_FS_BIT, 
-		L3G4200D_FS_LENGTH, writeBits);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_FS_BIT, L3G4200D_FS_LENGTH>::write(devAddr, writeBits);
 }
 
 /** Get the current full scale of the output data (in dps)
@@ -628,8 +608,7 @@ void L3G4200D::setFullScale(uint16_t scale) {
  * @see L3G4200D_FS_2000
  */
 uint16_t L3G4200D::getFullScale() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG4, 
-		L3G4200D_FS_BIT, L3G4200D_FS_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_FS_BIT, L3G4200D_FS_LENGTH>::read(devAddr, buffer);
 	uint8_t readBits = buffer[0];
 	
 	if (readBits == L3G4200D_FS_250) {
@@ -651,8 +630,7 @@ uint16_t L3G4200D::getFullScale() {
  * @see L3G4200D_SELF_TEST_1
  */
 void L3G4200D::setSelfTestMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, 
-		L3G4200D_ST_LENGTH, mode);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, L3G4200D_ST_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the current self test mode
@@ -665,8 +643,7 @@ void L3G4200D::setSelfTestMode(uint8_t mode) {
  * @see L3G4200D_SELF_TEST_1
  */
 uint8_t L3G4200D::getSelfTestMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, 
-		L3G4200D_ST_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_ST_BIT, L3G4200D_ST_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -678,7 +655,7 @@ uint8_t L3G4200D::getSelfTestMode() {
  * @see L3G4200D_SPI_3_WIRE
  */
 void L3G4200D::setSPIMode(bool mode) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT, mode);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT>::write(devAddr, mode);
 }
 
 /** Get the SPI mode
@@ -689,8 +666,7 @@ void L3G4200D::setSPIMode(bool mode) {
  * @see L3G4200D_SPI_3_WIRE
  */
 bool L3G4200D::getSPIMode() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG4, L3G4200D_SIM_BIT>::read(devAddr, buffer);
  	return buffer[0];
 }
 
@@ -701,7 +677,7 @@ bool L3G4200D::getSPIMode() {
  * @see L3G4200D_BOOT_BIT
  */
 void L3G4200D::rebootMemoryContent() {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_BOOT_BIT, true);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_BOOT_BIT>::write(devAddr, true);
 }
 
 /** Set whether the FIFO buffer is enabled
@@ -710,8 +686,7 @@ void L3G4200D::rebootMemoryContent() {
  * @see L3G4200D_FIFO_EN_BIT
  */
 void L3G4200D::setFIFOEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the FIFO buffer is enabled
@@ -720,8 +695,7 @@ void L3G4200D::setFIFOEnabled(bool enabled) {
  * @see L3G4200D_FIFO_EN_BIT
  */
 bool L3G4200D::getFIFOEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_FIFO_EN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -731,8 +705,7 @@ bool L3G4200D::getFIFOEnabled() {
  * @see L3G4200D_HPEN_BIT
  */
 void L3G4200D::setHighPassFilterEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT, 
-		enabled);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the high pass filter is enabled
@@ -741,8 +714,7 @@ void L3G4200D::setHighPassFilterEnabled(bool enabled) {
  * @see L3G4200D_HPEN_BIT
  */
 bool L3G4200D::getHighPassFilterEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT,
-		buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_HPEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -771,10 +743,8 @@ void L3G4200D::setDataFilter(uint8_t filter) {
 		setHighPassFilterEnabled(false);
 	}
 	
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, 
-		L3G4200D_OUT_SEL_LENGTH, filter);
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_INT1_SEL_BIT, 
-		L3G4200D_INT1_SEL_LENGTH, filter);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, L3G4200D_OUT_SEL_LENGTH>::write(devAddr, filter);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_INT1_SEL_BIT, L3G4200D_INT1_SEL_LENGTH>::write(devAddr, filter);
 }
 
 /** Gets the data filter currently in use
@@ -788,8 +758,7 @@ void L3G4200D::setDataFilter(uint8_t filter) {
  * @see L3G4200D_LOW_HIGH_PASS
  */
 uint8_t L3G4200D::getDataFilter() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, 
-		L3G4200D_OUT_SEL_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_CTRL_REG5, L3G4200D_OUT_SEL_BIT, L3G4200D_OUT_SEL_LENGTH>::read(devAddr, buffer);
 	uint8_t outBits = buffer[0];
 
 	if (outBits == L3G4200D_NON_HIGH_PASS || outBits == L3G4200D_HIGH_PASS) {
@@ -842,8 +811,7 @@ uint8_t L3G4200D::getTemperature() {
  * @see L3G4200D_ZYXOR_BIT
  */
 bool L3G4200D::getXYZOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZYXOR_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_ZYXOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -854,8 +822,7 @@ bool L3G4200D::getXYZOverrun() {
  * @see L3G4200D_ZOR_BIT
  */
 bool L3G4200D::getZOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZOR_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_ZOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -866,8 +833,7 @@ bool L3G4200D::getZOverrun() {
  * @see L3G4200D_YOR_BIT
  */
 bool L3G4200D::getYOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_YOR_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_YOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -878,8 +844,7 @@ bool L3G4200D::getYOverrun() {
  * @see L3G4200D_XOR_BIT
  */
 bool L3G4200D::getXOverrun() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_XOR_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_XOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -889,8 +854,7 @@ bool L3G4200D::getXOverrun() {
  * @see L3G4200D_ZYXDA_BIT
  */
 bool L3G4200D::getXYZDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZYXDA_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_ZYXDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -900,8 +864,7 @@ bool L3G4200D::getXYZDataAvailable() {
  * @see L3G4200D_ZDA_BIT
  */
 bool L3G4200D::getZDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_ZDA_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_ZDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -911,8 +874,7 @@ bool L3G4200D::getZDataAvailable() {
  * @see L3G4200D_YDA_BIT
  */
 bool L3G4200D::getYDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_YDA_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_YDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -922,8 +884,7 @@ bool L3G4200D::getYDataAvailable() {
  * @see L3G4200D_XDA_BIT
  */
 bool L3G4200D::getXDataAvailable() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_STATUS, L3G4200D_XDA_BIT, 
-		buffer);
+	I2CdevField<L3G4200D_RA_STATUS, L3G4200D_XDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -939,9 +900,12 @@ bool L3G4200D::getXDataAvailable() {
  * @param z 16-bit integer container for the Z-axis angular velocity
  */
 void L3G4200D::getAngularVelocity(int16_t* x, int16_t* y, int16_t* z) {
-	*x = getAngularVelocityX();
-	*y = getAngularVelocityY();
-	*z = getAngularVelocityZ();
+	// OUT_X_L..OUT_Z_H in one auto-increment (0x80) burst
+	uint8_t data[6] = { 0 };
+	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | 0x80, 6, data);
+	*x = decodeAngularVelocity(data);
+	*y = decodeAngularVelocity(data + 2);
+	*z = decodeAngularVelocity(data + 4);
 }
 
 /** Get the angular velocity about the X-axis
@@ -950,15 +914,9 @@ void L3G4200D::getAngularVelocity(int16_t* x, int16_t* y, int16_t* z) {
  * @see L3G4200D_RA_OUT_X_H
  */
 int16_t L3G4200D::getAngularVelocityX() {
-	uint8_t bufferL[6];
-	uint8_t bufferH[6];
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L, 1, bufferL);
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_H, 1, bufferH);
-	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t) bufferL[0]) << 8) | bufferH[0];
-	} else {
-		return (((int16_t) bufferH[0]) << 8) | bufferL[0];
-	}
+	uint8_t data[2] = { 0 };
+	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | 0x80, 2, data);
+	return decodeAngularVelocity(data);
 }
 	
 /** Get the angular velocity about the Y-axis
@@ -967,15 +925,9 @@ int16_t L3G4200D::getAngularVelocityX() {
  * @see L3G4200D_RA_OUT_Y_H
  */
 int16_t L3G4200D::getAngularVelocityY() {
-	uint8_t bufferL[6];
-	uint8_t bufferH[6];
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Y_L, 1, bufferL);
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Y_H, 1, bufferH);
-	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t) bufferL[0]) << 8) | bufferH[0];
-	} else {
-		return (((int16_t) bufferH[0]) << 8) | bufferL[0];
-	}
+	uint8_t data[2] = { 0 };
+	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Y_L | 0x80, 2, data);
+	return decodeAngularVelocity(data);
 }
 
 /** Get the angular velocity about the Z-axis
@@ -984,15 +936,69 @@ int16_t L3G4200D::getAngularVelocityY() {
  * @see L3G4200D_RA_OUT_Z_H
  */
 int16_t L3G4200D::getAngularVelocityZ() {
-	uint8_t bufferL[6];
-	uint8_t bufferH[6];
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Z_L, 1, bufferL);
-	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Z_H, 1, bufferH);
-	if (getEndianMode() == L3G4200D_BIG_ENDIAN) {
-		return (((int16_t) bufferL[0]) << 8) | bufferH[0];
+	uint8_t data[2] = { 0 };
+	I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_Z_L | 0x80, 2, data);
+	return decodeAngularVelocity(data);
+}
+
+/** Decode one output register pair using the endian mode last set through
+ * setEndianMode() (no bus access).
+ * @param data Two bytes as read starting at the axis' OUT_*_L register
+ * @return Angular velocity value
+ */
+int16_t L3G4200D::decodeAngularVelocity(const uint8_t *data) {
+	if (endianMode == L3G4200D_BIG_ENDIAN) {
+		return (((int16_t) data[0]) << 8) | data[1];
 	} else {
-		return (((int16_t) bufferH[0]) << 8) | bufferL[0];
+		return (((int16_t) data[1]) << 8) | data[0];
+	}
+}
+
+/** Drain stored angular velocity samples from the FIFO buffer
+ * FIFO_SRC is read once to find the stored data level, then all frames are
+ * read back-to-back from OUT_X_L with the register auto-increment bit (0x80)
+ * set. In FIFO and stream modes the address pointer wraps from OUT_Z_H back
+ * to OUT_X_L and pops the next entry, so the whole level comes out in a
+ * single burst; the burst is only split (on whole-frame boundaries) when the
+ * bus buffer is smaller than the data. Samples are decoded in place using the
+ * endian mode last set through setEndianMode().
+ * @param samples Buffer for X/Y/Z triplets, must hold 3 * max values
+ * @param max Maximum number of samples to read
+ * @return Number of samples read (0 if the FIFO is empty or on bus error)
+ * @see L3G4200D_RA_FIFO_SRC
+ * @see L3G4200D_RA_OUT_X_L
+ */
+uint8_t L3G4200D::readFIFO(int16_t *samples, uint8_t max) {
+	uint8_t src;
+	if (I2Cdev::readByte(devAddr, L3G4200D_RA_FIFO_SRC, &src) != 1) return 0;
+	if (src & (1 << L3G4200D_FIFO_EMPTY_BIT)) return 0;
+
+	// FSS tops out at 31, overrun means all 32 slots are full
+	uint8_t level = (src >> (L3G4200D_FIFO_FSS_BIT - L3G4200D_FIFO_FSS_LENGTH + 1))
+		& ((1 << L3G4200D_FIFO_FSS_LENGTH) - 1);
+	if (src & (1 << L3G4200D_FIFO_OVRN_BIT)) level = 32;
+	if (level > max) level = max;
+
+	uint8_t *raw = (uint8_t *)samples;
+	uint8_t count = 0;
+	while (count < level) {
+		uint8_t frames = level - count;
+		if (frames > I2CDEVLIB_WIRE_BUFFER_LENGTH / 6) frames = I2CDEVLIB_WIRE_BUFFER_LENGTH / 6;
+		if ((uint8_t)I2Cdev::readBytes(devAddr, L3G4200D_RA_OUT_X_L | 0x80, frames * 6,
+			raw + count * 6) != frames * 6) break;
+		count += frames;
+	}
+
+	for (uint16_t i = 0; i < count * 3; i++) {
+		uint8_t first = raw[i * 2];
+		uint8_t second = raw[i * 2 + 1];
+		if (endianMode == L3G4200D_BIG_ENDIAN) {
+			samples[i] = (((int16_t)first) << 8) | second;
+		} else {
+			samples[i] = (((int16_t)second) << 8) | first;
+		}
 	}
+	return count;
 }
 
 // FIFO_CTRL register, r/w
@@ -1009,8 +1015,7 @@ int16_t L3G4200D::getAngularVelocityZ() {
  * @see L3G4200D_FM_BYPASS_STREAM
  */
 void L3G4200D::setFIFOMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_MODE_BIT, 
-		L3G4200D_FIFO_MODE_LENGTH, mode);
+	I2CdevField<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_MODE_BIT, L3G4200D_FIFO_MODE_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the FIFO mode to one of the defined modes
@@ -1025,8 +1030,7 @@ void L3G4200D::setFIFOMode(uint8_t mode) {
  * @see L3G4200D_FM_BYPASS_STREAM
  */
 uint8_t L3G4200D::getFIFOMode() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_FIFO_CTRL, 
-		L3G4200D_FIFO_MODE_BIT, L3G4200D_FIFO_MODE_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_MODE_BIT, L3G4200D_FIFO_MODE_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1037,8 +1041,7 @@ uint8_t L3G4200D::getFIFOMode() {
  * @see L3G4200D_FIFO_WTM_LENGTH
  */
 void L3G4200D::setFIFOThreshold(uint8_t wtm) {
-    I2Cdev::writeBits(devAddr, L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT, 
-        L3G4200D_FIFO_WTM_LENGTH, wtm);
+    I2CdevField<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT, L3G4200D_FIFO_WTM_LENGTH>::write(devAddr, wtm);
 }
 
 /** Get the FIFO watermark threshold
@@ -1048,8 +1051,7 @@ void L3G4200D::setFIFOThreshold(uint8_t wtm) {
  * @see L3G4200D_FIFO_WTM_LENGTH
  */
 uint8_t L3G4200D::getFIFOThreshold() {
-    I2Cdev::readBits(devAddr, L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT,
-        L3G4200D_FIFO_WTM_LENGTH, buffer);
+    I2CdevField<L3G4200D_RA_FIFO_CTRL, L3G4200D_FIFO_WTM_BIT, L3G4200D_FIFO_WTM_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1063,8 +1065,7 @@ uint8_t L3G4200D::getFIFOThreshold() {
  * @see L3G4200D_FIFO_STATUS_BIT
  */
 bool L3G4200D::getFIFOAtWatermark() {
-   	I2Cdev::readBit(devAddr, L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_STATUS_BIT, 
-        buffer);
+   	I2CdevField<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_STATUS_BIT>::read(devAddr, buffer);
    	return buffer[0];
 }
 
@@ -1074,8 +1075,7 @@ bool L3G4200D::getFIFOAtWatermark() {
  * @see L3G4200D_FIFO_OVRN_BIT
  */
 bool L3G4200D::getFIFOOverrun() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_FIFO_SRC, 
-        L3G4200D_FIFO_OVRN_BIT, buffer);
+    I2CdevField<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_OVRN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1085,8 +1085,7 @@ bool L3G4200D::getFIFOOverrun() {
  * @see L3G4200D_FIFO_EMPTY_BIT
  */
 bool L3G4200D::getFIFOEmpty() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_FIFO_SRC,
-        L3G4200D_FIFO_EMPTY_BIT, buffer);
+    I2CdevField<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_EMPTY_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1097,8 +1096,7 @@ bool L3G4200D::getFIFOEmpty() {
  * @see L3G4200D_FIFO_FSS_LENGTH
  */ 
 uint8_t L3G4200D::getFIFOStoredDataLevel() {
-    I2Cdev::readBits(devAddr, L3G4200D_RA_FIFO_SRC, 
-        L3G4200D_FIFO_FSS_BIT, L3G4200D_FIFO_FSS_LENGTH, buffer);
+    I2CdevField<L3G4200D_RA_FIFO_SRC, L3G4200D_FIFO_FSS_BIT, L3G4200D_FIFO_FSS_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1113,8 +1111,7 @@ uint8_t L3G4200D::getFIFOStoredDataLevel() {
  * @see L3G4200D_INT1_AND
  */
 void L3G4200D::setInterruptCombination(bool combination) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT,
-        combination);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT>::write(devAddr, combination);
 }
 
 /** Get the combination mode for interrupt events
@@ -1126,8 +1123,7 @@ void L3G4200D::setInterruptCombination(bool combination) {
  * @see L3G4200D_INT1_AND
  */
 bool L3G4200D::getInterruptCombination() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT,
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_AND_OR_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1138,7 +1134,7 @@ bool L3G4200D::getInterruptCombination() {
  * @see L3G4200D_INT1_LIR_BIT
  */
 void L3G4200D::setInterruptRequestLatched(bool latched) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT, latched);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT>::write(devAddr, latched);
 }
 
 /** Get whether an interrupt request is latched
@@ -1147,8 +1143,7 @@ void L3G4200D::setInterruptRequestLatched(bool latched) {
  * @see L3G4200D_INT1_LIR_BIT
  */
 bool L3G4200D::getInterruptRequestLatched() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT, 
-        buffer); 
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_INT1_LIR_BIT>::read(devAddr, buffer); 
     return buffer[0];
 };
 
@@ -1158,7 +1153,7 @@ bool L3G4200D::getInterruptRequestLatched() {
  * @see L3G4200D_ZHIE_BIT
  */
 void L3G4200D::setZHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT, enabled);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Z high is enabled
@@ -1167,8 +1162,7 @@ void L3G4200D::setZHighInterruptEnabled(bool enabled) {
  * @see L3G4200D_ZHIE_BIT
  */
 bool L3G4200D::getZHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT, 
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_ZHIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1178,7 +1172,7 @@ bool L3G4200D::getZHighInterruptEnabled() {
  * @see L3G4200D_ZLIE_BIT
  */
 void L3G4200D::setZLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT, enabled);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Z low is enabled
@@ -1187,8 +1181,7 @@ void L3G4200D::setZLowInterruptEnabled(bool enabled) {
  * @see L3G4200D_ZLIE_BIT
  */
 bool L3G4200D::getZLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT, 
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_ZLIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1198,7 +1191,7 @@ bool L3G4200D::getZLowInterruptEnabled() {
  * @see L3G4200D_YHIE_BIT
  */
 void L3G4200D::setYHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT, enabled);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Y high is enabled
@@ -1207,8 +1200,7 @@ void L3G4200D::setYHighInterruptEnabled(bool enabled) {
  * @see L3G4200D_YHIE_BIT
  */
 bool L3G4200D::getYHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT, 
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_YHIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1218,7 +1210,7 @@ bool L3G4200D::getYHighInterruptEnabled() {
  * @see L3G4200D_YLIE_BIT
  */
 void L3G4200D::setYLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT, enabled);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Y low is enabled
@@ -1227,8 +1219,7 @@ void L3G4200D::setYLowInterruptEnabled(bool enabled) {
  * @see L3G4200D_YLIE_BIT
  */
 bool L3G4200D::getYLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT, 
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_YLIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1238,7 +1229,7 @@ bool L3G4200D::getYLowInterruptEnabled() {
  * @see L3G4200D_XHIE_BIT
  */
 void L3G4200D::setXHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT, enabled);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for X high is enabled
@@ -1247,8 +1238,7 @@ void L3G4200D::setXHighInterruptEnabled(bool enabled) {
  * @see L3G4200D_XHIE_BIT
  */
 bool L3G4200D::getXHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT, 
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_XHIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1258,7 +1248,7 @@ bool L3G4200D::getXHighInterruptEnabled() {
  * @see L3G4200D_XLIE_BIT
  */
 void L3G4200D::setXLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT, enabled);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for X low is enabled
@@ -1267,8 +1257,7 @@ void L3G4200D::setXLowInterruptEnabled(bool enabled) {
  * @see L3G4200D_XLIE_BIT
  */
 bool L3G4200D::getXLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT, 
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_CFG, L3G4200D_XLIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1280,8 +1269,7 @@ bool L3G4200D::getXLowInterruptEnabled() {
  * @see L3G4200D_INT1_IA_BIT
  */
 bool L3G4200D::getInterruptActive() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_IA_BIT,
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_IA_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1291,8 +1279,7 @@ bool L3G4200D::getInterruptActive() {
  * @see L3G4200D_INT1_ZH_BIT
  */
 bool L3G4200D::getZHigh() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZH_BIT,
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZH_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1302,8 +1289,7 @@ bool L3G4200D::getZHigh() {
  * @see L3G4200D_INT1_ZL_BIT
  */
 bool L3G4200D::getZLow() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZL_BIT,
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_ZL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1313,8 +1299,7 @@ bool L3G4200D::getZLow() {
  * @see L3G4200D_INT1_YH_BIT
  */
 bool L3G4200D::getYHigh() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YH_BIT,
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YH_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1324,8 +1309,7 @@ bool L3G4200D::getYHigh() {
  * @see L3G4200D_INT1_YL_BIT
  */
 bool L3G4200D::getYLow() {
-   	I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YL_BIT,
-        buffer);
+   	I2CdevField<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_YL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1335,8 +1319,7 @@ bool L3G4200D::getYLow() {
  * @see L3G4200D_INT1_XH_BIT
  */
 bool L3G4200D::getXHigh() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XH_BIT,
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XH_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1346,8 +1329,7 @@ bool L3G4200D::getXHigh() {
  * @see L3G4200D_INT1_XL_BIT
  */
 bool L3G4200D::getXLow() {
-    I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XL_BIT,
-        buffer);
+    I2CdevField<L3G4200D_RA_INT1_SRC, L3G4200D_INT1_XL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1466,8 +1448,7 @@ uint8_t L3G4200D::getZLowThreshold() {
  * @see L3G4200D_INT1_DUR_LENGTH
  */
 void L3G4200D::setDuration(uint8_t duration) {
-	I2Cdev::writeBits(devAddr, L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_DUR_BIT,
-		L3G4200D_INT1_DUR_LENGTH, duration);
+	I2CdevField<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_DUR_BIT, L3G4200D_INT1_DUR_LENGTH>::write(devAddr, duration);
 }
 
 /** Get the minimum duration for an interrupt event to be recognized
@@ -1477,8 +1458,7 @@ void L3G4200D::setDuration(uint8_t duration) {
  * @see L3G4200D_INT1_DUR_LENGTH
  */
 uint8_t L3G4200D::getDuration() {
-	I2Cdev::readBits(devAddr, L3G4200D_RA_INT1_DURATION, 
-		L3G4200D_INT1_DUR_BIT, L3G4200D_INT1_DUR_LENGTH, buffer);
+	I2CdevField<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_DUR_BIT, L3G4200D_INT1_DUR_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1492,8 +1472,7 @@ uint8_t L3G4200D::getDuration() {
  * @see L3G4200D_INT1_WAIT_BIT
  */
 void L3G4200D::setWaitEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_WAIT_BIT,
-		enabled);
+	I2CdevField<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_WAIT_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt wait feature is enabled
@@ -1502,7 +1481,6 @@ void L3G4200D::setWaitEnabled(bool enabled) {
  * @see L3G4200D_INT1_WAIT_BIT
  */
 bool L3G4200D::getWaitEnabled() {
-	I2Cdev::readBit(devAddr, L3G4200D_RA_INT1_DURATION, 
-		L3G4200D_INT1_WAIT_BIT, buffer);
+	I2CdevField<L3G4200D_RA_INT1_DURATION, L3G4200D_INT1_WAIT_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
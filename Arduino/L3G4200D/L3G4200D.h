@@ -295,6 +295,7 @@ class L3G4200D {
         int16_t getAngularVelocityX();
 		int16_t getAngularVelocityY();
 		int16_t getAngularVelocityZ();
+		uint8_t readFIFO(int16_t *samples, uint8_t max);
 		
 		// FIFO_CTRL register, r/w
 		void setFIFOMode(uint8_t mode);
@@ -358,6 +359,9 @@ class L3G4200D {
     private:
         uint8_t devAddr;
         uint8_t buffer[6];
+        bool endianMode;
+
+        int16_t decodeAngularVelocity(const uint8_t *data);
 };
 
 #endif /* _L3G4200D_H_ */
@@ -31,6 +31,7 @@ THE SOFTWARE.
 */
 
 #include "L3GD20H.h"
+#include "helper_field.h"
 
 /** Default constructor, uses default I2C address.
  * @see L3GD20H_DEFAULT_ADDRESS
@@ -127,8 +128,7 @@ void L3GD20H::setOutputDataRate(uint16_t rate) {
 		setLowODREnabled(false);
 	}
 	
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL1, L3GD20H_ODR_BIT,
-		L3GD20H_ODR_LENGTH, writeVal); 
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_ODR_BIT, L3GD20H_ODR_LENGTH>::write(devAddr, writeVal); 
 }
 
 /** Get the current output data rate
@@ -144,8 +144,7 @@ void L3GD20H::setOutputDataRate(uint16_t rate) {
  * @see L3GD20H_LOW_ODR_BIT
  */
 uint16_t L3GD20H::getOutputDataRate() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_CTRL1, L3GD20H_ODR_BIT, 
-		L3GD20H_ODR_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_ODR_BIT, L3GD20H_ODR_LENGTH>::read(devAddr, buffer);
 	uint8_t rate = buffer[0];
 
 	if (rate == L3GD20H_RATE_100_12) {
@@ -187,8 +186,7 @@ uint16_t L3GD20H::getOutputDataRate() {
  * @see L3GD20H_BW_HIGH
  */
 void L3GD20H::setBandwidthCutOffMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL1, L3GD20H_BW_BIT, 
-		L3GD20H_BW_LENGTH, mode);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_BW_BIT, L3GD20H_BW_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the current bandwidth cut-off mode
@@ -202,8 +200,7 @@ void L3GD20H::setBandwidthCutOffMode(uint8_t mode) {
  * @see L3GD20H_BW_HIGH
  */
 uint8_t L3GD20H::getBandwidthCutOffMode() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_CTRL1, L3GD20H_BW_BIT, 
-		L3GD20H_BW_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_BW_BIT, L3GD20H_BW_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -276,7 +273,7 @@ uint8_t L3GD20H::getBandwidthCutOffMode() {
  * @see L3GD20H_PD_BIT
  */
 void L3GD20H::setPowerOn(bool on) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_PD_BIT, on);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_PD_BIT>::write(devAddr, on);
 }
 
 /** Get the current power state
@@ -285,7 +282,7 @@ void L3GD20H::setPowerOn(bool on) {
  * @see L3GD20H_PD_BIT
  */
 bool L3GD20H::getPowerOn() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_PD_BIT, buffer);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_PD_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -295,7 +292,7 @@ bool L3GD20H::getPowerOn() {
  * @see L3GD20H_ZEN_BIT
  */
 void L3GD20H::setZEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_ZEN_BIT, enabled);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_ZEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether Z axis data is enabled
@@ -304,7 +301,7 @@ void L3GD20H::setZEnabled(bool enabled) {
  * @see L3GD20H_ZEN_BIT
  */
 bool L3GD20H::getZEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_ZEN_BIT, buffer);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_ZEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -314,7 +311,7 @@ bool L3GD20H::getZEnabled() {
  * @see L3GD20H_YEN_BIT
  */
 void L3GD20H::setYEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_YEN_BIT, enabled);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_YEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether Y axis data is enabled
@@ -323,7 +320,7 @@ void L3GD20H::setYEnabled(bool enabled) {
  * @see L3GD20H_YEN_BIT
  */
 bool L3GD20H::getYEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_YEN_BIT, buffer);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_YEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -333,7 +330,7 @@ bool L3GD20H::getYEnabled() {
  * @see L3GD20H_XEN_BIT
  */
 void L3GD20H::setXEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_XEN_BIT, enabled);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_XEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether X axis data is enabled
@@ -342,7 +339,7 @@ void L3GD20H::setXEnabled(bool enabled) {
  * @see L3GD20H_XEN_BIT
  */
 bool L3GD20H::getXEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL1, L3GD20H_XEN_BIT, buffer);
+	I2CdevField<L3GD20H_RA_CTRL1, L3GD20H_XEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -359,8 +356,7 @@ bool L3GD20H::getXEnabled() {
  * @see L3GD20H_HPM_AUTORESET
  */
 void L3GD20H::setHighPassMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL2, L3GD20H_HPM_BIT, 
-		L3GD20H_HPM_LENGTH, mode);
+	I2CdevField<L3GD20H_RA_CTRL2, L3GD20H_HPM_BIT, L3GD20H_HPM_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the high pass mode
@@ -374,8 +370,7 @@ void L3GD20H::setHighPassMode(uint8_t mode) {
  * @see L3GD20H_HPM_AUTORESET
  */
 uint8_t L3GD20H::getHighPassMode() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_CTRL2, L3GD20H_HPM_BIT, 
-		L3GD20H_HPM_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_CTRL2, L3GD20H_HPM_BIT, L3GD20H_HPM_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -396,8 +391,7 @@ uint8_t L3GD20H::getHighPassMode() {
  * @see L3GD20H_HPCF10
  */
 void L3GD20H::setHighPassFilterCutOffFrequencyLevel(uint8_t level) {
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL2, L3GD20H_HPCF_BIT, 
-		L3GD20H_HPCF_LENGTH, level);
+	I2CdevField<L3GD20H_RA_CTRL2, L3GD20H_HPCF_BIT, L3GD20H_HPCF_LENGTH>::write(devAddr, level);
 }
 
 /** Get the high pass filter cut off frequency level (1 - 10)
@@ -417,8 +411,7 @@ void L3GD20H::setHighPassFilterCutOffFrequencyLevel(uint8_t level) {
  * @see L3GD20H_HPCF10
  */
 uint8_t L3GD20H::getHighPassFilterCutOffFrequencyLevel() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_CTRL2, L3GD20H_HPCF_BIT, 
-		L3GD20H_HPCF_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_CTRL2, L3GD20H_HPCF_BIT, L3GD20H_HPCF_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -430,8 +423,7 @@ uint8_t L3GD20H::getHighPassFilterCutOffFrequencyLevel() {
  * @see L3GD20H_INT1_IG_BIT
  */
 void L3GD20H::setINT1InterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT1_IG_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT1_IG_BIT>::write(devAddr, enabled);
 }
 
 /** Get the INT1 interrupt enabled state
@@ -440,8 +432,7 @@ void L3GD20H::setINT1InterruptEnabled(bool enabled) {
  * @see L3GD20H_INT1_IG_BIT
  */
 bool L3GD20H::getINT1InterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT1_IG_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT1_IG_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -451,8 +442,7 @@ bool L3GD20H::getINT1InterruptEnabled() {
  * @see L3GD20H_INT1_BOOT_BIT
  */
 void L3GD20H::setINT1BootStatusEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT1_BOOT_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT1_BOOT_BIT>::write(devAddr, enabled);
 }
 
 /** Get the INT1 boot status enabled state
@@ -461,8 +451,7 @@ void L3GD20H::setINT1BootStatusEnabled(bool enabled) {
  * @see L3GD20H_INT1_BOOT_BIT
  */
 bool L3GD20H::getINT1BootStatusEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT1_BOOT_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT1_BOOT_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -471,7 +460,7 @@ bool L3GD20H::getINT1BootStatusEnabled() {
  * @see L3GD20H_H_LACTIVE_BIT
  */
 void L3GD20H::interruptActiveINT1Config() {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_H_LACTIVE_BIT, 1);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_H_LACTIVE_BIT>::write(devAddr, 1);
 }
 
 /** Set output mode to push-pull or open-drain
@@ -482,8 +471,7 @@ void L3GD20H::interruptActiveINT1Config() {
  * @see L3GD20H_OPEN_DRAIN
  */
 void L3GD20H::setOutputMode(bool mode) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_PP_OD_BIT, 
-		mode);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_PP_OD_BIT>::write(devAddr, mode);
 }
 
 /** Get whether mode is push-pull or open drain
@@ -494,8 +482,7 @@ void L3GD20H::setOutputMode(bool mode) {
  * @see L3GD20H_OPEN_DRAIN
  */
 bool L3GD20H::getOutputMode() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_PP_OD_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_PP_OD_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -505,8 +492,7 @@ bool L3GD20H::getOutputMode() {
  * @see L3GD20H_INT2_DRDY_BIT
  */
 void L3GD20H::setINT2DataReadyEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_DRDY_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_DRDY_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the data ready interrupt is enabled on the INT2 pin
@@ -515,8 +501,7 @@ void L3GD20H::setINT2DataReadyEnabled(bool enabled) {
  * @see L3GD20H_INT2_DRDY_BIT
  */
 bool L3GD20H::getINT2DataReadyEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_DRDY_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_DRDY_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -530,8 +515,7 @@ bool L3GD20H::getINT2DataReadyEnabled() {
  * @see L3GD20H_I2_WTM_BIT
  */
 void L3GD20H::setINT2FIFOWatermarkInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_FTH_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_FTH_BIT>::write(devAddr, enabled);
 }
 
 /** Get the INT2 FIFO threshold (watermark) interrupt enabled state
@@ -540,8 +524,7 @@ void L3GD20H::setINT2FIFOWatermarkInterruptEnabled(bool enabled) {
  * @see L3GD20H_INT2_FTH_BIT
  */ 
 bool L3GD20H::getINT2FIFOWatermarkInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_FTH_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_FTH_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -551,8 +534,7 @@ bool L3GD20H::getINT2FIFOWatermarkInterruptEnabled() {
  * @see L3GD20H_INT2_ORUN_BIT
  */
 void L3GD20H::setINT2FIFOOverrunInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_ORUN_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_ORUN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether an interrupt is triggered on INT2 when the FIFO is overrun
@@ -561,8 +543,7 @@ void L3GD20H::setINT2FIFOOverrunInterruptEnabled(bool enabled) {
  * @see L3GD20H_INT2_ORUN_BIT
  */
 bool L3GD20H::getINT2FIFOOverrunInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_ORUN_BIT,
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_ORUN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -572,8 +553,7 @@ bool L3GD20H::getINT2FIFOOverrunInterruptEnabled() {
  * @see L3GD20H_INT2_EMPTY_BIT
  */
 void L3GD20H::setINT2FIFOEmptyInterruptEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_EMPTY_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_EMPTY_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the INT2 FIFO empty interrupt is enabled
@@ -582,8 +562,7 @@ void L3GD20H::setINT2FIFOEmptyInterruptEnabled(bool enabled) {
  * @see L3GD20H_INT2_EMPTY_BIT
  */
 bool L3GD20H::getINT2FIFOEmptyInterruptEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL3, L3GD20H_INT2_EMPTY_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL3, L3GD20H_INT2_EMPTY_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -595,7 +574,7 @@ bool L3GD20H::getINT2FIFOEmptyInterruptEnabled() {
  * @see L3GD20H_BDU_BIT
  */
 void L3GD20H::setBlockDataUpdateEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL4, L3GD20H_BDU_BIT, enabled);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_BDU_BIT>::write(devAddr, enabled);
 }
 
 /** Get the BDU enabled state
@@ -604,7 +583,7 @@ void L3GD20H::setBlockDataUpdateEnabled(bool enabled) {
  * @see L3GD20H_BDU_BIT
  */
 bool L3GD20H::getBlockDataUpdateEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL4, L3GD20H_BDU_BIT, buffer);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_BDU_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -619,8 +598,7 @@ bool L3GD20H::getBlockDataUpdateEnabled() {
  * @see L3GD20H_LITTLE_ENDIAN
  */
 void L3GD20H::setEndianMode(bool endianness) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL4, L3GD20H_BLE_BIT, 
-		endianness);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_BLE_BIT>::write(devAddr, endianness);
 	endianMode = getEndianMode();
 }
 
@@ -632,8 +610,7 @@ void L3GD20H::setEndianMode(bool endianness) {
  * @see L3GD20H_LITTLE_ENDIAN
  */
 bool L3GD20H::getEndianMode() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL4, L3GD20H_BLE_BIT,
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_BLE_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -657,8 +634,7 @@ void L3GD20H::setFullScale(uint16_t scale) {
 		writeBits = L3GD20H_FS_2000;
 	}
 
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL4, L3GD20H_FS_BIT, 
-		L3GD20H_FS_LENGTH, writeBits);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_FS_BIT, L3GD20H_FS_LENGTH>::write(devAddr, writeBits);
 }
 
 /** Get the current full scale of the output data (in dps)
@@ -671,8 +647,7 @@ void L3GD20H::setFullScale(uint16_t scale) {
  * @see L3GD20H_FS_2000
  */
 uint16_t L3GD20H::getFullScale() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_CTRL4, 
-		L3GD20H_FS_BIT, L3GD20H_FS_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_FS_BIT, L3GD20H_FS_LENGTH>::read(devAddr, buffer);
 	uint8_t readBits = buffer[0];
 	
 	if (readBits == L3GD20H_FS_250) {
@@ -700,8 +675,7 @@ uint16_t L3GD20H::getFullScale() {
  * @see L3GD20H_SELF_TEST_1
  */
 void L3GD20H::setSelfTestMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL4, L3GD20H_ST_BIT, 
-		L3GD20H_ST_LENGTH, mode);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_ST_BIT, L3GD20H_ST_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the current self test mode
@@ -714,8 +688,7 @@ void L3GD20H::setSelfTestMode(uint8_t mode) {
  * @see L3GD20H_SELF_TEST_1
  */
 uint8_t L3GD20H::getSelfTestMode() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_CTRL4, L3GD20H_ST_BIT, 
-		L3GD20H_ST_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_ST_BIT, L3GD20H_ST_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -727,7 +700,7 @@ uint8_t L3GD20H::getSelfTestMode() {
  * @see L3GD20H_SPI_3_WIRE
  */
 void L3GD20H::setSPIMode(bool mode) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL4, L3GD20H_SIM_BIT, mode);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_SIM_BIT>::write(devAddr, mode);
 }
 
 /** Get the SPI mode
@@ -738,8 +711,7 @@ void L3GD20H::setSPIMode(bool mode) {
  * @see L3GD20H_SPI_3_WIRE
  */
 bool L3GD20H::getSPIMode() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL4, L3GD20H_SIM_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL4, L3GD20H_SIM_BIT>::read(devAddr, buffer);
  	return buffer[0];
 }
 
@@ -750,7 +722,7 @@ bool L3GD20H::getSPIMode() {
  * @see L3GD20H_BOOT_BIT
  */
 void L3GD20H::rebootMemoryContent() {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL5, L3GD20H_BOOT_BIT, true);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_BOOT_BIT>::write(devAddr, true);
 }
 
 /** Set whether the FIFO buffer is enabled
@@ -759,8 +731,7 @@ void L3GD20H::rebootMemoryContent() {
  * @see L3GD20H_FIFO_EN_BIT
  */
 void L3GD20H::setFIFOEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL5, L3GD20H_FIFO_EN_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_FIFO_EN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the FIFO buffer is enabled
@@ -769,8 +740,7 @@ void L3GD20H::setFIFOEnabled(bool enabled) {
  * @see L3GD20H_FIFO_EN_BIT
  */
 bool L3GD20H::getFIFOEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL5, L3GD20H_FIFO_EN_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_FIFO_EN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -781,8 +751,7 @@ bool L3GD20H::getFIFOEnabled() {
  * @see L3GD20H_FIFO_STOPONFTH_BIT
  */
 void L3GD20H::setStopOnFIFOThresholdEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL5, L3GD20H_STOPONFTH_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_STOPONFTH_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the sensing chain FIFO stopping writing new values once
@@ -792,8 +761,7 @@ void L3GD20H::setStopOnFIFOThresholdEnabled(bool enabled) {
  * @see L3GD20H_FIFO_STOPONFTH_BIT
  */
 bool L3GD20H::getStopOnFIFOThresholdEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL5, L3GD20H_STOPONFTH_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_STOPONFTH_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -804,8 +772,7 @@ bool L3GD20H::getStopOnFIFOThresholdEnabled() {
  * @see L3GD20H_HPEN_BIT
  */
 void L3GD20H::setHighPassFilterEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_CTRL5, L3GD20H_HPEN_BIT, 
-		enabled);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_HPEN_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the high pass filter is enabled
@@ -814,8 +781,7 @@ void L3GD20H::setHighPassFilterEnabled(bool enabled) {
  * @see L3GD20H_HPEN_BIT
  */
 bool L3GD20H::getHighPassFilterEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_CTRL5, L3GD20H_HPEN_BIT,
-		buffer);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_HPEN_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -845,10 +811,8 @@ void L3GD20H::setDataFilter(uint8_t filter) {
 		setHighPassFilterEnabled(false);
 	}
 	
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL5, L3GD20H_OUT_SEL_BIT, 
-		L3GD20H_OUT_SEL_LENGTH, filter);
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_CTRL5, L3GD20H_IG_SEL_BIT, 
-		L3GD20H_IG_SEL_LENGTH, filter);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_OUT_SEL_BIT, L3GD20H_OUT_SEL_LENGTH>::write(devAddr, filter);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_IG_SEL_BIT, L3GD20H_IG_SEL_LENGTH>::write(devAddr, filter);
 }
 
 /** Gets the data filter currently in use
@@ -862,8 +826,7 @@ void L3GD20H::setDataFilter(uint8_t filter) {
  * @see L3GD20H_LOW_HIGH_PASS
  */
 uint8_t L3GD20H::getDataFilter() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_CTRL5, L3GD20H_OUT_SEL_BIT, 
-		L3GD20H_OUT_SEL_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_CTRL5, L3GD20H_OUT_SEL_BIT, L3GD20H_OUT_SEL_LENGTH>::read(devAddr, buffer);
 	uint8_t outBits = buffer[0];
 
 	if (outBits == L3GD20H_NON_HIGH_PASS || outBits == L3GD20H_HIGH_PASS) {
@@ -929,8 +892,7 @@ uint8_t L3GD20H::getTemperature() {
  * @see L3GD20H_ZYXOR_BIT
  */
 bool L3GD20H::getXYZOverrun() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_ZYXOR_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_ZYXOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -941,8 +903,7 @@ bool L3GD20H::getXYZOverrun() {
  * @see L3GD20H_ZOR_BIT
  */
 bool L3GD20H::getZOverrun() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_ZOR_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_ZOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -953,8 +914,7 @@ bool L3GD20H::getZOverrun() {
  * @see L3GD20H_YOR_BIT
  */
 bool L3GD20H::getYOverrun() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_YOR_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_YOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -965,8 +925,7 @@ bool L3GD20H::getYOverrun() {
  * @see L3GD20H_XOR_BIT
  */
 bool L3GD20H::getXOverrun() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_XOR_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_XOR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -976,8 +935,7 @@ bool L3GD20H::getXOverrun() {
  * @see L3GD20H_ZYXDA_BIT
  */
 bool L3GD20H::getXYZDataAvailable() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_ZYXDA_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_ZYXDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -987,8 +945,7 @@ bool L3GD20H::getXYZDataAvailable() {
  * @see L3GD20H_ZDA_BIT
  */
 bool L3GD20H::getZDataAvailable() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_ZDA_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_ZDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -998,8 +955,7 @@ bool L3GD20H::getZDataAvailable() {
  * @see L3GD20H_YDA_BIT
  */
 bool L3GD20H::getYDataAvailable() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_YDA_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_YDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1009,8 +965,7 @@ bool L3GD20H::getYDataAvailable() {
  * @see L3GD20H_XDA_BIT
  */
 bool L3GD20H::getXDataAvailable() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_STATUS, L3GD20H_XDA_BIT, 
-		buffer);
+	I2CdevField<L3GD20H_RA_STATUS, L3GD20H_XDA_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1038,6 +993,52 @@ void L3GD20H::getAngularVelocity(int16_t* x, int16_t* y, int16_t* z) {
 	}
 }
 
+/** Drain stored angular velocity samples from the FIFO buffer
+ * FIFO_SRC is read once to find the stored data level, then all frames are
+ * read back-to-back from OUT_X_L with the register auto-increment bit (0x80)
+ * set. In FIFO and stream modes the address pointer wraps from OUT_Z_H back
+ * to OUT_X_L and pops the next entry, so the whole level comes out in a
+ * single burst; the burst is only split (on whole-frame boundaries) when the
+ * bus buffer is smaller than the data.
+ * @param samples Buffer for X/Y/Z triplets, must hold 3 * max values
+ * @param max Maximum number of samples to read
+ * @return Number of samples read (0 if the FIFO is empty or on bus error)
+ * @see L3GD20H_RA_FIFO_SRC
+ * @see L3GD20H_RA_OUT_X_L
+ */
+uint8_t L3GD20H::readFIFO(int16_t *samples, uint8_t max) {
+	uint8_t src;
+	if (I2Cdev::readByte(devAddr, L3GD20H_RA_FIFO_SRC, &src) != 1) return 0;
+	if (src & (1 << L3GD20H_EMPTY_BIT)) return 0;
+
+	// FSS tops out at 31, overrun means all 32 slots are full
+	uint8_t level = (src >> (L3GD20H_FIFO_FSS_BIT - L3GD20H_FIFO_FSS_LENGTH + 1))
+		& ((1 << L3GD20H_FIFO_FSS_LENGTH) - 1);
+	if (src & (1 << L3GD20H_OVRN_BIT)) level = 32;
+	if (level > max) level = max;
+
+	uint8_t *raw = (uint8_t *)samples;
+	uint8_t count = 0;
+	while (count < level) {
+		uint8_t frames = level - count;
+		if (frames > I2CDEVLIB_WIRE_BUFFER_LENGTH / 6) frames = I2CDEVLIB_WIRE_BUFFER_LENGTH / 6;
+		if ((uint8_t)I2Cdev::readBytes(devAddr, L3GD20H_RA_OUT_X_L | 0x80, frames * 6,
+			raw + count * 6) != frames * 6) break;
+		count += frames;
+	}
+
+	for (uint16_t i = 0; i < count * 3; i++) {
+		uint8_t first = raw[i * 2];
+		uint8_t second = raw[i * 2 + 1];
+		if (endianMode == L3GD20H_LITTLE_ENDIAN) {
+			samples[i] = (((int16_t)second) << 8) | first;
+		} else {
+			samples[i] = (((int16_t)first) << 8) | second;
+		}
+	}
+	return count;
+}
+
 /** Get the angular velocity about the X-axis
  * @return Angular velocity about the X-axis
  * @see L3GD20H_RA_OUT_X_L
@@ -1096,8 +1097,7 @@ int16_t L3GD20H::getAngularVelocityZ() {
  * @see L3GD20H_FM_BYPASS_FIFO
  */
 void L3GD20H::setFIFOMode(uint8_t mode) {
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_FIFO_CTRL, L3GD20H_FIFO_MODE_BIT, 
-		L3GD20H_FIFO_MODE_LENGTH, mode);
+	I2CdevField<L3GD20H_RA_FIFO_CTRL, L3GD20H_FIFO_MODE_BIT, L3GD20H_FIFO_MODE_LENGTH>::write(devAddr, mode);
 }
 
 /** Get the FIFO mode to one of the defined modes
@@ -1114,8 +1114,7 @@ void L3GD20H::setFIFOMode(uint8_t mode) {
  * @see L3GD20H_FM_BYPASS_FIFO
  */
 uint8_t L3GD20H::getFIFOMode() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_FIFO_CTRL, 
-		L3GD20H_FIFO_MODE_BIT, L3GD20H_FIFO_MODE_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_FIFO_CTRL, L3GD20H_FIFO_MODE_BIT, L3GD20H_FIFO_MODE_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1126,8 +1125,7 @@ uint8_t L3GD20H::getFIFOMode() {
  * @see L3GD20H_FIFO_TH_LENGTH
  */
 void L3GD20H::setFIFOThreshold(uint8_t fth) {
-    I2Cdev::writeBits(devAddr, L3GD20H_RA_FIFO_CTRL, L3GD20H_FIFO_TH_BIT, 
-        L3GD20H_FIFO_TH_LENGTH, fth);
+    I2CdevField<L3GD20H_RA_FIFO_CTRL, L3GD20H_FIFO_TH_BIT, L3GD20H_FIFO_TH_LENGTH>::write(devAddr, fth);
 }
 
 /** Get the FIFO watermark threshold
@@ -1137,8 +1135,7 @@ void L3GD20H::setFIFOThreshold(uint8_t fth) {
  * @see L3GD20H_FIFO_TH_LENGTH
  */
 uint8_t L3GD20H::getFIFOThreshold() {
-    I2Cdev::readBits(devAddr, L3GD20H_RA_FIFO_CTRL, L3GD20H_FIFO_TH_BIT,
-        L3GD20H_FIFO_TH_LENGTH, buffer);
+    I2CdevField<L3GD20H_RA_FIFO_CTRL, L3GD20H_FIFO_TH_BIT, L3GD20H_FIFO_TH_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1152,8 +1149,7 @@ uint8_t L3GD20H::getFIFOThreshold() {
  * @see L3GD20H_FIFO_TH_STATUS_BIT
  */
 bool L3GD20H::getFIFOAtWatermark() {
-   	I2Cdev::readBit(devAddr, L3GD20H_RA_FIFO_SRC, L3GD20H_FIFO_TH_STATUS_BIT, 
-        buffer);
+   	I2CdevField<L3GD20H_RA_FIFO_SRC, L3GD20H_FIFO_TH_STATUS_BIT>::read(devAddr, buffer);
    	return buffer[0];
 }
 
@@ -1163,8 +1159,7 @@ bool L3GD20H::getFIFOAtWatermark() {
  * @see L3GD20H_FIFO_OVRN_BIT
  */
 bool L3GD20H::getFIFOOverrun() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_FIFO_SRC, 
-        L3GD20H_OVRN_BIT, buffer);
+    I2CdevField<L3GD20H_RA_FIFO_SRC, L3GD20H_OVRN_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1174,8 +1169,7 @@ bool L3GD20H::getFIFOOverrun() {
  * @see L3GD20H_FIFO_EMPTY_BIT
  */
 bool L3GD20H::getFIFOEmpty() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_FIFO_SRC,
-        L3GD20H_EMPTY_BIT, buffer);
+    I2CdevField<L3GD20H_RA_FIFO_SRC, L3GD20H_EMPTY_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1186,8 +1180,7 @@ bool L3GD20H::getFIFOEmpty() {
  * @see L3GD20H_FIFO_FSS_LENGTH
  */ 
 uint8_t L3GD20H::getFIFOStoredDataLevel() {
-    I2Cdev::readBits(devAddr, L3GD20H_RA_FIFO_SRC, 
-        L3GD20H_FIFO_FSS_BIT, L3GD20H_FIFO_FSS_LENGTH, buffer);
+    I2CdevField<L3GD20H_RA_FIFO_SRC, L3GD20H_FIFO_FSS_BIT, L3GD20H_FIFO_FSS_LENGTH>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1202,8 +1195,7 @@ uint8_t L3GD20H::getFIFOStoredDataLevel() {
  * @see L3GD20H_AND_OR_AND
  */
 void L3GD20H::setInterruptCombination(bool combination) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_AND_OR_BIT,
-        combination);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_AND_OR_BIT>::write(devAddr, combination);
 }
 
 /** Get the combination mode for interrupt events
@@ -1215,8 +1207,7 @@ void L3GD20H::setInterruptCombination(bool combination) {
  * @see L3GD20H_AND_OR_AND
  */
 bool L3GD20H::getInterruptCombination() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_AND_OR_BIT,
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_AND_OR_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1227,7 +1218,7 @@ bool L3GD20H::getInterruptCombination() {
  * @see L3GD20H_LIR_BIT
  */
 void L3GD20H::setInterruptRequestLatched(bool latched) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_LIR_BIT, latched);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_LIR_BIT>::write(devAddr, latched);
 }
 
 /** Get whether an interrupt request is latched
@@ -1236,8 +1227,7 @@ void L3GD20H::setInterruptRequestLatched(bool latched) {
  * @see L3GD20H_LIR_BIT
  */
 bool L3GD20H::getInterruptRequestLatched() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_LIR_BIT, 
-        buffer); 
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_LIR_BIT>::read(devAddr, buffer); 
     return buffer[0];
 };
 
@@ -1247,7 +1237,7 @@ bool L3GD20H::getInterruptRequestLatched() {
  * @see L3GD20H_ZHIE_BIT
  */
 void L3GD20H::setZHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_ZHIE_BIT, enabled);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_ZHIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Z high is enabled
@@ -1256,8 +1246,7 @@ void L3GD20H::setZHighInterruptEnabled(bool enabled) {
  * @see L3GD20H_ZHIE_BIT
  */
 bool L3GD20H::getZHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_ZHIE_BIT, 
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_ZHIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1267,7 +1256,7 @@ bool L3GD20H::getZHighInterruptEnabled() {
  * @see L3GD20H_ZLIE_BIT
  */
 void L3GD20H::setZLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_ZLIE_BIT, enabled);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_ZLIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Z low is enabled
@@ -1276,8 +1265,7 @@ void L3GD20H::setZLowInterruptEnabled(bool enabled) {
  * @see L3GD20H_ZLIE_BIT
  */
 bool L3GD20H::getZLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_ZLIE_BIT, 
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_ZLIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1287,7 +1275,7 @@ bool L3GD20H::getZLowInterruptEnabled() {
  * @see L3GD20H_YHIE_BIT
  */
 void L3GD20H::setYHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_YHIE_BIT, enabled);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_YHIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Y high is enabled
@@ -1296,8 +1284,7 @@ void L3GD20H::setYHighInterruptEnabled(bool enabled) {
  * @see L3GD20H_YHIE_BIT
  */
 bool L3GD20H::getYHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_YHIE_BIT, 
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_YHIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1307,7 +1294,7 @@ bool L3GD20H::getYHighInterruptEnabled() {
  * @see L3GD20H_YLIE_BIT
  */
 void L3GD20H::setYLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_YLIE_BIT, enabled);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_YLIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for Y low is enabled
@@ -1316,8 +1303,7 @@ void L3GD20H::setYLowInterruptEnabled(bool enabled) {
  * @see L3GD20H_YLIE_BIT
  */
 bool L3GD20H::getYLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_YLIE_BIT, 
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_YLIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1327,7 +1313,7 @@ bool L3GD20H::getYLowInterruptEnabled() {
  * @see L3GD20H_XHIE_BIT
  */
 void L3GD20H::setXHighInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_XHIE_BIT, enabled);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_XHIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for X high is enabled
@@ -1336,8 +1322,7 @@ void L3GD20H::setXHighInterruptEnabled(bool enabled) {
  * @see L3GD20H_XHIE_BIT
  */
 bool L3GD20H::getXHighInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_XHIE_BIT, 
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_XHIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1347,7 +1332,7 @@ bool L3GD20H::getXHighInterruptEnabled() {
  * @see L3GD20H_XLIE_BIT
  */
 void L3GD20H::setXLowInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_XLIE_BIT, enabled);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_XLIE_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt for X low is enabled
@@ -1356,8 +1341,7 @@ void L3GD20H::setXLowInterruptEnabled(bool enabled) {
  * @see L3GD20H_XLIE_BIT
  */
 bool L3GD20H::getXLowInterruptEnabled() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_CFG, L3GD20H_XLIE_BIT, 
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_CFG, L3GD20H_XLIE_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1369,8 +1353,7 @@ bool L3GD20H::getXLowInterruptEnabled() {
  * @see L3GD20H_IA_BIT
  */
 bool L3GD20H::getInterruptActive() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_SRC, L3GD20H_IA_BIT,
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_SRC, L3GD20H_IA_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1380,8 +1363,7 @@ bool L3GD20H::getInterruptActive() {
  * @see L3GD20H_ZH_BIT
  */
 bool L3GD20H::getZHigh() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_SRC, L3GD20H_ZH_BIT,
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_SRC, L3GD20H_ZH_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1391,8 +1373,7 @@ bool L3GD20H::getZHigh() {
  * @see L3GD20H_ZL_BIT
  */
 bool L3GD20H::getZLow() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_SRC, L3GD20H_ZL_BIT,
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_SRC, L3GD20H_ZL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1402,8 +1383,7 @@ bool L3GD20H::getZLow() {
  * @see L3GD20H_YH_BIT
  */
 bool L3GD20H::getYHigh() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_SRC, L3GD20H_YH_BIT,
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_SRC, L3GD20H_YH_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1413,8 +1393,7 @@ bool L3GD20H::getYHigh() {
  * @see L3GD20H_YL_BIT
  */
 bool L3GD20H::getYLow() {
-   	I2Cdev::readBit(devAddr, L3GD20H_RA_IG_SRC, L3GD20H_YL_BIT,
-        buffer);
+   	I2CdevField<L3GD20H_RA_IG_SRC, L3GD20H_YL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1424,8 +1403,7 @@ bool L3GD20H::getYLow() {
  * @see L3GD20H_XH_BIT
  */
 bool L3GD20H::getXHigh() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_SRC, L3GD20H_XH_BIT,
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_SRC, L3GD20H_XH_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1435,8 +1413,7 @@ bool L3GD20H::getXHigh() {
  * @see L3GD20H_XL_BIT
  */
 bool L3GD20H::getXLow() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_SRC, L3GD20H_XL_BIT,
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_SRC, L3GD20H_XL_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1450,7 +1427,7 @@ bool L3GD20H::getXLow() {
  * @see L3GD20H_DCRM_DEC
  */
 void L3GD20H::setDecrementMode(bool mode) {
-    I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_THS_XH, L3GD20H_DCRM_BIT, mode);
+    I2CdevField<L3GD20H_RA_IG_THS_XH, L3GD20H_DCRM_BIT>::write(devAddr, mode);
 }
 
 /** Get the interrupt generation counter mode selection.
@@ -1461,8 +1438,7 @@ void L3GD20H::setDecrementMode(bool mode) {
  * @see L3GD20H_DCRM_DEC
  */
 bool L3GD20H::getDecrementMode() {
-    I2Cdev::readBit(devAddr, L3GD20H_RA_IG_THS_XH, L3GD20H_DCRM_BIT, 
-        buffer);
+    I2CdevField<L3GD20H_RA_IG_THS_XH, L3GD20H_DCRM_BIT>::read(devAddr, buffer);
     return buffer[0];
 }
 
@@ -1579,8 +1555,7 @@ uint8_t L3GD20H::getZLowThreshold() {
  * @see L3GD20H_DUR_LENGTH
  */
 void L3GD20H::setDuration(uint8_t duration) {
-	I2Cdev::writeBits(devAddr, L3GD20H_RA_IG_DURATION, L3GD20H_DUR_BIT,
-		L3GD20H_DUR_LENGTH, duration);
+	I2CdevField<L3GD20H_RA_IG_DURATION, L3GD20H_DUR_BIT, L3GD20H_DUR_LENGTH>::write(devAddr, duration);
 }
 
 /** Get the minimum duration for an interrupt event to be recognized
@@ -1590,8 +1565,7 @@ void L3GD20H::setDuration(uint8_t duration) {
  * @see L3GD20H_DUR_LENGTH
  */
 uint8_t L3GD20H::getDuration() {
-	I2Cdev::readBits(devAddr, L3GD20H_RA_IG_DURATION, 
-		L3GD20H_DUR_BIT, L3GD20H_DUR_LENGTH, buffer);
+	I2CdevField<L3GD20H_RA_IG_DURATION, L3GD20H_DUR_BIT, L3GD20H_DUR_LENGTH>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1605,8 +1579,7 @@ uint8_t L3GD20H::getDuration() {
  * @see L3GD20H_WAIT_BIT
  */
 void L3GD20H::setWaitEnabled(bool enabled) {
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_IG_DURATION, L3GD20H_WAIT_BIT,
-		enabled);
+	I2CdevField<L3GD20H_RA_IG_DURATION, L3GD20H_WAIT_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the interrupt wait feature is enabled
@@ -1615,8 +1588,7 @@ void L3GD20H::setWaitEnabled(bool enabled) {
  * @see L3GD20H_WAIT_BIT
  */
 bool L3GD20H::getWaitEnabled() {
-	I2Cdev::readBit(devAddr, L3GD20H_RA_IG_DURATION, 
-		L3GD20H_WAIT_BIT, buffer);
+	I2CdevField<L3GD20H_RA_IG_DURATION, L3GD20H_WAIT_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1629,8 +1601,7 @@ bool L3GD20H::getWaitEnabled() {
  * @see L3GD20H_DRDY_HL_BIT
  */
 void L3GD20H::setINT2DataReadyActiveLowEnabled(bool enabled){
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_LOW_ODR, L3GD20H_DRDY_HL_BIT,
-		enabled);
+	I2CdevField<L3GD20H_RA_LOW_ODR, L3GD20H_DRDY_HL_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the DRDY/INT2 pin is active low. If true then the  
@@ -1639,8 +1610,7 @@ void L3GD20H::setINT2DataReadyActiveLowEnabled(bool enabled){
  * @see L3GD20H_I2C_DIS_BIT
  */
 bool L3GD20H::getINT2DataReadyActiveLowEnabled(){
-	I2Cdev::readBit(devAddr, L3GD20H_RA_LOW_ODR, 
-		L3GD20H_DRDY_HL_BIT, buffer);
+	I2CdevField<L3GD20H_RA_LOW_ODR, L3GD20H_DRDY_HL_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1650,8 +1620,7 @@ bool L3GD20H::getINT2DataReadyActiveLowEnabled(){
  * @see L3GD20H_I2C_DIS_BIT
  */
 void L3GD20H::setSPIOnlyEnabled(bool enabled){
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_LOW_ODR, L3GD20H_I2C_DIS_BIT,
-		enabled);
+	I2CdevField<L3GD20H_RA_LOW_ODR, L3GD20H_I2C_DIS_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether only the SPI interface is enabled (i.e., I2C interface disabled)
@@ -1659,8 +1628,7 @@ void L3GD20H::setSPIOnlyEnabled(bool enabled){
  * @see L3GD20H_I2C_DIS_BIT
  */
 bool L3GD20H::getSPIOnlyEnabled(){
-	I2Cdev::readBit(devAddr, L3GD20H_RA_LOW_ODR, 
-		L3GD20H_I2C_DIS_BIT, buffer);
+	I2CdevField<L3GD20H_RA_LOW_ODR, L3GD20H_I2C_DIS_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
 
@@ -1670,8 +1638,7 @@ bool L3GD20H::getSPIOnlyEnabled(){
  * @see L3GD20H_SW_RESET_BIT
  */
 void L3GD20H::setSoftwareReset(bool reset){
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_LOW_ODR, L3GD20H_SW_RESET_BIT,
-		reset);
+	I2CdevField<L3GD20H_RA_LOW_ODR, L3GD20H_SW_RESET_BIT>::write(devAddr, reset);
 }
 
 /** Set whether the low output data rate is enabled.
@@ -1680,8 +1647,7 @@ void L3GD20H::setSoftwareReset(bool reset){
  * @see L3GD20H_LOW_ODR_BIT
  */
 void L3GD20H::setLowODREnabled(bool enabled){
-	I2Cdev::writeBit(devAddr, L3GD20H_RA_LOW_ODR, L3GD20H_LOW_ODR_BIT,
-		enabled);
+	I2CdevField<L3GD20H_RA_LOW_ODR, L3GD20H_LOW_ODR_BIT>::write(devAddr, enabled);
 }
 
 /** Get whether the low output data rate is enabled.
@@ -1689,7 +1655,6 @@ void L3GD20H::setLowODREnabled(bool enabled){
  * @see L3GD20H_LOW_ODR_BIT
  */
 bool L3GD20H::getLowODREnabled(){
-	I2Cdev::readBit(devAddr, L3GD20H_RA_LOW_ODR, 
-		L3GD20H_LOW_ODR_BIT, buffer);
+	I2CdevField<L3GD20H_RA_LOW_ODR, L3GD20H_LOW_ODR_BIT>::read(devAddr, buffer);
 	return buffer[0];
 }
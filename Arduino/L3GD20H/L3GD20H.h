@@ -311,6 +311,7 @@ class L3GD20H {
 
         // OUT_* registers, read-only
         void getAngularVelocity(int16_t* x, int16_t* y, int16_t* z);
+        uint8_t readFIFO(int16_t *samples, uint8_t max);
         int16_t getAngularVelocityX();
 		int16_t getAngularVelocityY();
 		int16_t getAngularVelocityZ();
@@ -31,6 +31,7 @@ THE SOFTWARE.
 */
 
 #include "LSM303DLHC.h"
+#include "helper_field.h"
 
 /** Default constructor, uses default I2C address.
  * @see LSM303DLHC_DEFAULT_ADDRESS_A
@@ -162,8 +163,7 @@ void LSM303DLHC::setAccelOutputDataRate(uint16_t rate) {
     writeVal = LSM303DLHC_ODR_RATE_1344_N_5376_LP;
   }
   
-  I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ODR_BIT,
-    LSM303DLHC_ODR_LENGTH, writeVal); 
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ODR_BIT, LSM303DLHC_ODR_LENGTH>::write(devAddrA, writeVal); 
 }
 
 /** Get the output data rate
@@ -182,8 +182,7 @@ void LSM303DLHC::setAccelOutputDataRate(uint16_t rate) {
  * @see LSM303DLHC_RATE_1344_N_5376_LP
  */
 uint16_t LSM303DLHC::getAccelOutputDataRate() {
-  I2Cdev::readBits(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ODR_BIT,
-    LSM303DLHC_ODR_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ODR_BIT, LSM303DLHC_ODR_LENGTH>::read(devAddrA, buffer);
   uint8_t rate = buffer[0];
   
   if (rate == LSM303DLHC_ODR_RATE_POWERDOWN) {
@@ -217,7 +216,7 @@ uint16_t LSM303DLHC::getAccelOutputDataRate() {
 @see LSM303DLHC_LPEN_BIT
 */
 void LSM303DLHC::setAccelLowPowerEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_LPEN_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_LPEN_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the accelerometer low power mode is enabled
@@ -226,7 +225,7 @@ void LSM303DLHC::setAccelLowPowerEnabled(bool enabled){
 @see LSM303DLHC_LPEN_BIT
 */
 bool LSM303DLHC::getAccelLowPowerEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_LPEN_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_LPEN_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -236,7 +235,7 @@ bool LSM303DLHC::getAccelLowPowerEnabled(){
  * @see LSM303DLHC_ZEN_BIT
  */
 void LSM303DLHC::setAccelZEnabled(bool enabled) {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ZEN_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ZEN_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether Z axis data is enabled
@@ -245,7 +244,7 @@ void LSM303DLHC::setAccelZEnabled(bool enabled) {
  * @see LSM303DLHC_ZEN_BIT
  */
 bool LSM303DLHC::getAccelZEnabled() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ZEN_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_ZEN_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -255,7 +254,7 @@ bool LSM303DLHC::getAccelZEnabled() {
  * @see LSM303DLHC_YEN_BIT
  */
 void LSM303DLHC::setAccelYEnabled(bool enabled) {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_YEN_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_YEN_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether Y axis data is enabled
@@ -264,7 +263,7 @@ void LSM303DLHC::setAccelYEnabled(bool enabled) {
  * @see LSM303DLHC_YEN_BIT
  */
 bool LSM303DLHC::getAccelYEnabled() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_YEN_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_YEN_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -274,7 +273,7 @@ bool LSM303DLHC::getAccelYEnabled() {
  * @see LSM303DLHC_XEN_BIT
  */
 void LSM303DLHC::setAccelXEnabled(bool enabled) {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_XEN_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_XEN_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether X axis data is enabled
@@ -283,7 +282,7 @@ void LSM303DLHC::setAccelXEnabled(bool enabled) {
  * @see LSM303DLHC_XEN_BIT
  */
 bool LSM303DLHC::getAccelXEnabled() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_XEN_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG1_A, LSM303DLHC_XEN_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -300,8 +299,7 @@ bool LSM303DLHC::getAccelXEnabled() {
  * @see LSM303DLHC_HPM_AUTORESET
  */
 void LSM303DLHC::setAccelHighPassMode(uint8_t mode) {
-  I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPM_BIT, 
-    LSM303DLHC_HPM_LENGTH, mode);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPM_BIT, LSM303DLHC_HPM_LENGTH>::write(devAddrA, mode);
 }
 
 /** Get the high pass mode
@@ -315,8 +313,7 @@ void LSM303DLHC::setAccelHighPassMode(uint8_t mode) {
  * @see LSM303DLHC_HPM_AUTORESET
  */
 uint8_t LSM303DLHC::getAccelHighPassMode() {
-  I2Cdev::readBits(devAddrA, LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPM_BIT, 
-    LSM303DLHC_HPM_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPM_BIT, LSM303DLHC_HPM_LENGTH>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -331,8 +328,7 @@ uint8_t LSM303DLHC::getAccelHighPassMode() {
  * @see LSM303DLHC_HPCF4
  */
 void LSM303DLHC::setAccelHighPassFilterCutOffFrequencyLevel(uint8_t level) {
-  I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPCF_BIT, 
-    LSM303DLHC_HPCF_LENGTH, level);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPCF_BIT, LSM303DLHC_HPCF_LENGTH>::write(devAddrA, level);
 }
 
 /** Get the high pass filter cut off frequency level (1 - 10)
@@ -346,8 +342,7 @@ void LSM303DLHC::setAccelHighPassFilterCutOffFrequencyLevel(uint8_t level) {
  * @see LSM303DLHC_HPCF4
  */
 uint8_t LSM303DLHC::getAccelHighPassFilterCutOffFrequencyLevel() {
-  I2Cdev::readBits(devAddrA, LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPCF_BIT, 
-    LSM303DLHC_HPCF_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG2_A, LSM303DLHC_HPCF_BIT, LSM303DLHC_HPCF_LENGTH>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -359,7 +354,7 @@ uint8_t LSM303DLHC::getAccelHighPassFilterCutOffFrequencyLevel() {
 @see LSM303DLHC_I1_CLICK_BIT
 */
 void LSM303DLHC::setAccelINT1ClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_CLICK_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_CLICK_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the Click interrupt is routed to the INT1 pin.
@@ -368,7 +363,7 @@ void LSM303DLHC::setAccelINT1ClickEnabled(bool enabled){
 @see LSM303DLHC_I1_CLICK_BIT
 */
 bool LSM303DLHC::getAccelINT1ClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_CLICK_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_CLICK_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -378,7 +373,7 @@ bool LSM303DLHC::getAccelINT1ClickEnabled(){
 @see LSM303DLHC_I1_AOI1_BIT
 */
 void LSM303DLHC::setAccelINT1AOI1Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI1_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI1_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the AOR1 interrupt is routed to the INT1 pin.
@@ -387,7 +382,7 @@ void LSM303DLHC::setAccelINT1AOI1Enabled(bool enabled){
 @see LSM303DLHC_I1_AOI1_BIT
 */
 bool LSM303DLHC::getAccelINT1AOI1Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI1_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI1_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -397,7 +392,7 @@ bool LSM303DLHC::getAccelINT1AOI1Enabled(){
 @see LSM303DLHC_I1_AOI2_BIT
 */
 void LSM303DLHC::setAccelINT1AOI2Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI2_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI2_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the AOR2 interrupt is routed to the INT1 pin.
@@ -406,7 +401,7 @@ void LSM303DLHC::setAccelINT1AOI2Enabled(bool enabled){
 @see LSM303DLHC_I1_AOI2_BIT
 */
 bool LSM303DLHC::getAccelINT1AOI2Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI2_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_AOI2_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -416,7 +411,7 @@ bool LSM303DLHC::getAccelINT1AOI2Enabled(){
 @see LSM303DLHC_I1_DRDY1_BIT
 */
 void LSM303DLHC::setAccelINT1DataReady1Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY1_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY1_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the Data Ready 1 interrupt is routed to the INT1 pin.
@@ -425,7 +420,7 @@ void LSM303DLHC::setAccelINT1DataReady1Enabled(bool enabled){
 @see LSM303DLHC_I1_DRDY1_BIT
 */
 bool LSM303DLHC::getAccelINT1DataReady1Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY1_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY1_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -435,7 +430,7 @@ bool LSM303DLHC::getAccelINT1DataReady1Enabled(){
 @see LSM303DLHC_I1_DRDY2_BIT
 */
 void LSM303DLHC::setAccelINT1DataReady2Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY2_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY2_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the Data Ready 2 interrupt is routed to the INT1 pin.
@@ -444,7 +439,7 @@ void LSM303DLHC::setAccelINT1DataReady2Enabled(bool enabled){
 @see LSM303DLHC_I1_DRDY2_BIT
 */
 bool LSM303DLHC::getAccelINT1DataReady2Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY2_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_DRDY2_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -454,7 +449,7 @@ bool LSM303DLHC::getAccelINT1DataReady2Enabled(){
 @see LSM303DLHC_I1_WTM_BIT
 */
 void LSM303DLHC::setAccelINT1FIFOWatermarkEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_WTM_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_WTM_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the FIFO watermark interrupt is routed to the INT1 pin.
@@ -463,7 +458,7 @@ void LSM303DLHC::setAccelINT1FIFOWatermarkEnabled(bool enabled){
 @see LSM303DLHC_I1_WTM_BIT
 */
 bool LSM303DLHC::getAccelINT1FIFOWatermarkEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_WTM_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_WTM_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -473,7 +468,7 @@ bool LSM303DLHC::getAccelINT1FIFOWatermarkEnabled(){
 @see LSM303DLHC_I1_OVERRUN_BIT
 */
 void LSM303DLHC::setAccelINT1FIFOOverunEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_OVERRUN_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_OVERRUN_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the FIFO overrun interrupt is routed to the INT1 pin.
@@ -482,7 +477,7 @@ void LSM303DLHC::setAccelINT1FIFOOverunEnabled(bool enabled){
 @see LSM303DLHC_I1_OVERRUN_BIT
 */
 bool LSM303DLHC::getAccelINT1FIFOOverunEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_OVERRUN_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG3_A, LSM303DLHC_I1_OVERRUN_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -494,7 +489,7 @@ bool LSM303DLHC::getAccelINT1FIFOOverunEnabled(){
  * @see LSM303DLHC_BDU_BIT
  */
 void LSM303DLHC::setAccelBlockDataUpdateEnabled(bool enabled) {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BDU_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BDU_BIT>::write(devAddrA, enabled);
 }
 
 /** Get the BDU enabled state
@@ -503,7 +498,7 @@ void LSM303DLHC::setAccelBlockDataUpdateEnabled(bool enabled) {
  * @see LSM303DLHC_BDU_BIT
  */
 bool LSM303DLHC::getAccelBlockDataUpdateEnabled() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BDU_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BDU_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -518,8 +513,7 @@ bool LSM303DLHC::getAccelBlockDataUpdateEnabled() {
  * @see LSM303DLHC_LITTLE_ENDIAN
  */
 void LSM303DLHC::setAccelEndianMode(bool endianness) {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BLE_BIT, 
-    endianness);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BLE_BIT>::write(devAddrA, endianness);
   endianMode = getAccelEndianMode();
 }
 
@@ -532,8 +526,7 @@ void LSM303DLHC::setAccelEndianMode(bool endianness) {
  */
 bool LSM303DLHC::getAccelEndianMode() {
   return endianMode;
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BLE_BIT,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_BLE_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -560,8 +553,7 @@ void LSM303DLHC::setAccelFullScale(uint8_t scale) {
     writeBits = LSM303DLHC_FS_16;
   }
 
-  I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_FS_BIT, 
-    LSM303DLHC_FS_LENGTH, writeBits);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_FS_BIT, LSM303DLHC_FS_LENGTH>::write(devAddrA, writeBits);
 }
 
 /** Get the current full scale of the output data (in dps)
@@ -575,8 +567,7 @@ void LSM303DLHC::setAccelFullScale(uint8_t scale) {
  * @see LSM303DLHC_FS_16
  */
 uint8_t LSM303DLHC::getAccelFullScale() {
-  I2Cdev::readBits(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, 
-    LSM303DLHC_FS_BIT, LSM303DLHC_FS_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_FS_BIT, LSM303DLHC_FS_LENGTH>::read(devAddrA, buffer);
   uint8_t readBits = buffer[0];
   
   if (readBits == LSM303DLHC_FS_2) {
@@ -596,8 +587,7 @@ uint8_t LSM303DLHC::getAccelFullScale() {
 @see LSM303DLHC_HR_BIT
 */
 void LSM303DLHC::setAccelHighResOutputEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_HR_BIT,
-    enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_HR_BIT>::write(devAddrA, enabled);
 }
 
 /*Gets whether high resolution output is enabled.
@@ -606,8 +596,7 @@ void LSM303DLHC::setAccelHighResOutputEnabled(bool enabled){
 @see LSM303DLHC_HR_BIT
 */
 bool LSM303DLHC::getAccelHighResOutputEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_HR_BIT,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_HR_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -619,7 +608,7 @@ bool LSM303DLHC::getAccelHighResOutputEnabled(){
  * @see LSM303DLHC_SIM_3W
  */
 void LSM303DLHC::setAccelSPIMode(bool mode) {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_SIM_BIT, mode);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_SIM_BIT>::write(devAddrA, mode);
 }
 
 /** Get the SPI mode
@@ -630,8 +619,7 @@ void LSM303DLHC::setAccelSPIMode(bool mode) {
  * @see LSM303DLHC_SIM_3W
  */
 bool LSM303DLHC::getAccelSPIMode() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_SIM_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG4_A, LSM303DLHC_SIM_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -642,7 +630,7 @@ bool LSM303DLHC::getAccelSPIMode() {
  * @see LSM303DLHC_BOOT_BIT
  */
 void LSM303DLHC::rebootAccelMemoryContent() {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_BOOT_BIT, true);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_BOOT_BIT>::write(devAddrA, true);
 }
 
 /** Set whether the FIFO buffer is enabled
@@ -651,8 +639,7 @@ void LSM303DLHC::rebootAccelMemoryContent() {
  * @see LSM303DLHC_FIFO_EN_BIT
  */
 void LSM303DLHC::setAccelFIFOEnabled(bool enabled) {
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_FIFO_EN_BIT, 
-    enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_FIFO_EN_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the FIFO buffer is enabled
@@ -661,8 +648,7 @@ void LSM303DLHC::setAccelFIFOEnabled(bool enabled) {
  * @see LSM303DLHC_FIFO_EN_BIT
  */
 bool LSM303DLHC::getAccelFIFOEnabled() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_FIFO_EN_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_FIFO_EN_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -672,8 +658,7 @@ bool LSM303DLHC::getAccelFIFOEnabled() {
 @see LSM303DLHC_LIR_INT1_BIT
 */
 void LSM303DLHC::setAccelInterrupt1RequestLatched(bool latched){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT1_BIT, 
-    latched);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT1_BIT>::write(devAddrA, latched);
 }
 
 /*Get whether latching of interrupt request 1 is enabled.
@@ -682,8 +667,7 @@ void LSM303DLHC::setAccelInterrupt1RequestLatched(bool latched){
 @see LSM303DLHC_LIR_INT1_BIT
 */
 bool LSM303DLHC::getAccelInterrupt1RequestLatched(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT1_BIT,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT1_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -693,8 +677,7 @@ bool LSM303DLHC::getAccelInterrupt1RequestLatched(){
 @see LSM303DLHC_LIR_INT2_BIT
 */
 void LSM303DLHC::setAccelInterrupt2RequestLatched(bool latched){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT2_BIT,
-    latched);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT2_BIT>::write(devAddrA, latched);
 }
 
 /*Get whether latching of interrupt request 2 is enabled.
@@ -703,8 +686,7 @@ void LSM303DLHC::setAccelInterrupt2RequestLatched(bool latched){
 @see LSM303DLHC_LIR_INT2_BIT
 */
 bool LSM303DLHC::getAccelInterrupt2RequestLatched(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT2_BIT,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_LIR_INT2_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -714,8 +696,7 @@ bool LSM303DLHC::getAccelInterrupt2RequestLatched(){
 @see LSM303DLHC_D4D_INT1_BIT
 */
 void LSM303DLHC::setAccelDetect4DInterrupt1Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT1_BIT,
-    enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT1_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether 4D detection interrupt 1 is enabled.
@@ -724,8 +705,7 @@ void LSM303DLHC::setAccelDetect4DInterrupt1Enabled(bool enabled){
 @see LSM303DLHC_D4D_INT1_BIT
 */
 bool LSM303DLHC::getAccelDetect4DInterrupt1Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT1_BIT,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT1_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -735,8 +715,7 @@ bool LSM303DLHC::getAccelDetect4DInterrupt1Enabled(){
 @see LSM303DLHC_D4D_INT2_BIT
 */
 void LSM303DLHC::setAccelDetect4DInterrupt2Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT2_BIT,
-    enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT2_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether 4D detection interrupt 2 is enabled.
@@ -745,8 +724,7 @@ void LSM303DLHC::setAccelDetect4DInterrupt2Enabled(bool enabled){
 @see LSM303DLHC_D4D_INT2_BIT
 */
 bool LSM303DLHC::getAccelDetect4DInterrupt2Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT2_BIT,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG5_A, LSM303DLHC_D4D_INT2_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -759,7 +737,7 @@ bool LSM303DLHC::getAccelDetect4DInterrupt2Enabled(){
 @see LSM303DLHC_I2_CLICK_BIT
 */
 void LSM303DLHC::setAccelINT2ClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_CLICK_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_CLICK_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether the Click interrupt is routed to the INT2 pin.
@@ -768,7 +746,7 @@ void LSM303DLHC::setAccelINT2ClickEnabled(bool enabled){
 @see LSM303DLHC_I2_CLICK_BIT
 */
 bool LSM303DLHC::getAccelINT2ClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_CLICK_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_CLICK_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -778,7 +756,7 @@ bool LSM303DLHC::getAccelINT2ClickEnabled(){
 @see LSM303DLHC_I2_INT1_BIT
 */
 void LSM303DLHC::setAccelINT2Interrupt1Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT1_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT1_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether interrupt 1 is routed to the INT2 pin.
@@ -787,7 +765,7 @@ void LSM303DLHC::setAccelINT2Interrupt1Enabled(bool enabled){
 @see LSM303DLHC_I2_INT1_BIT
 */
 bool LSM303DLHC::getAccelINT2Interrupt1Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT1_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT1_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -797,7 +775,7 @@ bool LSM303DLHC::getAccelINT2Interrupt1Enabled(){
 @see LSM303DLHC_I2_INT2_BIT
 */
 void LSM303DLHC::setAccelINT2Interrupt2Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT2_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT2_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether interrupt 2 is routed to the INT2 pin.
@@ -806,7 +784,7 @@ void LSM303DLHC::setAccelINT2Interrupt2Enabled(bool enabled){
 @see LSM303DLHC_I2_INT2_BIT
 */
 bool LSM303DLHC::getAccelINT2Interrupt2Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT2_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_I2_INT2_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -816,7 +794,7 @@ bool LSM303DLHC::getAccelINT2Interrupt2Enabled(){
 @see LSM303DLHC_BOOT_I1_BIT
 */
 void LSM303DLHC::setAccelRebootMemoryContentINT2Enabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_BOOT_I1_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_BOOT_I1_BIT>::write(devAddrA, enabled);
 } 
 
 /*Get whether memory content reboot is enabled via INT2 pin
@@ -825,7 +803,7 @@ void LSM303DLHC::setAccelRebootMemoryContentINT2Enabled(bool enabled){
 @see LSM303DLHC_BOOT_I1_BIT
 */
 bool LSM303DLHC::getAccelRebootMemoryContentINT2Enabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_BOOT_I1_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_BOOT_I1_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -841,7 +819,7 @@ bool LSM303DLHC::getAccelRebootMemoryContentINT2Enabled(){
 @see LSM303DLHC_H_ACTIVE_BIT
 */
 void LSM303DLHC::setAccelInterruptActiveLowEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_H_ACTIVE_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_H_ACTIVE_BIT>::write(devAddrA, enabled);
 }
 
 /*Get whether active low interrupts are enabled.
@@ -850,7 +828,7 @@ void LSM303DLHC::setAccelInterruptActiveLowEnabled(bool enabled){
 @see LSM303DLHC_H_ACTIVE_BIT
 */
 bool LSM303DLHC::getAccelInterruptActiveLowEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_H_ACTIVE_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CTRL_REG6_A, LSM303DLHC_H_ACTIVE_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -882,8 +860,7 @@ uint8_t LSM303DLHC::getAccelInterruptReference() {
  * @see LSM303DLHC_ZYXOR_BIT
  */
 bool LSM303DLHC::getAccelXYZOverrun() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZYXOR_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZYXOR_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -894,8 +871,7 @@ bool LSM303DLHC::getAccelXYZOverrun() {
  * @see LSM303DLHC_ZOR_BIT
  */
 bool LSM303DLHC::getAccelZOverrun() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZOR_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZOR_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -906,8 +882,7 @@ bool LSM303DLHC::getAccelZOverrun() {
  * @see LSM303DLHC_YOR_BIT
  */
 bool LSM303DLHC::getAccelYOverrun() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_YOR_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_YOR_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -918,8 +893,7 @@ bool LSM303DLHC::getAccelYOverrun() {
  * @see LSM303DLHC_XOR_BIT
  */
 bool LSM303DLHC::getAccelXOverrun() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_XOR_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_XOR_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -929,8 +903,7 @@ bool LSM303DLHC::getAccelXOverrun() {
  * @see LSM303DLHC_ZYXDA_BIT
  */
 bool LSM303DLHC::getAccelXYZDataAvailable() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZYXDA_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZYXDA_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -940,8 +913,7 @@ bool LSM303DLHC::getAccelXYZDataAvailable() {
  * @see LSM303DLHC_ZDA_BIT
  */
 bool LSM303DLHC::getAccelZDataAvailable() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZDA_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_ZDA_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -951,8 +923,7 @@ bool LSM303DLHC::getAccelZDataAvailable() {
  * @see LSM303DLHC_YDA_BIT
  */
 bool LSM303DLHC::getAccelYDataAvailable() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_YDA_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_YDA_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -962,8 +933,7 @@ bool LSM303DLHC::getAccelYDataAvailable() {
  * @see LSM303DLHC_XDA_BIT
  */
 bool LSM303DLHC::getAccelXDataAvailable() {
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_XDA_BIT, 
-    buffer);
+  I2CdevField<LSM303DLHC_RA_STATUS_REG_A, LSM303DLHC_XDA_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1049,8 +1019,7 @@ int16_t LSM303DLHC::getAccelerationZ() {
  * @see LSM303DLHC_FM_TRIGGER
  */
 void LSM303DLHC::setAccelFIFOMode(uint8_t mode) {
-  I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_FM_BIT, 
-    LSM303DLHC_FM_LENGTH, mode);
+  I2CdevField<LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_FM_BIT, LSM303DLHC_FM_LENGTH>::write(devAddrA, mode);
 }
 
 /** Get the FIFO mode to one of the defined modes
@@ -1064,8 +1033,7 @@ void LSM303DLHC::setAccelFIFOMode(uint8_t mode) {
  * @see LSM303DLHC_FM_TRIGGER
  */
 uint8_t LSM303DLHC::getAccelFIFOMode() {
-  I2Cdev::readBits(devAddrA, LSM303DLHC_RA_FIFO_CTRL_REG_A, 
-    LSM303DLHC_FM_BIT, LSM303DLHC_FM_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_FM_BIT, LSM303DLHC_FM_LENGTH>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1077,8 +1045,7 @@ uint8_t LSM303DLHC::getAccelFIFOMode() {
 @see LSM303DLHC_TR_INT2
 */
 void LSM303DLHC::setAccelFIFOTriggerINT(bool trigger){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_FIFO_CTRL_REG_A,
-    LSM303DLHC_TR_BIT, trigger);
+  I2CdevField<LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_TR_BIT>::write(devAddrA, trigger);
 }
 
 /*Get the trigger selection (INT1 or INT2)
@@ -1089,8 +1056,7 @@ void LSM303DLHC::setAccelFIFOTriggerINT(bool trigger){
 @see LSM303DLHC_TR_INT2
 */
 bool LSM303DLHC::getAccelFIFOTriggerINT(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_FIFO_CTRL_REG_A,
-    LSM303DLHC_TR_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_TR_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1101,8 +1067,7 @@ bool LSM303DLHC::getAccelFIFOTriggerINT(){
  * @see LSM303DLHC_FTH_LENGTH
  */
 void LSM303DLHC::setAccelFIFOThreshold(uint8_t wtm) {
-    I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_FTH_BIT, 
-        LSM303DLHC_FTH_LENGTH, wtm);
+    I2CdevField<LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_FTH_BIT, LSM303DLHC_FTH_LENGTH>::write(devAddrA, wtm);
 }
 
 /** Get the FIFO watermark threshold
@@ -1112,8 +1077,7 @@ void LSM303DLHC::setAccelFIFOThreshold(uint8_t wtm) {
  * @see LSM303DLHC_FTH_LENGTH
  */
 uint8_t LSM303DLHC::getAccelFIFOThreshold() {
-    I2Cdev::readBits(devAddrA, LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_FTH_BIT,
-        LSM303DLHC_FTH_LENGTH, buffer);
+    I2CdevField<LSM303DLHC_RA_FIFO_CTRL_REG_A, LSM303DLHC_FTH_BIT, LSM303DLHC_FTH_LENGTH>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1128,8 +1092,7 @@ uint8_t LSM303DLHC::getAccelFIFOThreshold() {
  * @see LSM303DLHC_WTM_BIT
  */
 bool LSM303DLHC::getAccelFIFOAtWatermark() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_FIFO_SRC_REG_A, LSM303DLHC_WTM_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_FIFO_SRC_REG_A, LSM303DLHC_WTM_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1139,8 +1102,7 @@ bool LSM303DLHC::getAccelFIFOAtWatermark() {
  * @see LSM303DLHC_OVRN_FIFO_BIT
  */
 bool LSM303DLHC::getAccelFIFOOverrun() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_FIFO_SRC_REG_A, 
-        LSM303DLHC_OVRN_FIFO_BIT, buffer);
+    I2CdevField<LSM303DLHC_RA_FIFO_SRC_REG_A, LSM303DLHC_OVRN_FIFO_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1150,8 +1112,7 @@ bool LSM303DLHC::getAccelFIFOOverrun() {
  * @see LSM303DLHC_EMPTY_BIT
  */
 bool LSM303DLHC::getAccelFIFOEmpty() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_FIFO_SRC_REG_A,
-        LSM303DLHC_EMPTY_BIT, buffer);
+    I2CdevField<LSM303DLHC_RA_FIFO_SRC_REG_A, LSM303DLHC_EMPTY_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1162,11 +1123,56 @@ bool LSM303DLHC::getAccelFIFOEmpty() {
  * @see LSM303DLHC_FSS_LENGTH
  */ 
 uint8_t LSM303DLHC::getAccelFIFOStoredSamples() {
-    I2Cdev::readBits(devAddrA, LSM303DLHC_RA_FIFO_SRC_REG_A, 
-        LSM303DLHC_FSS_BIT, LSM303DLHC_FSS_LENGTH, buffer);
+    I2CdevField<LSM303DLHC_RA_FIFO_SRC_REG_A, LSM303DLHC_FSS_BIT, LSM303DLHC_FSS_LENGTH>::read(devAddrA, buffer);
     return buffer[0];
 }
 
+/** Drain stored acceleration samples from the FIFO buffer
+ * FIFO_SRC_REG_A is read once to find the stored data level, then all frames
+ * are read back-to-back from OUT_X_L_A with the register auto-increment bit
+ * (0x80) set. In FIFO and stream modes the address pointer wraps from
+ * OUT_Z_H_A back to OUT_X_L_A and pops the next entry, so the whole level
+ * comes out in a single burst; the burst is only split (on whole-frame
+ * boundaries) when the bus buffer is smaller than the data.
+ * @param samples Buffer for X/Y/Z triplets, must hold 3 * max values
+ * @param max Maximum number of samples to read
+ * @return Number of samples read (0 if the FIFO is empty or on bus error)
+ * @see LSM303DLHC_RA_FIFO_SRC_REG_A
+ * @see LSM303DLHC_RA_OUT_X_L_A
+ */
+uint8_t LSM303DLHC::readAccelFIFO(int16_t *samples, uint8_t max) {
+    uint8_t src;
+    if (I2Cdev::readByte(devAddrA, LSM303DLHC_RA_FIFO_SRC_REG_A, &src) != 1) return 0;
+    if (src & (1 << LSM303DLHC_EMPTY_BIT)) return 0;
+
+    // FSS tops out at 31, overrun means all 32 slots are full
+    uint8_t level = (src >> (LSM303DLHC_FSS_BIT - LSM303DLHC_FSS_LENGTH + 1))
+        & ((1 << LSM303DLHC_FSS_LENGTH) - 1);
+    if (src & (1 << LSM303DLHC_OVRN_FIFO_BIT)) level = 32;
+    if (level > max) level = max;
+
+    uint8_t *raw = (uint8_t *)samples;
+    uint8_t count = 0;
+    while (count < level) {
+        uint8_t frames = level - count;
+        if (frames > I2CDEVLIB_WIRE_BUFFER_LENGTH / 6) frames = I2CDEVLIB_WIRE_BUFFER_LENGTH / 6;
+        if ((uint8_t)I2Cdev::readBytes(devAddrA, LSM303DLHC_RA_OUT_X_L_A | 0x80, frames * 6,
+            raw + count * 6) != frames * 6) break;
+        count += frames;
+    }
+
+    for (uint16_t i = 0; i < count * 3; i++) {
+        uint8_t first = raw[i * 2];
+        uint8_t second = raw[i * 2 + 1];
+        if (endianMode == LSM303DLHC_LITTLE_ENDIAN) {
+            samples[i] = (((int16_t)second) << 8) | first;
+        } else {
+            samples[i] = (((int16_t)first) << 8) | second;
+        }
+    }
+    return count;
+}
+
 //INT1_CFG_A, w/r
 
 /** Set the combination mode for interrupt 1events
@@ -1178,8 +1184,7 @@ uint8_t LSM303DLHC::getAccelFIFOStoredSamples() {
  * @see LSM303DLHC_INT1_AND
  */
 void LSM303DLHC::setAccelInterrupt1Combination(bool combination) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_AOI_BIT,
-        combination);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_AOI_BIT>::write(devAddrA, combination);
 }
 
 /** Get the combination mode for interrupt 1 events
@@ -1191,8 +1196,7 @@ void LSM303DLHC::setAccelInterrupt1Combination(bool combination) {
  * @see LSM303DLHC_INT1_AND
  */
 bool LSM303DLHC::getAccelInterrupt1Combination() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_AOI_BIT,
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_AOI_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1202,7 +1206,7 @@ bool LSM303DLHC::getAccelInterrupt1Combination() {
 @see LSM303DLHC_INT1_6D_BIT
 */
 void LSM303DLHC::setAccelInterrupt16DEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_6D_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_6D_BIT>::write(devAddrA, enabled);
 }
 
 /*Get enable status of 6D dectection interrupt 1.  See datasheet for how 4D detection is affected.
@@ -1211,7 +1215,7 @@ void LSM303DLHC::setAccelInterrupt16DEnabled(bool enabled){
 @see LSM303DLHC_INT1_6D_BIT
 */
 bool LSM303DLHC::getAccelInterrupt16DEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_6D_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_6D_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1221,7 +1225,7 @@ bool LSM303DLHC::getAccelInterrupt16DEnabled(){
  * @see LSM303DLHC_ZHIE_ZUPE_BIT
  */
 void LSM303DLHC::setAccelZHighUpInterrupt1Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZHIE_ZUPE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZHIE_ZUPE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 1 for Z high/up is enabled
@@ -1230,8 +1234,7 @@ void LSM303DLHC::setAccelZHighUpInterrupt1Enabled(bool enabled) {
  * @see LSM303DLHC_INT1_ZHIE_ZUPE_BIT
  */
 bool LSM303DLHC::getAccelZHighUpInterrupt1Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZHIE_ZUPE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZHIE_ZUPE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1241,7 +1244,7 @@ bool LSM303DLHC::getAccelZHighUpInterrupt1Enabled() {
  * @see LSM303DLHC_INT1_ZLIE_ZDOWNE_BIT
  */
 void LSM303DLHC::setAccelZLowDownInterrupt1Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZLIE_ZDOWNE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZLIE_ZDOWNE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 1 for Z low/down is enabled
@@ -1250,8 +1253,7 @@ void LSM303DLHC::setAccelZLowDownInterrupt1Enabled(bool enabled) {
  * @see LSM303DLHC_INT1_ZLIE_ZDOWNE_BIT
  */
 bool LSM303DLHC::getAccelZLowDownInterrupt1Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZLIE_ZDOWNE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_ZLIE_ZDOWNE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1261,7 +1263,7 @@ bool LSM303DLHC::getAccelZLowDownInterrupt1Enabled() {
  * @see LSM303DLHC_INT1_YHIE_YUPE_BIT
  */
 void LSM303DLHC::setAccelYHighUpInterrupt1Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YHIE_YUPE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YHIE_YUPE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 1 for Y high/up is enabled
@@ -1270,8 +1272,7 @@ void LSM303DLHC::setAccelYHighUpInterrupt1Enabled(bool enabled) {
  * @see LSM303DLHC_INT1_YHIE_YUPE_BIT
  */
 bool LSM303DLHC::getAccelYHighUpInterrupt1Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YHIE_YUPE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YHIE_YUPE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1281,7 +1282,7 @@ bool LSM303DLHC::getAccelYHighUpInterrupt1Enabled() {
  * @see LSM303DLHC_INT1_YLIE_YDOWNE_BIT
  */
 void LSM303DLHC::setAccelYLowDownInterrupt1Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YLIE_YDOWNE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YLIE_YDOWNE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 1 for Y low/down is enabled
@@ -1290,8 +1291,7 @@ void LSM303DLHC::setAccelYLowDownInterrupt1Enabled(bool enabled) {
  * @see LSM303DLHC_INT1_YLIE_YDOWNE_BIT
  */
 bool LSM303DLHC::getAccelYLowDownInterrupt1Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YLIE_YDOWNE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_YLIE_YDOWNE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1301,7 +1301,7 @@ bool LSM303DLHC::getAccelYLowDownInterrupt1Enabled() {
  * @see LSM303DLHC_INT1_XHIE_XUPE_BIT
  */
 void LSM303DLHC::setAccelXHighUpInterrupt1Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XHIE_XUPE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XHIE_XUPE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 1 for X high/up is enabled
@@ -1310,8 +1310,7 @@ void LSM303DLHC::setAccelXHighUpInterrupt1Enabled(bool enabled) {
  * @see LSM303DLHC_INT1_XHIE_XUPE_BIT
  */
 bool LSM303DLHC::getAccelXHighUpInterrupt1Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XHIE_XUPE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XHIE_XUPE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1321,7 +1320,7 @@ bool LSM303DLHC::getAccelXHighUpInterrupt1Enabled() {
  * @see LSM303DLHC_INT1_XLIE_XDOWNE_BIT
  */
 void LSM303DLHC::setAccelXLowDownInterrupt1Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XLIE_XDOWNE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XLIE_XDOWNE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 1 for X low/down is enabled
@@ -1330,8 +1329,7 @@ void LSM303DLHC::setAccelXLowDownInterrupt1Enabled(bool enabled) {
  * @see LSM303DLHC_INT1_XLIE_XDOWNE_BIT
  */
 bool LSM303DLHC::getAccelXLowDownInterrupt1Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XLIE_XDOWNE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT1_CFG_A, LSM303DLHC_INT1_XLIE_XDOWNE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1384,8 +1382,7 @@ uint8_t LSM303DLHC::getAccelInterupt1Threshold(){
  * @see LSM303DLHC_INT1_DURATION_LENGTH
  */
 void LSM303DLHC::setAccelInterrupt1Duration(uint8_t duration) {
-  I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_INT1_DURATION_A, LSM303DLHC_INT1_DURATION_BIT,
-    LSM303DLHC_INT1_DURATION_LENGTH, duration);
+  I2CdevField<LSM303DLHC_RA_INT1_DURATION_A, LSM303DLHC_INT1_DURATION_BIT, LSM303DLHC_INT1_DURATION_LENGTH>::write(devAddrA, duration);
 }
 
 /** Get the minimum event duration for interrupt 1 to be generated
@@ -1395,8 +1392,7 @@ void LSM303DLHC::setAccelInterrupt1Duration(uint8_t duration) {
  * @see LSM303DLHC_INT1_DURATION_LENGTH
  */
 uint8_t LSM303DLHC::getAccelInterrupt1Duration() {
-  I2Cdev::readBits(devAddrA, LSM303DLHC_RA_INT1_DURATION_A, 
-    LSM303DLHC_INT1_DURATION_BIT, LSM303DLHC_INT1_DURATION_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_INT1_DURATION_A, LSM303DLHC_INT1_DURATION_BIT, LSM303DLHC_INT1_DURATION_LENGTH>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1411,8 +1407,7 @@ uint8_t LSM303DLHC::getAccelInterrupt1Duration() {
  * @see LSM303DLHC_INT1_AND
  */
 void LSM303DLHC::setAccelInterrupt2Combination(bool combination) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_AOI_BIT,
-        combination);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_AOI_BIT>::write(devAddrA, combination);
 }
 
 /** Get the combination mode for interrupt 2 events
@@ -1424,8 +1419,7 @@ void LSM303DLHC::setAccelInterrupt2Combination(bool combination) {
  * @see LSM303DLHC_INT1_AND
  */
 bool LSM303DLHC::getAccelInterrupt2Combination() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_AOI_BIT,
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_AOI_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1435,7 +1429,7 @@ bool LSM303DLHC::getAccelInterrupt2Combination() {
 @see LSM303DLHC_INT2_6D_BIT
 */
 void LSM303DLHC::setAccelInterrupt26DEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_6D_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_6D_BIT>::write(devAddrA, enabled);
 }
 
 /*Get enable status of 6D dectection interrupt 2.  See datasheet for how 4D detection is affected.
@@ -1444,7 +1438,7 @@ void LSM303DLHC::setAccelInterrupt26DEnabled(bool enabled){
 @see LSM303DLHC_INT2_6D_BIT
 */
 bool LSM303DLHC::getAccelInterrupt26DEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_6D_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_6D_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1454,7 +1448,7 @@ bool LSM303DLHC::getAccelInterrupt26DEnabled(){
  * @see LSM303DLHC_INT2_ZHIE_BIT
  */
 void LSM303DLHC::setAccelZHighInterrupt2Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZHIE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZHIE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 2 for Z high is enabled
@@ -1463,8 +1457,7 @@ void LSM303DLHC::setAccelZHighInterrupt2Enabled(bool enabled) {
  * @see LSM303DLHC_INT2_ZHIE_BIT
  */
 bool LSM303DLHC::getAccelZHighInterrupt2Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZHIE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZHIE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1474,7 +1467,7 @@ bool LSM303DLHC::getAccelZHighInterrupt2Enabled() {
  * @see LSM303DLHC_INT2_ZLIE_BIT
  */
 void LSM303DLHC::setAccelZLowInterrupt2Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZLIE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZLIE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 2 for Z low is enabled
@@ -1483,8 +1476,7 @@ void LSM303DLHC::setAccelZLowInterrupt2Enabled(bool enabled) {
  * @see LSM303DLHC_INT2_ZLIE_BIT
  */
 bool LSM303DLHC::getAccelZLowInterrupt2Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZLIE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_ZLIE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1494,7 +1486,7 @@ bool LSM303DLHC::getAccelZLowInterrupt2Enabled() {
  * @see LSM303DLHC_INT2_YHIE_BIT
  */
 void LSM303DLHC::setAccelYHighInterrupt2Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YHIE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YHIE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 2 for Y high is enabled
@@ -1503,8 +1495,7 @@ void LSM303DLHC::setAccelYHighInterrupt2Enabled(bool enabled) {
  * @see LSM303DLHC_INT2_YHIE_BIT
  */
 bool LSM303DLHC::getAccelYHighInterrupt2Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YHIE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YHIE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1514,7 +1505,7 @@ bool LSM303DLHC::getAccelYHighInterrupt2Enabled() {
  * @see LSM303DLHC_INT2_YLIE_BIT
  */
 void LSM303DLHC::setAccelYLowInterrupt2Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YLIE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YLIE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 2 for Y low is enabled
@@ -1523,8 +1514,7 @@ void LSM303DLHC::setAccelYLowInterrupt2Enabled(bool enabled) {
  * @see LSM303DLHC_INT2_YLIE_BIT
  */
 bool LSM303DLHC::getAccelYLowInterrupt2Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YLIE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_YLIE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1534,7 +1524,7 @@ bool LSM303DLHC::getAccelYLowInterrupt2Enabled() {
  * @see LSM303DLHC_INT2_XHIE_BIT
  */
 void LSM303DLHC::setAccelXHighInterrupt2Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XHIE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XHIE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 2 for X high is enabled
@@ -1543,8 +1533,7 @@ void LSM303DLHC::setAccelXHighInterrupt2Enabled(bool enabled) {
  * @see LSM303DLHC_INT2_XHIE_BIT
  */
 bool LSM303DLHC::getAccelXHighInterrupt2Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XHIE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XHIE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1554,7 +1543,7 @@ bool LSM303DLHC::getAccelXHighInterrupt2Enabled() {
  * @see LSM303DLHC_INT2_XLIE_BIT
  */
 void LSM303DLHC::setAccelXLowInterrupt2Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XLIE_BIT, enabled);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XLIE_BIT>::write(devAddrA, enabled);
 }
 
 /** Get whether the interrupt 2 for X low is enabled
@@ -1563,8 +1552,7 @@ void LSM303DLHC::setAccelXLowInterrupt2Enabled(bool enabled) {
  * @see LSM303DLHC_INT2_XLIE_BIT
  */
 bool LSM303DLHC::getAccelXLowInterrupt2Enabled() {
-    I2Cdev::readBit(devAddrA, LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XLIE_BIT, 
-        buffer);
+    I2CdevField<LSM303DLHC_RA_INT2_CFG_A, LSM303DLHC_INT2_XLIE_BIT>::read(devAddrA, buffer);
     return buffer[0];
 }
 
@@ -1618,8 +1606,7 @@ uint8_t LSM303DLHC::getAccelInterupt2Threshold(){
  * @see LSM303DLHC_INT2_DURATION_LENGTH
  */
 void LSM303DLHC::setAccelInterrupt2Duration(uint8_t duration) {
-  I2Cdev::writeBits(devAddrA, LSM303DLHC_RA_INT2_DURATION_A, LSM303DLHC_INT2_DURATION_BIT,
-    LSM303DLHC_INT2_DURATION_LENGTH, duration);
+  I2CdevField<LSM303DLHC_RA_INT2_DURATION_A, LSM303DLHC_INT2_DURATION_BIT, LSM303DLHC_INT2_DURATION_LENGTH>::write(devAddrA, duration);
 }
 
 /** Get the minimum event duration for interrupt 2 to be generated
@@ -1629,8 +1616,7 @@ void LSM303DLHC::setAccelInterrupt2Duration(uint8_t duration) {
  * @see LSM303DLHC_INT2_DURATION_LENGTH
  */
 uint8_t LSM303DLHC::getAccelInterrupt2Duration() {
-  I2Cdev::readBits(devAddrA, LSM303DLHC_RA_INT2_DURATION_A, 
-    LSM303DLHC_INT2_DURATION_BIT, LSM303DLHC_INT2_DURATION_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_INT2_DURATION_A, LSM303DLHC_INT2_DURATION_BIT, LSM303DLHC_INT2_DURATION_LENGTH>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1642,7 +1628,7 @@ uint8_t LSM303DLHC::getAccelInterrupt2Duration() {
 @see LSM303DLHC_CLICK_ZD_BIT
 */
 void LSM303DLHC::setAccelZDoubleClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZD_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZD_BIT>::write(devAddrA, enabled);
 }
 
 /*Get status of interrupt double click on the Z axis.
@@ -1651,7 +1637,7 @@ void LSM303DLHC::setAccelZDoubleClickEnabled(bool enabled){
 @see LSM303DLHC_CLICK_ZD_BIT
 */
 bool LSM303DLHC::getAccelZDoubleClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZD_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZD_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1661,7 +1647,7 @@ bool LSM303DLHC::getAccelZDoubleClickEnabled(){
 @see LSM303DLHC_CLICK_ZS_BIT
 */
 void LSM303DLHC::setAccelZSingleClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZS_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZS_BIT>::write(devAddrA, enabled);
 }
 
 /*Get status of interrupt single click on the Z axis.
@@ -1670,7 +1656,7 @@ void LSM303DLHC::setAccelZSingleClickEnabled(bool enabled){
 @see LSM303DLHC_CLICK_ZS_BIT
 */
 bool LSM303DLHC::getAccelZSingleClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZS_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_ZS_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1680,7 +1666,7 @@ bool LSM303DLHC::getAccelZSingleClickEnabled(){
 @see LSM303DLHC_CLICK_YD_BIT
 */
 void LSM303DLHC::setAccelYDoubleClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YD_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YD_BIT>::write(devAddrA, enabled);
 }
 
 /*Get status of interrupt double click on the Y axis.
@@ -1689,7 +1675,7 @@ void LSM303DLHC::setAccelYDoubleClickEnabled(bool enabled){
 @see LSM303DLHC_CLICK_YD_BIT
 */
 bool LSM303DLHC::getAccelYDoubleClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YD_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YD_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1699,7 +1685,7 @@ bool LSM303DLHC::getAccelYDoubleClickEnabled(){
 @see LSM303DLHC_CLICK_YS_BIT
 */
 void LSM303DLHC::setAccelYSingleClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YS_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YS_BIT>::write(devAddrA, enabled);
 }
 
 /*Get status of interrupt single click on the Y axis.
@@ -1708,7 +1694,7 @@ void LSM303DLHC::setAccelYSingleClickEnabled(bool enabled){
 @see LSM303DLHC_CLICK_YS_BIT
 */
 bool LSM303DLHC::getAccelYSingleClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YS_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_YS_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1718,7 +1704,7 @@ bool LSM303DLHC::getAccelYSingleClickEnabled(){
 @see LSM303DLHC_CLICK_XD_BIT
 */
 void LSM303DLHC::setAccelXDoubleClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XD_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XD_BIT>::write(devAddrA, enabled);
 }
 
 /*Get status of interrupt double click on the X axis.
@@ -1727,7 +1713,7 @@ void LSM303DLHC::setAccelXDoubleClickEnabled(bool enabled){
 @see LSM303DLHC_CLICK_XD_BIT
 */
 bool LSM303DLHC::getAccelXDoubleClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XD_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XD_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1737,7 +1723,7 @@ bool LSM303DLHC::getAccelXDoubleClickEnabled(){
 @see LSM303DLHC_CLICK_XS_BIT
 */
 void LSM303DLHC::setAccelXSingleClickEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XS_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XS_BIT>::write(devAddrA, enabled);
 }
 
 /*Get status of interrupt single click on the X axis.
@@ -1747,7 +1733,7 @@ void LSM303DLHC::setAccelXSingleClickEnabled(bool enabled){
 */
 
 bool LSM303DLHC::getAccelXSingleClickEnabled(){
-  I2Cdev::readBit(devAddrA, LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XS_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CLICK_CFG_A, LSM303DLHC_CLICK_XS_BIT>::read(devAddrA, buffer);
   return buffer[0];
 }
 
@@ -1869,7 +1855,7 @@ uint8_t LSM303DLHC::getAccelClickTimeWindow(){
 @see LSM303DLHC_TEMP_EN_BIT
 */
 void LSM303DLHC::setMagTemperatureEnabled(bool enabled){
-  I2Cdev::writeBit(devAddrM, LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_TEMP_EN_BIT, enabled);
+  I2CdevField<LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_TEMP_EN_BIT>::write(devAddrM, enabled);
 }
 
 /*Get whether the temperature sensor is enabled.
@@ -1878,7 +1864,7 @@ void LSM303DLHC::setMagTemperatureEnabled(bool enabled){
 @see LSM303DLHC_TEMP_EN_BIT
 */
 bool LSM303DLHC::getMagTemperatureEnabled(){
-  I2Cdev::readBit(devAddrM, LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_TEMP_EN_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_TEMP_EN_BIT>::read(devAddrM, buffer);
   return buffer[0];
 }
 
@@ -1916,8 +1902,7 @@ void LSM303DLHC::setMagOutputDataRate(uint8_t rate){
     writeBit = LSM303DLHC_DO_RATE_220;
   }
 
-  I2Cdev::writeBits(devAddrM, LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_DO_BIT,
-    LSM303DLHC_DO_LENGTH, writeBit);
+  I2CdevField<LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_DO_BIT, LSM303DLHC_DO_LENGTH>::write(devAddrM, writeBit);
 }
 
 /*Get the magetometer output data rate.
@@ -1935,8 +1920,7 @@ void LSM303DLHC::setMagOutputDataRate(uint8_t rate){
 @see LSM303DLHC_DO_RATE_220
 */
 uint8_t LSM303DLHC::getMagOutputDataRate(){
-  I2Cdev::readBits(devAddrM, LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_DO_BIT,
-    LSM303DLHC_DO_LENGTH, buffer);
+  I2CdevField<LSM303DLHC_RA_CRA_REG_M, LSM303DLHC_DO_BIT, LSM303DLHC_DO_LENGTH>::read(devAddrM, buffer);
   uint8_t rate = buffer[0];
 
   if (rate == LSM303DLHC_DO_RATE_0){
@@ -1991,8 +1975,7 @@ void LSM303DLHC::setMagGain(uint16_t gain){
     writeBit = LSM303DLHC_GN_1100;
   }
 
-  I2Cdev::writeBits(devAddrM, LSM303DLHC_RA_CRB_REG_M, LSM303DLHC_GN_BIT, LSM303DLHC_GN_LENGTH,
-    writeBit);
+  I2CdevField<LSM303DLHC_RA_CRB_REG_M, LSM303DLHC_GN_BIT, LSM303DLHC_GN_LENGTH>::write(devAddrM, writeBit);
 }
 
 /*Get the magnetometer gain.
@@ -2007,8 +1990,7 @@ void LSM303DLHC::setMagGain(uint16_t gain){
 @see LSM303DLHC_GN_1100
 */
 uint16_t LSM303DLHC::getMagGain(){
-  I2Cdev::readBits(devAddrM, LSM303DLHC_RA_CRB_REG_M, LSM303DLHC_GN_BIT, LSM303DLHC_GN_LENGTH,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_CRB_REG_M, LSM303DLHC_GN_BIT, LSM303DLHC_GN_LENGTH>::read(devAddrM, buffer);
   uint8_t gain = buffer[0];
   if (gain == LSM303DLHC_GN_230){
     return 230; 
@@ -2039,8 +2021,7 @@ uint16_t LSM303DLHC::getMagGain(){
 @see LSM303DLHC_MD_SLEEP
 */
 void LSM303DLHC::setMagMode(uint8_t mode){
-  I2Cdev::writeBits(devAddrM, LSM303DLHC_RA_MR_REG_M, LSM303DLHC_MD_BIT, LSM303DLHC_MD_LENGTH,
-    mode);
+  I2CdevField<LSM303DLHC_RA_MR_REG_M, LSM303DLHC_MD_BIT, LSM303DLHC_MD_LENGTH>::write(devAddrM, mode);
 }
 
 /*Get the magnetometer mode.
@@ -2053,8 +2034,7 @@ void LSM303DLHC::setMagMode(uint8_t mode){
 @see LSM303DLHC_MD_SLEEP
 */
 uint8_t LSM303DLHC::getMagMode(){
-  I2Cdev::readBits(devAddrM, LSM303DLHC_RA_MR_REG_M, LSM303DLHC_MD_BIT, LSM303DLHC_MD_LENGTH,
-    buffer);
+  I2CdevField<LSM303DLHC_RA_MR_REG_M, LSM303DLHC_MD_BIT, LSM303DLHC_MD_LENGTH>::read(devAddrM, buffer);
   return buffer[0];
 }
 
@@ -2113,7 +2093,7 @@ data register has been read.
 @see LSM303DLHC_RA_M_LOCK_BIT
 */
 bool LSM303DLHC::getMagOutputDataRegisterLock(){
-  I2Cdev::readBit(devAddrM, LSM303DLHC_RA_SR_REG_M, LSM303DLHC_M_LOCK_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_SR_REG_M, LSM303DLHC_M_LOCK_BIT>::read(devAddrM, buffer);
   return buffer[0];
 }
 
@@ -2123,7 +2103,7 @@ bool LSM303DLHC::getMagOutputDataRegisterLock(){
 @see LSM303DLHC_RA_M_DRDY_BIT
 */
 bool LSM303DLHC::getMagDataReady(){
-  I2Cdev::readBit(devAddrM, LSM303DLHC_RA_SR_REG_M, LSM303DLHC_M_DRDY_BIT, buffer);
+  I2CdevField<LSM303DLHC_RA_SR_REG_M, LSM303DLHC_M_DRDY_BIT>::read(devAddrM, buffer);
   return buffer[0];
 }
 
@@ -509,6 +509,7 @@ class LSM303DLHC {
         bool getAccelFIFOOverrun();
         bool getAccelFIFOEmpty();
         uint8_t getAccelFIFOStoredSamples();
+        uint8_t readAccelFIFO(int16_t *samples, uint8_t max);
         
         //Int1_CFG_A, wr
         void setAccelInterrupt1Combination(bool combination);
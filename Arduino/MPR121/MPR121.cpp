@@ -6,6 +6,7 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - burst status/data reads, edge-triggered callback dispatch
 //     2011-09-03 - add callback support
 //     2011-08-20 - initial release
 
@@ -37,7 +38,8 @@ THE SOFTWARE.
 #include "I2Cdev.h"
 
 MPR121::MPR121(uint8_t address) :
-  m_devAddr(address)
+  m_devAddr(address),
+  m_prevTouchStatus(0)
 {
   for (int ch = 0; ch < NUM_CHANNELS; ch++) {
     m_callbackMap[ch][TOUCHED] = 0;
@@ -192,30 +194,57 @@ bool MPR121::getTouchStatus(uint8_t channel) {
 }
 
 uint16_t MPR121::getTouchStatus() {
-  uint16_t statusBuf;
-  uint8_t buf;
-  I2Cdev::readByte(m_devAddr, ELE0_ELE7_TOUCH_STATUS, &buf);
-  statusBuf = buf;
-  I2Cdev::readByte(m_devAddr, ELE8_ELE11_ELEPROX_TOUCH_STATUS, &buf);
-  statusBuf += (buf << 8);
-  return statusBuf;
+  uint8_t buf[2] = { 0, 0 };
+  I2Cdev::readBytes(m_devAddr, ELE0_ELE7_TOUCH_STATUS, 2, buf);
+  return ((uint16_t)buf[1] << 8) | buf[0];
+}
+
+bool MPR121::getFilteredData(uint16_t* data, uint8_t count) {
+  if (count > NUM_ELECTRODES) count = NUM_ELECTRODES;
+  uint8_t buf[NUM_ELECTRODES * 2];
+  if (I2Cdev::readBytes(m_devAddr, ELE0_FILTERED_DATA_LSB, count * 2, buf) != count * 2) {
+    return false;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    data[i] = ((uint16_t)(buf[i * 2 + 1] & 0x03) << 8) | buf[i * 2];
+  }
+  return true;
+}
+
+bool MPR121::getBaselineData(uint16_t* data, uint8_t count) {
+  if (count > NUM_ELECTRODES) count = NUM_ELECTRODES;
+  uint8_t buf[NUM_ELECTRODES];
+  if (I2Cdev::readBytes(m_devAddr, ELE0_BASELINE_VALUE, count, buf) != count) {
+    return false;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    data[i] = (uint16_t)buf[i] << 2;
+  }
+  return true;
 }
 
 void MPR121::setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr) {
   m_callbackMap[channel][event] = callbackPtr;
 }
     
-void MPR121::serviceCallbacks() {
-  for (uint8_t channel = 0; channel < NUM_CHANNELS; channel++) { 
-    bool touchStatus = getTouchStatus(channel);
-    if (touchStatus != m_prevTouchStatus[channel]) {
-      for (uint8_t type = 0; type < NUM_EVENTS; type++) { 
-        const CallbackPtrType cb = touchStatus ? m_callbackMap[channel][TOUCHED] : m_callbackMap[channel][RELEASED]; 
-        if (cb != 0) {
-          cb();           
-        }
+uint16_t MPR121::serviceCallbacks() {
+  uint8_t buf[2];
+  if (I2Cdev::readBytes(m_devAddr, ELE0_ELE7_TOUCH_STATUS, 2, buf) != 2) {
+    return 0; // keep the previous state so no edges are lost or invented
+  }
+  const uint16_t touchStatus = (((uint16_t)buf[1] << 8) | buf[0]) & ((1 << NUM_CHANNELS) - 1);
+  const uint16_t changed = touchStatus ^ m_prevTouchStatus;
+  m_prevTouchStatus = touchStatus;
+
+  // walk only the channels that changed
+  uint16_t pending = changed;
+  for (uint8_t channel = 0; pending != 0; channel++, pending >>= 1) {
+    if (pending & 1) {
+      const CallbackPtrType cb = (touchStatus & (1 << channel)) ? m_callbackMap[channel][TOUCHED] : m_callbackMap[channel][RELEASED];
+      if (cb != 0) {
+        cb();
       }
-      m_prevTouchStatus[channel] = touchStatus; 
     }
   }
+  return changed;
 }
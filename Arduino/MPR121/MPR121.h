@@ -6,6 +6,7 @@
 // which should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
 //
 // Changelog:
+//     2026-10-19 - burst status/data reads, edge-triggered callback dispatch
 //     2011-09-03 - add callback support
 //     2011-08-20 - initial release
 
@@ -183,6 +184,7 @@ THE SOFTWARE.
 #define TOUCH_THRESHOLD   0x0F
 #define RELEASE_THRESHOLD 0x0A
 #define NUM_CHANNELS      12
+#define NUM_ELECTRODES    13 // touch channels plus the ELEPROX proximity electrode
 
 class MPR121
 {
@@ -208,16 +210,27 @@ class MPR121
     // getTouchStatus returns the touch status for the given channel (0 - 11)
     bool getTouchStatus(uint8_t channel);
     // when not given a channel, returns a bitfield of all touch channels.
+    // both status registers are read in a single 2-byte burst.
     uint16_t getTouchStatus();
 
+    // 10-bit filtered electrode data for electrodes 0 to count - 1 (up to 13,
+    // the last being ELEPROX), read in one burst. returns false on a bus error.
+    bool getFilteredData(uint16_t* data, uint8_t count = NUM_CHANNELS);
+    // baseline values for electrodes 0 to count - 1, scaled to the same 10-bit
+    // range as the filtered data (the register holds the upper 8 bits)
+    bool getBaselineData(uint16_t* data, uint8_t count = NUM_CHANNELS);
+
     void setCallback(uint8_t channel, EventType event, CallbackPtrType callbackPtr);
     
-    void serviceCallbacks();
+    // reads the touch status once and fires the TOUCHED or RELEASED callback
+    // of each channel whose state changed since the previous call.
+    // returns a bitfield of the channels that changed.
+    uint16_t serviceCallbacks();
     
   private:
     uint8_t m_devAddr; // contains the I2C address of the device
     CallbackPtrType m_callbackMap[NUM_CHANNELS][NUM_EVENTS];
-    bool m_prevTouchStatus[NUM_CHANNELS];
+    uint16_t m_prevTouchStatus; // bitfield of channel states at the last service pass
     
 };
 
@@ -37,6 +37,22 @@ THE SOFTWARE.
 */
 
 #include "MPU6050.h"
+#include "helper_field.h"
+
+/** Writable configuration register map, in restore order.
+ * Power management goes first so the clock source is settled before anything
+ * else is written, and USER_CTRL goes last so the FIFO, I2C master and DMP
+ * are only re-enabled once everything they depend on is in place.
+ */
+static const I2CdevRegisterBlock mpu6050StateBlocks[MPU6050_STATE_BLOCKS] = {
+    { MPU6050_RA_PWR_MGMT_1,       2 },  // PWR_MGMT_1..PWR_MGMT_2
+    { MPU6050_RA_XG_OFFS_TC,      12 },  // *G_OFFS_TC, *_FINE_GAIN, *A_OFFS
+    { MPU6050_RA_XG_OFFS_USRH,    34 },  // *G_OFFS_USR through I2C_SLV4_CTRL
+    { MPU6050_RA_INT_PIN_CFG,      2 },  // INT_PIN_CFG..INT_ENABLE
+    { MPU6050_RA_I2C_SLV0_DO,      5 },  // I2C_SLV*_DO, I2C_MST_DELAY_CTRL
+    { MPU6050_RA_DMP_CFG_1,        2 },  // DMP_CFG_1..DMP_CFG_2
+    { MPU6050_RA_MOT_DETECT_CTRL,  2 },  // MOT_DETECT_CTRL..USER_CTRL
+};
 
 /** Specific address constructor.
  * @param address I2C address, uses default I2C address if none is specified
@@ -55,10 +71,13 @@ MPU6050_Base::MPU6050_Base(uint8_t address, void *wireObj):devAddr(address), wir
  * the default internal clock source.
  */
 void MPU6050_Base::initialize() {
-    setClockSource(MPU6050_CLOCK_PLL_XGYRO);
+    // clock source and sleep bit share PWR_MGMT_1, so set both in one update
+    typedef I2CdevFieldSet<
+        I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>,
+        I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT> > Power;
+    Power::write(devAddr, Power::encode(MPU6050_CLOCK_PLL_XGYRO, false), wireObj); // thanks to Jack Elston for pointing out the sleep bit!
     setFullScaleGyroRange(MPU6050_GYRO_FS_250);
     setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
-    setSleepEnabled(false); // thanks to Jack Elston for pointing this one out!
 }
 
 /** Verify the I2C connection.
@@ -78,7 +97,7 @@ bool MPU6050_Base::testConnection() {
  * @return I2C supply voltage level (0=VLOGIC, 1=VDD)
  */
 uint8_t MPU6050_Base::getAuxVDDIOLevel() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set the auxiliary I2C supply voltage level.
@@ -88,7 +107,7 @@ uint8_t MPU6050_Base::getAuxVDDIOLevel() {
  * @param level I2C supply voltage level (0=VLOGIC, 1=VDD)
  */
 void MPU6050_Base::setAuxVDDIOLevel(uint8_t level) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT, level, wireObj);
+    I2CdevField<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_PWR_MODE_BIT>::write(devAddr, level, wireObj);
 }
 
 // SMPLRT_DIV register
@@ -126,6 +145,19 @@ uint8_t MPU6050_Base::getRate() {
 void MPU6050_Base::setRate(uint8_t rate) {
     I2Cdev::writeByte(devAddr, MPU6050_RA_SMPLRT_DIV, rate, wireObj);
 }
+/** Get effective sample rate in Hz.
+ * Combines SMPLRT_DIV with the DLPF setting, which selects the 8kHz or 1kHz
+ * gyroscope output rate (see getRate()). This is the rate at which packets are
+ * pushed into the FIFO and is the nominal rate to hand to SampleClock.
+ * @return Sample rate in Hz
+ * @see getRate()
+ * @see getDLPFMode()
+ */
+float MPU6050_Base::getSampleRate() {
+    uint8_t dlpf = getDLPFMode();
+    float gyroRate = (dlpf == 0 || dlpf == 7) ? 8000.0f : 1000.0f;
+    return gyroRate / (1 + getRate());
+}
 
 // CONFIG register
 
@@ -157,7 +189,7 @@ void MPU6050_Base::setRate(uint8_t rate) {
  * @return FSYNC configuration value
  */
 uint8_t MPU6050_Base::getExternalFrameSync() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set external FSYNC configuration.
@@ -166,7 +198,7 @@ uint8_t MPU6050_Base::getExternalFrameSync() {
  * @param sync New FSYNC configuration value
  */
 void MPU6050_Base::setExternalFrameSync(uint8_t sync) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH, sync, wireObj);
+    I2CdevField<MPU6050_RA_CONFIG, MPU6050_CFG_EXT_SYNC_SET_BIT, MPU6050_CFG_EXT_SYNC_SET_LENGTH>::write(devAddr, sync, wireObj);
 }
 /** Get digital low-pass filter configuration.
  * The DLPF_CFG parameter sets the digital low pass filter configuration. It
@@ -197,7 +229,7 @@ void MPU6050_Base::setExternalFrameSync(uint8_t sync) {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 uint8_t MPU6050_Base::getDLPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set digital low-pass filter configuration.
@@ -209,7 +241,7 @@ uint8_t MPU6050_Base::getDLPFMode() {
  * @see MPU6050_CFG_DLPF_CFG_LENGTH
  */
 void MPU6050_Base::setDLPFMode(uint8_t mode) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH, mode, wireObj);
+    I2CdevField<MPU6050_RA_CONFIG, MPU6050_CFG_DLPF_CFG_BIT, MPU6050_CFG_DLPF_CFG_LENGTH>::write(devAddr, mode, wireObj);
 }
 
 // GYRO_CONFIG register
@@ -232,7 +264,7 @@ void MPU6050_Base::setDLPFMode(uint8_t mode) {
  * @see MPU6050_GCONFIG_FS_SEL_LENGTH
  */
 uint8_t MPU6050_Base::getFullScaleGyroRange() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set full-scale gyroscope range.
@@ -244,7 +276,7 @@ uint8_t MPU6050_Base::getFullScaleGyroRange() {
  * @see MPU6050_GCONFIG_FS_SEL_LENGTH
  */
 void MPU6050_Base::setFullScaleGyroRange(uint8_t range) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH, range, wireObj);
+    I2CdevField<MPU6050_RA_GYRO_CONFIG, MPU6050_GCONFIG_FS_SEL_BIT, MPU6050_GCONFIG_FS_SEL_LENGTH>::write(devAddr, range, wireObj);
 }
 
 // SELF TEST FACTORY TRIM VALUES
@@ -312,7 +344,7 @@ uint8_t MPU6050_Base::getGyroZSelfTestFactoryTrim() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050_Base::getAccelXSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get self-test enabled setting for accelerometer X axis.
@@ -320,14 +352,14 @@ bool MPU6050_Base::getAccelXSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050_Base::setAccelXSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_XA_ST_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get self-test enabled value for accelerometer Y axis.
  * @return Self-test enabled value
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050_Base::getAccelYSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get self-test enabled value for accelerometer Y axis.
@@ -335,14 +367,14 @@ bool MPU6050_Base::getAccelYSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050_Base::setAccelYSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_YA_ST_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get self-test enabled value for accelerometer Z axis.
  * @return Self-test enabled value
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 bool MPU6050_Base::getAccelZSelfTest() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set self-test enabled value for accelerometer Z axis.
@@ -350,7 +382,7 @@ bool MPU6050_Base::getAccelZSelfTest() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050_Base::setAccelZSelfTest(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ZA_ST_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get full-scale accelerometer range.
  * The FS_SEL parameter allows setting the full-scale range of the accelerometer
@@ -370,7 +402,7 @@ void MPU6050_Base::setAccelZSelfTest(bool enabled) {
  * @see MPU6050_ACONFIG_AFS_SEL_LENGTH
  */
 uint8_t MPU6050_Base::getFullScaleAccelRange() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set full-scale accelerometer range.
@@ -378,7 +410,7 @@ uint8_t MPU6050_Base::getFullScaleAccelRange() {
  * @see getFullScaleAccelRange()
  */
 void MPU6050_Base::setFullScaleAccelRange(uint8_t range) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH, range, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_AFS_SEL_BIT, MPU6050_ACONFIG_AFS_SEL_LENGTH>::write(devAddr, range, wireObj);
 }
 /** Get the high-pass filter configuration.
  * The DHPF is a filter module in the path leading to motion detectors (Free
@@ -416,7 +448,7 @@ void MPU6050_Base::setFullScaleAccelRange(uint8_t range) {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 uint8_t MPU6050_Base::getDHPFMode() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set the high-pass filter configuration.
@@ -426,7 +458,7 @@ uint8_t MPU6050_Base::getDHPFMode() {
  * @see MPU6050_RA_ACCEL_CONFIG
  */
 void MPU6050_Base::setDHPFMode(uint8_t bandwidth) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH, bandwidth, wireObj);
+    I2CdevField<MPU6050_RA_ACCEL_CONFIG, MPU6050_ACONFIG_ACCEL_HPF_BIT, MPU6050_ACONFIG_ACCEL_HPF_LENGTH>::write(devAddr, bandwidth, wireObj);
 }
 
 // FF_THR register
@@ -635,7 +667,7 @@ void MPU6050_Base::setZeroMotionDetectionDuration(uint8_t duration) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getTempFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set temperature FIFO enabled value.
@@ -644,7 +676,7 @@ bool MPU6050_Base::getTempFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setTempFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_TEMP_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get gyroscope X-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_XOUT_H and GYRO_XOUT_L (Registers 67 and
@@ -653,7 +685,7 @@ void MPU6050_Base::setTempFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getXGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set gyroscope X-axis FIFO enabled value.
@@ -662,7 +694,7 @@ bool MPU6050_Base::getXGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setXGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_XG_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get gyroscope Y-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_YOUT_H and GYRO_YOUT_L (Registers 69 and
@@ -671,7 +703,7 @@ void MPU6050_Base::setXGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getYGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set gyroscope Y-axis FIFO enabled value.
@@ -680,7 +712,7 @@ bool MPU6050_Base::getYGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setYGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_YG_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get gyroscope Z-axis FIFO enabled value.
  * When set to 1, this bit enables GYRO_ZOUT_H and GYRO_ZOUT_L (Registers 71 and
@@ -689,7 +721,7 @@ void MPU6050_Base::setYGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getZGyroFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set gyroscope Z-axis FIFO enabled value.
@@ -698,7 +730,7 @@ bool MPU6050_Base::getZGyroFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setZGyroFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_ZG_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get accelerometer FIFO enabled value.
  * When set to 1, this bit enables ACCEL_XOUT_H, ACCEL_XOUT_L, ACCEL_YOUT_H,
@@ -708,7 +740,7 @@ void MPU6050_Base::setZGyroFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getAccelFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set accelerometer FIFO enabled value.
@@ -717,7 +749,7 @@ bool MPU6050_Base::getAccelFIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setAccelFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_ACCEL_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Slave 2 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -726,7 +758,7 @@ void MPU6050_Base::setAccelFIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getSlave2FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Slave 2 FIFO enabled value.
@@ -735,7 +767,7 @@ bool MPU6050_Base::getSlave2FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setSlave2FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_SLV2_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Slave 1 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -744,7 +776,7 @@ void MPU6050_Base::setSlave2FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getSlave1FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Slave 1 FIFO enabled value.
@@ -753,7 +785,7 @@ bool MPU6050_Base::getSlave1FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setSlave1FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_SLV1_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Slave 0 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -762,7 +794,7 @@ void MPU6050_Base::setSlave1FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_FIFO_EN
  */
 bool MPU6050_Base::getSlave0FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Slave 0 FIFO enabled value.
@@ -771,7 +803,7 @@ bool MPU6050_Base::getSlave0FIFOEnabled() {
  * @see MPU6050_RA_FIFO_EN
  */
 void MPU6050_Base::setSlave0FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_FIFO_EN, MPU6050_SLV0_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 
 // I2C_MST_CTRL register
@@ -792,7 +824,7 @@ void MPU6050_Base::setSlave0FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050_Base::getMultiMasterEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set multi-master enabled value.
@@ -801,7 +833,7 @@ bool MPU6050_Base::getMultiMasterEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050_Base::setMultiMasterEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_MULT_MST_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get wait-for-external-sensor-data enabled value.
  * When the WAIT_FOR_ES bit is set to 1, the Data Ready interrupt will be
@@ -815,7 +847,7 @@ void MPU6050_Base::setMultiMasterEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050_Base::getWaitForExternalSensorEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set wait-for-external-sensor-data enabled value.
@@ -824,7 +856,7 @@ bool MPU6050_Base::getWaitForExternalSensorEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050_Base::setWaitForExternalSensorEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_WAIT_FOR_ES_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Slave 3 FIFO enabled value.
  * When set to 1, this bit enables EXT_SENS_DATA registers (Registers 73 to 96)
@@ -833,7 +865,7 @@ void MPU6050_Base::setWaitForExternalSensorEnabled(bool enabled) {
  * @see MPU6050_RA_MST_CTRL
  */
 bool MPU6050_Base::getSlave3FIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Slave 3 FIFO enabled value.
@@ -842,7 +874,7 @@ bool MPU6050_Base::getSlave3FIFOEnabled() {
  * @see MPU6050_RA_MST_CTRL
  */
 void MPU6050_Base::setSlave3FIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_SLV_3_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get slave read/write transition enabled value.
  * The I2C_MST_P_NSR bit configures the I2C Master's transition from one slave
@@ -855,7 +887,7 @@ void MPU6050_Base::setSlave3FIFOEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 bool MPU6050_Base::getSlaveReadWriteTransitionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set slave read/write transition enabled value.
@@ -864,7 +896,7 @@ bool MPU6050_Base::getSlaveReadWriteTransitionEnabled() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050_Base::setSlaveReadWriteTransitionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_P_NSR_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get I2C master clock speed.
  * I2C_MST_CLK is a 4 bit unsigned value which configures a divider on the
@@ -896,7 +928,7 @@ void MPU6050_Base::setSlaveReadWriteTransitionEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 uint8_t MPU6050_Base::getMasterClockSpeed() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set I2C master clock speed.
@@ -904,7 +936,7 @@ uint8_t MPU6050_Base::getMasterClockSpeed() {
  * @see MPU6050_RA_I2C_MST_CTRL
  */
 void MPU6050_Base::setMasterClockSpeed(uint8_t speed) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH, speed, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_CTRL, MPU6050_I2C_MST_CLK_BIT, MPU6050_I2C_MST_CLK_LENGTH>::write(devAddr, speed, wireObj);
 }
 
 // I2C_SLV* registers (Slave 0-3)
@@ -1171,7 +1203,7 @@ void MPU6050_Base::setSlave4OutputByte(uint8_t data) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050_Base::getSlave4Enabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set the enabled value for Slave 4.
@@ -1180,7 +1212,7 @@ bool MPU6050_Base::getSlave4Enabled() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050_Base::setSlave4Enabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get the enabled value for Slave 4 transaction interrupts.
  * When set to 1, this bit enables the generation of an interrupt signal upon
@@ -1192,7 +1224,7 @@ void MPU6050_Base::setSlave4Enabled(bool enabled) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050_Base::getSlave4InterruptEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set the enabled value for Slave 4 transaction interrupts.
@@ -1201,7 +1233,7 @@ bool MPU6050_Base::getSlave4InterruptEnabled() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050_Base::setSlave4InterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_INT_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get write mode for Slave 4.
  * When set to 1, the transaction will read or write data only. When cleared to
@@ -1213,7 +1245,7 @@ void MPU6050_Base::setSlave4InterruptEnabled(bool enabled) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 bool MPU6050_Base::getSlave4WriteMode() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set write mode for the Slave 4.
@@ -1222,7 +1254,7 @@ bool MPU6050_Base::getSlave4WriteMode() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050_Base::setSlave4WriteMode(bool mode) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT, mode, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_REG_DIS_BIT>::write(devAddr, mode, wireObj);
 }
 /** Get Slave 4 master delay value.
  * This configures the reduced access rate of I2C slaves relative to the Sample
@@ -1240,7 +1272,7 @@ void MPU6050_Base::setSlave4WriteMode(bool mode) {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 uint8_t MPU6050_Base::getSlave4MasterDelay() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Slave 4 master delay value.
@@ -1249,7 +1281,7 @@ uint8_t MPU6050_Base::getSlave4MasterDelay() {
  * @see MPU6050_RA_I2C_SLV4_CTRL
  */
 void MPU6050_Base::setSlave4MasterDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH, delay, wireObj);
+    I2CdevField<MPU6050_RA_I2C_SLV4_CTRL, MPU6050_I2C_SLV4_MST_DLY_BIT, MPU6050_I2C_SLV4_MST_DLY_LENGTH>::write(devAddr, delay, wireObj);
 }
 /** Get last available byte read from Slave 4.
  * This register stores the data read from Slave 4. This field is populated
@@ -1274,7 +1306,7 @@ uint8_t MPU6050_Base::getSlate4InputByte() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getPassthroughStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_PASS_THROUGH_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_PASS_THROUGH_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Slave 4 transaction done status.
@@ -1286,7 +1318,7 @@ bool MPU6050_Base::getPassthroughStatus() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getSlave4IsDone() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_DONE_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_DONE_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get master arbitration lost status.
@@ -1297,7 +1329,7 @@ bool MPU6050_Base::getSlave4IsDone() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getLostArbitration() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_LOST_ARB_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_LOST_ARB_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Slave 4 NACK status.
@@ -1308,7 +1340,7 @@ bool MPU6050_Base::getLostArbitration() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getSlave4Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_NACK_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV4_NACK_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Slave 3 NACK status.
@@ -1319,7 +1351,7 @@ bool MPU6050_Base::getSlave4Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getSlave3Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV3_NACK_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV3_NACK_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Slave 2 NACK status.
@@ -1330,7 +1362,7 @@ bool MPU6050_Base::getSlave3Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getSlave2Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV2_NACK_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV2_NACK_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Slave 1 NACK status.
@@ -1341,7 +1373,7 @@ bool MPU6050_Base::getSlave2Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getSlave1Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV1_NACK_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV1_NACK_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Slave 0 NACK status.
@@ -1352,7 +1384,7 @@ bool MPU6050_Base::getSlave1Nack() {
  * @see MPU6050_RA_I2C_MST_STATUS
  */
 bool MPU6050_Base::getSlave0Nack() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV0_NACK_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_STATUS, MPU6050_MST_I2C_SLV0_NACK_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 
@@ -1365,7 +1397,7 @@ bool MPU6050_Base::getSlave0Nack() {
  * @see MPU6050_INTCFG_INT_LEVEL_BIT
  */
 bool MPU6050_Base::getInterruptMode() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set interrupt logic level mode.
@@ -1375,7 +1407,7 @@ bool MPU6050_Base::getInterruptMode() {
  * @see MPU6050_INTCFG_INT_LEVEL_BIT
  */
 void MPU6050_Base::setInterruptMode(bool mode) {
-   I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT, mode, wireObj);
+   I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_LEVEL_BIT>::write(devAddr, mode, wireObj);
 }
 /** Get interrupt drive mode.
  * Will be set 0 for push-pull, 1 for open-drain.
@@ -1384,7 +1416,7 @@ void MPU6050_Base::setInterruptMode(bool mode) {
  * @see MPU6050_INTCFG_INT_OPEN_BIT
  */
 bool MPU6050_Base::getInterruptDrive() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set interrupt drive mode.
@@ -1394,7 +1426,7 @@ bool MPU6050_Base::getInterruptDrive() {
  * @see MPU6050_INTCFG_INT_OPEN_BIT
  */
 void MPU6050_Base::setInterruptDrive(bool drive) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT, drive, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_OPEN_BIT>::write(devAddr, drive, wireObj);
 }
 /** Get interrupt latch mode.
  * Will be set 0 for 50us-pulse, 1 for latch-until-int-cleared.
@@ -1403,7 +1435,7 @@ void MPU6050_Base::setInterruptDrive(bool drive) {
  * @see MPU6050_INTCFG_LATCH_INT_EN_BIT
  */
 bool MPU6050_Base::getInterruptLatch() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set interrupt latch mode.
@@ -1413,7 +1445,7 @@ bool MPU6050_Base::getInterruptLatch() {
  * @see MPU6050_INTCFG_LATCH_INT_EN_BIT
  */
 void MPU6050_Base::setInterruptLatch(bool latch) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT, latch, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_LATCH_INT_EN_BIT>::write(devAddr, latch, wireObj);
 }
 /** Get interrupt latch clear mode.
  * Will be set 0 for status-read-only, 1 for any-register-read.
@@ -1422,7 +1454,7 @@ void MPU6050_Base::setInterruptLatch(bool latch) {
  * @see MPU6050_INTCFG_INT_RD_CLEAR_BIT
  */
 bool MPU6050_Base::getInterruptLatchClear() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set interrupt latch clear mode.
@@ -1432,7 +1464,7 @@ bool MPU6050_Base::getInterruptLatchClear() {
  * @see MPU6050_INTCFG_INT_RD_CLEAR_BIT
  */
 void MPU6050_Base::setInterruptLatchClear(bool clear) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT, clear, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_INT_RD_CLEAR_BIT>::write(devAddr, clear, wireObj);
 }
 /** Get FSYNC interrupt logic level mode.
  * @return Current FSYNC interrupt mode (0=active-high, 1=active-low)
@@ -1441,7 +1473,7 @@ void MPU6050_Base::setInterruptLatchClear(bool clear) {
  * @see MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT
  */
 bool MPU6050_Base::getFSyncInterruptLevel() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set FSYNC interrupt logic level mode.
@@ -1451,7 +1483,7 @@ bool MPU6050_Base::getFSyncInterruptLevel() {
  * @see MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT
  */
 void MPU6050_Base::setFSyncInterruptLevel(bool level) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT, level, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_LEVEL_BIT>::write(devAddr, level, wireObj);
 }
 /** Get FSYNC pin interrupt enabled setting.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1460,7 +1492,7 @@ void MPU6050_Base::setFSyncInterruptLevel(bool level) {
  * @see MPU6050_INTCFG_FSYNC_INT_EN_BIT
  */
 bool MPU6050_Base::getFSyncInterruptEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set FSYNC pin interrupt enabled setting.
@@ -1470,7 +1502,7 @@ bool MPU6050_Base::getFSyncInterruptEnabled() {
  * @see MPU6050_INTCFG_FSYNC_INT_EN_BIT
  */
 void MPU6050_Base::setFSyncInterruptEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_FSYNC_INT_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get I2C bypass enabled status.
  * When this bit is equal to 1 and I2C_MST_EN (Register 106 bit[5]) is equal to
@@ -1484,7 +1516,7 @@ void MPU6050_Base::setFSyncInterruptEnabled(bool enabled) {
  * @see MPU6050_INTCFG_I2C_BYPASS_EN_BIT
  */
 bool MPU6050_Base::getI2CBypassEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set I2C bypass enabled status.
@@ -1499,7 +1531,7 @@ bool MPU6050_Base::getI2CBypassEnabled() {
  * @see MPU6050_INTCFG_I2C_BYPASS_EN_BIT
  */
 void MPU6050_Base::setI2CBypassEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_I2C_BYPASS_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get reference clock output enabled status.
  * When this bit is equal to 1, a reference clock output is provided at the
@@ -1511,7 +1543,7 @@ void MPU6050_Base::setI2CBypassEnabled(bool enabled) {
  * @see MPU6050_INTCFG_CLKOUT_EN_BIT
  */
 bool MPU6050_Base::getClockOutputEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set reference clock output enabled status.
@@ -1524,7 +1556,7 @@ bool MPU6050_Base::getClockOutputEnabled() {
  * @see MPU6050_INTCFG_CLKOUT_EN_BIT
  */
 void MPU6050_Base::setClockOutputEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_PIN_CFG, MPU6050_INTCFG_CLKOUT_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 
 // INT_ENABLE register
@@ -1558,7 +1590,7 @@ void MPU6050_Base::setIntEnabled(uint8_t enabled) {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 bool MPU6050_Base::getIntFreefallEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Free Fall interrupt enabled status.
@@ -1568,7 +1600,7 @@ bool MPU6050_Base::getIntFreefallEnabled() {
  * @see MPU6050_INTERRUPT_FF_BIT
  **/
 void MPU6050_Base::setIntFreefallEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FF_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Motion Detection interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1577,7 +1609,7 @@ void MPU6050_Base::setIntFreefallEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_MOT_BIT
  **/
 bool MPU6050_Base::getIntMotionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Motion Detection interrupt enabled status.
@@ -1587,7 +1619,7 @@ bool MPU6050_Base::getIntMotionEnabled() {
  * @see MPU6050_INTERRUPT_MOT_BIT
  **/
 void MPU6050_Base::setIntMotionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_MOT_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Zero Motion Detection interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1596,7 +1628,7 @@ void MPU6050_Base::setIntMotionEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  **/
 bool MPU6050_Base::getIntZeroMotionEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Zero Motion Detection interrupt enabled status.
@@ -1606,7 +1638,7 @@ bool MPU6050_Base::getIntZeroMotionEnabled() {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  **/
 void MPU6050_Base::setIntZeroMotionEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_ZMOT_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get FIFO Buffer Overflow interrupt enabled status.
  * Will be set 0 for disabled, 1 for enabled.
@@ -1615,7 +1647,7 @@ void MPU6050_Base::setIntZeroMotionEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  **/
 bool MPU6050_Base::getIntFIFOBufferOverflowEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set FIFO Buffer Overflow interrupt enabled status.
@@ -1625,7 +1657,7 @@ bool MPU6050_Base::getIntFIFOBufferOverflowEnabled() {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  **/
 void MPU6050_Base::setIntFIFOBufferOverflowEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_FIFO_OFLOW_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get I2C Master interrupt enabled status.
  * This enables any of the I2C Master interrupt sources to generate an
@@ -1635,7 +1667,7 @@ void MPU6050_Base::setIntFIFOBufferOverflowEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  **/
 bool MPU6050_Base::getIntI2CMasterEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set I2C Master interrupt enabled status.
@@ -1645,7 +1677,7 @@ bool MPU6050_Base::getIntI2CMasterEnabled() {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  **/
 void MPU6050_Base::setIntI2CMasterEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_I2C_MST_INT_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Data Ready interrupt enabled setting.
  * This event occurs each time a write operation to all of the sensor registers
@@ -1655,7 +1687,7 @@ void MPU6050_Base::setIntI2CMasterEnabled(bool enabled) {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 bool MPU6050_Base::getIntDataReadyEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Data Ready interrupt enabled status.
@@ -1665,7 +1697,7 @@ bool MPU6050_Base::getIntDataReadyEnabled() {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 void MPU6050_Base::setIntDataReadyEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DATA_RDY_BIT>::write(devAddr, enabled, wireObj);
 }
 
 // INT_STATUS register
@@ -1689,7 +1721,7 @@ uint8_t MPU6050_Base::getIntStatus() {
  * @see MPU6050_INTERRUPT_FF_BIT
  */
 bool MPU6050_Base::getIntFreefallStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FF_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FF_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Motion Detection interrupt status.
@@ -1700,7 +1732,7 @@ bool MPU6050_Base::getIntFreefallStatus() {
  * @see MPU6050_INTERRUPT_MOT_BIT
  */
 bool MPU6050_Base::getIntMotionStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_MOT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_MOT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Zero Motion Detection interrupt status.
@@ -1711,7 +1743,7 @@ bool MPU6050_Base::getIntMotionStatus() {
  * @see MPU6050_INTERRUPT_ZMOT_BIT
  */
 bool MPU6050_Base::getIntZeroMotionStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_ZMOT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_ZMOT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get FIFO Buffer Overflow interrupt status.
@@ -1722,7 +1754,7 @@ bool MPU6050_Base::getIntZeroMotionStatus() {
  * @see MPU6050_INTERRUPT_FIFO_OFLOW_BIT
  */
 bool MPU6050_Base::getIntFIFOBufferOverflowStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FIFO_OFLOW_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_FIFO_OFLOW_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get I2C Master interrupt status.
@@ -1734,7 +1766,7 @@ bool MPU6050_Base::getIntFIFOBufferOverflowStatus() {
  * @see MPU6050_INTERRUPT_I2C_MST_INT_BIT
  */
 bool MPU6050_Base::getIntI2CMasterStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_I2C_MST_INT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_I2C_MST_INT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Data Ready interrupt status.
@@ -1745,14 +1777,16 @@ bool MPU6050_Base::getIntI2CMasterStatus() {
  * @see MPU6050_INTERRUPT_DATA_RDY_BIT
  */
 bool MPU6050_Base::getIntDataReadyStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DATA_RDY_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DATA_RDY_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 
 // ACCEL_*OUT_* registers
 
 /** Get raw 9-axis motion sensor readings (accel/gyro/compass).
- * FUNCTION NOT FULLY IMPLEMENTED YET.
+ * With a magnetometer set up by setAuxMagnetometer(), all nine values come
+ * from one 20-byte burst; otherwise this is getMotion6() with zero compass
+ * values. If the burst fails, the outputs are left unchanged.
  * @param ax 16-bit signed integer container for accelerometer X-axis value
  * @param ay 16-bit signed integer container for accelerometer Y-axis value
  * @param az 16-bit signed integer container for accelerometer Z-axis value
@@ -1765,15 +1799,46 @@ bool MPU6050_Base::getIntDataReadyStatus() {
  * @see getMotion6()
  * @see getAcceleration()
  * @see getRotation()
+ * @see setAuxMagnetometer()
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050_Base::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz, int16_t* mx, int16_t* my, int16_t* mz) {
-    (void)mx; // unused parameter
-    (void)my; // unused parameter
-    (void)mz; // unused parameter
-    
-    getMotion6(ax, ay, az, gx, gy, gz);
-    // TODO: magnetometer integration
+    if (auxMagType == MPU6050_AUX_MAG_NONE) {
+        getMotion6(ax, ay, az, gx, gy, gz);
+        *mx = *my = *mz = 0;
+        return;
+    }
+
+    // ACCEL_XOUT_H through EXT_SENS_DATA_05 in one burst
+    uint8_t data[20];
+    if (I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 20, data, I2Cdev::readTimeout, wireObj) != 20) return;
+    *ax = (((int16_t)data[0]) << 8) | data[1];
+    *ay = (((int16_t)data[2]) << 8) | data[3];
+    *az = (((int16_t)data[4]) << 8) | data[5];
+    *gx = (((int16_t)data[8]) << 8) | data[9];
+    *gy = (((int16_t)data[10]) << 8) | data[11];
+    *gz = (((int16_t)data[12]) << 8) | data[13];
+
+    const uint8_t *mag = data + 14;
+    switch (auxMagType) {
+        case MPU6050_AUX_MAG_HMC5883L:
+            // big-endian, X/Z/Y register order
+            *mx = (((int16_t)mag[0]) << 8) | mag[1];
+            *mz = (((int16_t)mag[2]) << 8) | mag[3];
+            *my = (((int16_t)mag[4]) << 8) | mag[5];
+            break;
+        case MPU6050_AUX_MAG_HMC5843:
+            *mx = (((int16_t)mag[0]) << 8) | mag[1];
+            *my = (((int16_t)mag[2]) << 8) | mag[3];
+            *mz = (((int16_t)mag[4]) << 8) | mag[5];
+            break;
+        default:
+            // AK89xx: little-endian X/Y/Z
+            *mx = (((int16_t)mag[1]) << 8) | mag[0];
+            *my = (((int16_t)mag[3]) << 8) | mag[2];
+            *mz = (((int16_t)mag[5]) << 8) | mag[4];
+            break;
+    }
 }
 /** Get raw 6-axis motion sensor readings (accel/gyro).
  * Retrieves all currently available motion sensor values.
@@ -1788,13 +1853,14 @@ void MPU6050_Base::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050_Base::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, buffer, I2Cdev::readTimeout, wireObj);
-    *ax = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *ay = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *az = (((int16_t)buffer[4]) << 8) | buffer[5];
-    *gx = (((int16_t)buffer[8]) << 8) | buffer[9];
-    *gy = (((int16_t)buffer[10]) << 8) | buffer[11];
-    *gz = (((int16_t)buffer[12]) << 8) | buffer[13];
+    uint8_t data[14] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, data, I2Cdev::readTimeout, wireObj);
+    *ax = (((int16_t)data[0]) << 8) | data[1];
+    *ay = (((int16_t)data[2]) << 8) | data[3];
+    *az = (((int16_t)data[4]) << 8) | data[5];
+    *gx = (((int16_t)data[8]) << 8) | data[9];
+    *gy = (((int16_t)data[10]) << 8) | data[11];
+    *gz = (((int16_t)data[12]) << 8) | data[13];
 }
 /** Get 3-axis accelerometer readings.
  * These registers store the most recent accelerometer measurements.
@@ -1833,10 +1899,11 @@ void MPU6050_Base::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050_Base::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, buffer, I2Cdev::readTimeout, wireObj);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    uint8_t data[6] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, data, I2Cdev::readTimeout, wireObj);
+    *x = (((int16_t)data[0]) << 8) | data[1];
+    *y = (((int16_t)data[2]) << 8) | data[3];
+    *z = (((int16_t)data[4]) << 8) | data[5];
 }
 /** Get X-axis accelerometer reading.
  * @return X-axis acceleration measurement in 16-bit 2's complement format
@@ -1844,8 +1911,9 @@ void MPU6050_Base::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 int16_t MPU6050_Base::getAccelerationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Y-axis accelerometer reading.
  * @return Y-axis acceleration measurement in 16-bit 2's complement format
@@ -1853,8 +1921,9 @@ int16_t MPU6050_Base::getAccelerationX() {
  * @see MPU6050_RA_ACCEL_YOUT_H
  */
 int16_t MPU6050_Base::getAccelerationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Z-axis accelerometer reading.
  * @return Z-axis acceleration measurement in 16-bit 2's complement format
@@ -1862,8 +1931,9 @@ int16_t MPU6050_Base::getAccelerationY() {
  * @see MPU6050_RA_ACCEL_ZOUT_H
  */
 int16_t MPU6050_Base::getAccelerationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // TEMP_OUT_* registers
@@ -1873,8 +1943,9 @@ int16_t MPU6050_Base::getAccelerationZ() {
  * @see MPU6050_RA_TEMP_OUT_H
  */
 int16_t MPU6050_Base::getTemperature() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // GYRO_*OUT_* registers
@@ -1912,10 +1983,11 @@ int16_t MPU6050_Base::getTemperature() {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050_Base::getRotation(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, buffer, I2Cdev::readTimeout, wireObj);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    uint8_t data[6] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, data, I2Cdev::readTimeout, wireObj);
+    *x = (((int16_t)data[0]) << 8) | data[1];
+    *y = (((int16_t)data[2]) << 8) | data[3];
+    *z = (((int16_t)data[4]) << 8) | data[5];
 }
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
@@ -1923,8 +1995,9 @@ void MPU6050_Base::getRotation(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 int16_t MPU6050_Base::getRotationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Y-axis gyroscope reading.
  * @return Y-axis rotation measurement in 16-bit 2's complement format
@@ -1932,8 +2005,9 @@ int16_t MPU6050_Base::getRotationX() {
  * @see MPU6050_RA_GYRO_YOUT_H
  */
 int16_t MPU6050_Base::getRotationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Z-axis gyroscope reading.
  * @return Z-axis rotation measurement in 16-bit 2's complement format
@@ -1941,8 +2015,9 @@ int16_t MPU6050_Base::getRotationY() {
  * @see MPU6050_RA_GYRO_ZOUT_H
  */
 int16_t MPU6050_Base::getRotationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // EXT_SENS_DATA_* registers
@@ -2044,6 +2119,153 @@ uint32_t MPU6050_Base::getExternalSensorDWord(int position) {
     return (((uint32_t)buffer[0]) << 24) | (((uint32_t)buffer[1]) << 16) | (((uint16_t)buffer[2]) << 8) | buffer[3];
 }
 
+// Auxiliary magnetometer
+
+/** Let the MPU's auxiliary I2C master sample an external magnetometer.
+ * The magnetometer is identified and put into a continuous (or, for the
+ * AK8975, triggered) measurement mode through Slave 4, then Slave 0 is set up
+ * to read its six data bytes into EXT_SENS_DATA_00..05 on every sample. For the
+ * AK8975, Slave 1 also writes the single-measurement trigger after each read.
+ * Both slaves are decimated with I2C_MST_DLY so the magnetometer is not polled
+ * faster than it can measure. That decimation is based on the current sample
+ * rate, so set the rate before calling this.
+ *
+ * Once enabled, getMotion9() returns accel, gyro and magnetometer data from a
+ * single 20-byte burst. Magnetometer axes are reported in the magnetometer's
+ * own frame and raw counts; alignment and scaling are left to the caller.
+ *
+ * The magnetometer must sit on the auxiliary bus (AUX_DA/AUX_CL), and the I2C
+ * bypass is turned off so the MPU owns that bus.
+ *
+ * @param type MPU6050_AUX_MAG_* device type (MPU6050_AUX_MAG_NONE disables)
+ * @param address 7-bit magnetometer address, 0 for the device default
+ * @return True if the magnetometer answered with the expected ID and was configured
+ * @see getMotion9()
+ * @see MPU6050_AUX_MAG_HMC5883L
+ */
+bool MPU6050_Base::setAuxMagnetometer(uint8_t type, uint8_t address) {
+    setSlaveEnabled(0, false);
+    setSlaveEnabled(1, false);
+    auxMagType = MPU6050_AUX_MAG_NONE;
+    if (type == MPU6050_AUX_MAG_NONE) return true;
+
+    bool hmc = (type == MPU6050_AUX_MAG_HMC5883L || type == MPU6050_AUX_MAG_HMC5843);
+    if (address == 0) address = hmc ? 0x1E : 0x0C;
+
+    setI2CBypassEnabled(false);
+    setMasterClockSpeed(MPU6050_CLOCK_DIV_400);
+    setI2CMasterModeEnabled(true);
+
+    // HMC58x3 ID_A (0x0A) reads 'H'; AK89xx WIA (0x00) reads 0x48, also 'H'
+    uint8_t id = 0;
+    if (!readAuxRegister(address, hmc ? 0x0A : 0x00, &id) || id != 0x48) return false;
+
+    uint8_t magRate;
+    uint8_t length = 6;
+    switch (type) {
+        case MPU6050_AUX_MAG_HMC5883L:
+        case MPU6050_AUX_MAG_HMC5843:
+            // CONFIG_A: no averaging, 75 Hz (HMC5883L) / 50 Hz (HMC5843); MODE: continuous
+            if (!writeAuxRegister(address, 0x00, 0x18) || !writeAuxRegister(address, 0x02, 0x00)) return false;
+            magRate = type == MPU6050_AUX_MAG_HMC5883L ? 75 : 50;
+            break;
+        case MPU6050_AUX_MAG_AK8963:
+            // CNTL1: power down before switching to 16-bit continuous mode 2 (100 Hz)
+            if (!writeAuxRegister(address, 0x0A, 0x00) || !writeAuxRegister(address, 0x0A, 0x16)) return false;
+            // also read ST2, which releases the data registers for the next measurement
+            length = 7;
+            magRate = 100;
+            break;
+        case MPU6050_AUX_MAG_AK8975:
+            // CNTL: start the first single measurement; Slave 1 triggers the rest
+            if (!writeAuxRegister(address, 0x0A, 0x01)) return false;
+            setSlaveAddress(1, address);
+            setSlaveRegister(1, 0x0A);
+            setSlaveOutputByte(1, 0x01);
+            setSlaveDataLength(1, 1);
+            setSlaveEnabled(1, true);
+            magRate = 100;
+            break;
+        default:
+            return false;
+    }
+
+    // Slave 0: HMC DATA_OUT_X_H (0x03) / AK HXL (0x03) onwards, read mode
+    setSlaveAddress(0, address | 0x80);
+    setSlaveRegister(0, 0x03);
+    setSlaveDataLength(0, length);
+    setSlaveEnabled(0, true);
+
+    // only access the magnetometer every (1 + MST_DLY) samples
+    float rate = getSampleRate();
+    uint8_t masterDelay = rate > magRate ? (uint8_t)(rate / magRate + 0.999f) - 1 : 0;
+    if (masterDelay > 31) masterDelay = 31;
+    setSlave4MasterDelay(masterDelay);
+    setSlaveDelayEnabled(0, masterDelay > 0);
+    setSlaveDelayEnabled(1, masterDelay > 0);
+
+    // hold data ready until the external sensor read has finished, so every
+    // burst of ACCEL_XOUT_H..EXT_SENS_DATA_05 comes from the same sample
+    setWaitForExternalSensorEnabled(true);
+
+    auxMagType = type;
+    return true;
+}
+/** Get the auxiliary magnetometer type set up by setAuxMagnetometer().
+ * @return MPU6050_AUX_MAG_* device type
+ */
+uint8_t MPU6050_Base::getAuxMagnetometer() {
+    return auxMagType;
+}
+/** Read a register of a device on the auxiliary I2C bus through Slave 4.
+ * The I2C master must be enabled. Slave 4 transfers run at the sample rate, so
+ * this may block for up to one sample period.
+ * @param address 7-bit device address on the auxiliary bus
+ * @param reg Device register to read
+ * @param data Container for the register value
+ * @return True if the transfer completed and was acknowledged
+ */
+bool MPU6050_Base::readAuxRegister(uint8_t address, uint8_t reg, uint8_t *data) {
+    setSlave4Address(address | 0x80);
+    setSlave4Register(reg);
+    setSlave4Enabled(true);
+
+    uint32_t start = millis();
+    do {
+        // reading I2C_MST_STATUS clears it, so check both flags from one read
+        I2Cdev::readByte(devAddr, MPU6050_RA_I2C_MST_STATUS, buffer, I2Cdev::readTimeout, wireObj);
+        if (buffer[0] & (1 << MPU6050_MST_I2C_SLV4_NACK_BIT)) return false;
+        if (buffer[0] & (1 << MPU6050_MST_I2C_SLV4_DONE_BIT)) {
+            *data = getSlate4InputByte();
+            return true;
+        }
+    } while (millis() - start < MPU6050_AUX_TIMEOUT);
+    setSlave4Enabled(false);
+    return false;
+}
+/** Write a register of a device on the auxiliary I2C bus through Slave 4.
+ * @param address 7-bit device address on the auxiliary bus
+ * @param reg Device register to write
+ * @param data New register value
+ * @return True if the transfer completed and was acknowledged
+ * @see readAuxRegister()
+ */
+bool MPU6050_Base::writeAuxRegister(uint8_t address, uint8_t reg, uint8_t data) {
+    setSlave4Address(address & 0x7F);
+    setSlave4Register(reg);
+    setSlave4OutputByte(data);
+    setSlave4Enabled(true);
+
+    uint32_t start = millis();
+    do {
+        I2Cdev::readByte(devAddr, MPU6050_RA_I2C_MST_STATUS, buffer, I2Cdev::readTimeout, wireObj);
+        if (buffer[0] & (1 << MPU6050_MST_I2C_SLV4_NACK_BIT)) return false;
+        if (buffer[0] & (1 << MPU6050_MST_I2C_SLV4_DONE_BIT)) return true;
+    } while (millis() - start < MPU6050_AUX_TIMEOUT);
+    setSlave4Enabled(false);
+    return false;
+}
+
 // MOT_DETECT_STATUS register
 
 /** Get full motion detection status register content (all bits).
@@ -2060,7 +2282,7 @@ uint8_t MPU6050_Base::getMotionStatus() {
  * @see MPU6050_MOTION_MOT_XNEG_BIT
  */
 bool MPU6050_Base::getXNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XNEG_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XNEG_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get X-axis positive motion detection interrupt status.
@@ -2069,7 +2291,7 @@ bool MPU6050_Base::getXNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_XPOS_BIT
  */
 bool MPU6050_Base::getXPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XPOS_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_XPOS_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Y-axis negative motion detection interrupt status.
@@ -2078,7 +2300,7 @@ bool MPU6050_Base::getXPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_YNEG_BIT
  */
 bool MPU6050_Base::getYNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YNEG_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YNEG_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Y-axis positive motion detection interrupt status.
@@ -2087,7 +2309,7 @@ bool MPU6050_Base::getYNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_YPOS_BIT
  */
 bool MPU6050_Base::getYPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YPOS_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_YPOS_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Z-axis negative motion detection interrupt status.
@@ -2096,7 +2318,7 @@ bool MPU6050_Base::getYPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZNEG_BIT
  */
 bool MPU6050_Base::getZNegMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZNEG_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZNEG_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get Z-axis positive motion detection interrupt status.
@@ -2105,7 +2327,7 @@ bool MPU6050_Base::getZNegMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZPOS_BIT
  */
 bool MPU6050_Base::getZPosMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZPOS_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZPOS_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Get zero motion detection interrupt status.
@@ -2114,7 +2336,7 @@ bool MPU6050_Base::getZPosMotionDetected() {
  * @see MPU6050_MOTION_MOT_ZRMOT_BIT
  */
 bool MPU6050_Base::getZeroMotionDetected() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZRMOT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_STATUS, MPU6050_MOTION_MOT_ZRMOT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 
@@ -2144,7 +2366,7 @@ void MPU6050_Base::setSlaveOutputByte(uint8_t num, uint8_t data) {
  * @see MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT
  */
 bool MPU6050_Base::getExternalShadowDelayEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set external data shadow delay enabled status.
@@ -2154,7 +2376,7 @@ bool MPU6050_Base::getExternalShadowDelayEnabled() {
  * @see MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT
  */
 void MPU6050_Base::setExternalShadowDelayEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_I2C_MST_DELAY_CTRL, MPU6050_DELAYCTRL_DELAY_ES_SHADOW_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get slave delay enabled status.
  * When a particular slave delay is enabled, the rate of access for the that
@@ -2199,7 +2421,7 @@ void MPU6050_Base::setSlaveDelayEnabled(uint8_t num, bool enabled) {
  * @see MPU6050_PATHRESET_GYRO_RESET_BIT
  */
 void MPU6050_Base::resetGyroscopePath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_GYRO_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_GYRO_RESET_BIT>::write(devAddr, true, wireObj);
 }
 /** Reset accelerometer signal path.
  * The reset will revert the signal path analog to digital converters and
@@ -2208,7 +2430,7 @@ void MPU6050_Base::resetGyroscopePath() {
  * @see MPU6050_PATHRESET_ACCEL_RESET_BIT
  */
 void MPU6050_Base::resetAccelerometerPath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_ACCEL_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_ACCEL_RESET_BIT>::write(devAddr, true, wireObj);
 }
 /** Reset temperature sensor signal path.
  * The reset will revert the signal path analog to digital converters and
@@ -2217,7 +2439,7 @@ void MPU6050_Base::resetAccelerometerPath() {
  * @see MPU6050_PATHRESET_TEMP_RESET_BIT
  */
 void MPU6050_Base::resetTemperaturePath() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_TEMP_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_SIGNAL_PATH_RESET, MPU6050_PATHRESET_TEMP_RESET_BIT>::write(devAddr, true, wireObj);
 }
 
 // MOT_DETECT_CTRL register
@@ -2237,7 +2459,7 @@ void MPU6050_Base::resetTemperaturePath() {
  * @see MPU6050_DETECT_ACCEL_ON_DELAY_BIT
  */
 uint8_t MPU6050_Base::getAccelerometerPowerOnDelay() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set accelerometer power-on delay.
@@ -2247,7 +2469,7 @@ uint8_t MPU6050_Base::getAccelerometerPowerOnDelay() {
  * @see MPU6050_DETECT_ACCEL_ON_DELAY_BIT
  */
 void MPU6050_Base::setAccelerometerPowerOnDelay(uint8_t delay) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH, delay, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_ACCEL_ON_DELAY_BIT, MPU6050_DETECT_ACCEL_ON_DELAY_LENGTH>::write(devAddr, delay, wireObj);
 }
 /** Get Free Fall detection counter decrement configuration.
  * Detection is registered by the Free Fall detection module after accelerometer
@@ -2276,7 +2498,7 @@ void MPU6050_Base::setAccelerometerPowerOnDelay(uint8_t delay) {
  * @see MPU6050_DETECT_FF_COUNT_BIT
  */
 uint8_t MPU6050_Base::getFreefallDetectionCounterDecrement() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Free Fall detection counter decrement configuration.
@@ -2286,7 +2508,7 @@ uint8_t MPU6050_Base::getFreefallDetectionCounterDecrement() {
  * @see MPU6050_DETECT_FF_COUNT_BIT
  */
 void MPU6050_Base::setFreefallDetectionCounterDecrement(uint8_t decrement) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH, decrement, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_FF_COUNT_BIT, MPU6050_DETECT_FF_COUNT_LENGTH>::write(devAddr, decrement, wireObj);
 }
 /** Get Motion detection counter decrement configuration.
  * Detection is registered by the Motion detection module after accelerometer
@@ -2312,7 +2534,7 @@ void MPU6050_Base::setFreefallDetectionCounterDecrement(uint8_t decrement) {
  *
  */
 uint8_t MPU6050_Base::getMotionDetectionCounterDecrement() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Motion detection counter decrement configuration.
@@ -2322,7 +2544,7 @@ uint8_t MPU6050_Base::getMotionDetectionCounterDecrement() {
  * @see MPU6050_DETECT_MOT_COUNT_BIT
  */
 void MPU6050_Base::setMotionDetectionCounterDecrement(uint8_t decrement) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH, decrement, wireObj);
+    I2CdevField<MPU6050_RA_MOT_DETECT_CTRL, MPU6050_DETECT_MOT_COUNT_BIT, MPU6050_DETECT_MOT_COUNT_LENGTH>::write(devAddr, decrement, wireObj);
 }
 
 // USER_CTRL register
@@ -2336,7 +2558,7 @@ void MPU6050_Base::setMotionDetectionCounterDecrement(uint8_t decrement) {
  * @see MPU6050_USERCTRL_FIFO_EN_BIT
  */
 bool MPU6050_Base::getFIFOEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set FIFO enabled status.
@@ -2346,7 +2568,7 @@ bool MPU6050_Base::getFIFOEnabled() {
  * @see MPU6050_USERCTRL_FIFO_EN_BIT
  */
 void MPU6050_Base::setFIFOEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get I2C Master Mode enabled status.
  * When this mode is enabled, the MPU-60X0 acts as the I2C Master to the
@@ -2360,7 +2582,7 @@ void MPU6050_Base::setFIFOEnabled(bool enabled) {
  * @see MPU6050_USERCTRL_I2C_MST_EN_BIT
  */
 bool MPU6050_Base::getI2CMasterModeEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set I2C Master Mode enabled status.
@@ -2370,14 +2592,14 @@ bool MPU6050_Base::getI2CMasterModeEnabled() {
  * @see MPU6050_USERCTRL_I2C_MST_EN_BIT
  */
 void MPU6050_Base::setI2CMasterModeEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Switch from I2C to SPI mode (MPU-6000 only)
  * If this is set, the primary SPI interface will be enabled in place of the
  * disabled primary I2C interface.
  */
 void MPU6050_Base::switchSPIEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_IF_DIS_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_IF_DIS_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Reset the FIFO.
  * This bit resets the FIFO buffer when set to 1 while FIFO_EN equals 0. This
@@ -2386,7 +2608,7 @@ void MPU6050_Base::switchSPIEnabled(bool enabled) {
  * @see MPU6050_USERCTRL_FIFO_RESET_BIT
  */
 void MPU6050_Base::resetFIFO() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_FIFO_RESET_BIT>::write(devAddr, true, wireObj);
 }
 /** Reset the I2C Master.
  * This bit resets the I2C Master when set to 1 while I2C_MST_EN equals 0.
@@ -2395,7 +2617,7 @@ void MPU6050_Base::resetFIFO() {
  * @see MPU6050_USERCTRL_I2C_MST_RESET_BIT
  */
 void MPU6050_Base::resetI2CMaster() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_I2C_MST_RESET_BIT>::write(devAddr, true, wireObj);
 }
 /** Reset all sensor registers and signal paths.
  * When set to 1, this bit resets the signal paths for all sensors (gyroscopes,
@@ -2410,7 +2632,7 @@ void MPU6050_Base::resetI2CMaster() {
  * @see MPU6050_USERCTRL_SIG_COND_RESET_BIT
  */
 void MPU6050_Base::resetSensors() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_SIG_COND_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_SIG_COND_RESET_BIT>::write(devAddr, true, wireObj);
 }
 
 // PWR_MGMT_1 register
@@ -2421,7 +2643,7 @@ void MPU6050_Base::resetSensors() {
  * @see MPU6050_PWR1_DEVICE_RESET_BIT
  */
 void MPU6050_Base::reset() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_DEVICE_RESET_BIT>::write(devAddr, true, wireObj);
 }
 /** Get sleep mode status.
  * Setting the SLEEP bit in the register puts the device into very low power
@@ -2435,7 +2657,7 @@ void MPU6050_Base::reset() {
  * @see MPU6050_PWR1_SLEEP_BIT
  */
 bool MPU6050_Base::getSleepEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set sleep mode status.
@@ -2445,7 +2667,7 @@ bool MPU6050_Base::getSleepEnabled() {
  * @see MPU6050_PWR1_SLEEP_BIT
  */
 void MPU6050_Base::setSleepEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_SLEEP_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get wake cycle enabled status.
  * When this bit is set to 1 and SLEEP is disabled, the MPU-60X0 will cycle
@@ -2456,7 +2678,7 @@ void MPU6050_Base::setSleepEnabled(bool enabled) {
  * @see MPU6050_PWR1_CYCLE_BIT
  */
 bool MPU6050_Base::getWakeCycleEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set wake cycle enabled status.
@@ -2466,7 +2688,7 @@ bool MPU6050_Base::getWakeCycleEnabled() {
  * @see MPU6050_PWR1_CYCLE_BIT
  */
 void MPU6050_Base::setWakeCycleEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CYCLE_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get temperature sensor enabled status.
  * Control the usage of the internal temperature sensor.
@@ -2480,7 +2702,7 @@ void MPU6050_Base::setWakeCycleEnabled(bool enabled) {
  * @see MPU6050_PWR1_TEMP_DIS_BIT
  */
 bool MPU6050_Base::getTempSensorEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0] == 0; // 1 is actually disabled here
 }
 /** Set temperature sensor enabled status.
@@ -2495,7 +2717,7 @@ bool MPU6050_Base::getTempSensorEnabled() {
  */
 void MPU6050_Base::setTempSensorEnabled(bool enabled) {
     // 1 is actually disabled here
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT, !enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_TEMP_DIS_BIT>::write(devAddr, !enabled, wireObj);
 }
 /** Get clock source setting.
  * @return Current clock source setting
@@ -2504,7 +2726,7 @@ void MPU6050_Base::setTempSensorEnabled(bool enabled) {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 uint8_t MPU6050_Base::getClockSource() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set clock source setting.
@@ -2538,7 +2760,7 @@ uint8_t MPU6050_Base::getClockSource() {
  * @see MPU6050_PWR1_CLKSEL_LENGTH
  */
 void MPU6050_Base::setClockSource(uint8_t source) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH, source, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_1, MPU6050_PWR1_CLKSEL_BIT, MPU6050_PWR1_CLKSEL_LENGTH>::write(devAddr, source, wireObj);
 }
 
 // PWR_MGMT_2 register
@@ -2567,7 +2789,7 @@ void MPU6050_Base::setClockSource(uint8_t source) {
  * @see MPU6050_RA_PWR_MGMT_2
  */
 uint8_t MPU6050_Base::getWakeFrequency() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set wake frequency in Accel-Only Low Power Mode.
@@ -2575,7 +2797,7 @@ uint8_t MPU6050_Base::getWakeFrequency() {
  * @see MPU6050_RA_PWR_MGMT_2
  */
 void MPU6050_Base::setWakeFrequency(uint8_t frequency) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH, frequency, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_LP_WAKE_CTRL_BIT, MPU6050_PWR2_LP_WAKE_CTRL_LENGTH>::write(devAddr, frequency, wireObj);
 }
 
 /** Get X-axis accelerometer standby enabled status.
@@ -2585,7 +2807,7 @@ void MPU6050_Base::setWakeFrequency(uint8_t frequency) {
  * @see MPU6050_PWR2_STBY_XA_BIT
  */
 bool MPU6050_Base::getStandbyXAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set X-axis accelerometer standby enabled status.
@@ -2595,7 +2817,7 @@ bool MPU6050_Base::getStandbyXAccelEnabled() {
  * @see MPU6050_PWR2_STBY_XA_BIT
  */
 void MPU6050_Base::setStandbyXAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XA_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Y-axis accelerometer standby enabled status.
  * If enabled, the Y-axis will not gather or report data (or use power).
@@ -2604,7 +2826,7 @@ void MPU6050_Base::setStandbyXAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_YA_BIT
  */
 bool MPU6050_Base::getStandbyYAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Y-axis accelerometer standby enabled status.
@@ -2614,7 +2836,7 @@ bool MPU6050_Base::getStandbyYAccelEnabled() {
  * @see MPU6050_PWR2_STBY_YA_BIT
  */
 void MPU6050_Base::setStandbyYAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YA_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Z-axis accelerometer standby enabled status.
  * If enabled, the Z-axis will not gather or report data (or use power).
@@ -2623,7 +2845,7 @@ void MPU6050_Base::setStandbyYAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_ZA_BIT
  */
 bool MPU6050_Base::getStandbyZAccelEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Z-axis accelerometer standby enabled status.
@@ -2633,7 +2855,7 @@ bool MPU6050_Base::getStandbyZAccelEnabled() {
  * @see MPU6050_PWR2_STBY_ZA_BIT
  */
 void MPU6050_Base::setStandbyZAccelEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZA_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get X-axis gyroscope standby enabled status.
  * If enabled, the X-axis will not gather or report data (or use power).
@@ -2642,7 +2864,7 @@ void MPU6050_Base::setStandbyZAccelEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_XG_BIT
  */
 bool MPU6050_Base::getStandbyXGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set X-axis gyroscope standby enabled status.
@@ -2652,7 +2874,7 @@ bool MPU6050_Base::getStandbyXGyroEnabled() {
  * @see MPU6050_PWR2_STBY_XG_BIT
  */
 void MPU6050_Base::setStandbyXGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_XG_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Y-axis gyroscope standby enabled status.
  * If enabled, the Y-axis will not gather or report data (or use power).
@@ -2661,7 +2883,7 @@ void MPU6050_Base::setStandbyXGyroEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_YG_BIT
  */
 bool MPU6050_Base::getStandbyYGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Y-axis gyroscope standby enabled status.
@@ -2671,7 +2893,7 @@ bool MPU6050_Base::getStandbyYGyroEnabled() {
  * @see MPU6050_PWR2_STBY_YG_BIT
  */
 void MPU6050_Base::setStandbyYGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_YG_BIT>::write(devAddr, enabled, wireObj);
 }
 /** Get Z-axis gyroscope standby enabled status.
  * If enabled, the Z-axis will not gather or report data (or use power).
@@ -2680,7 +2902,7 @@ void MPU6050_Base::setStandbyYGyroEnabled(bool enabled) {
  * @see MPU6050_PWR2_STBY_ZG_BIT
  */
 bool MPU6050_Base::getStandbyZGyroEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Z-axis gyroscope standby enabled status.
@@ -2690,7 +2912,7 @@ bool MPU6050_Base::getStandbyZGyroEnabled() {
  * @see MPU6050_PWR2_STBY_ZG_BIT
  */
 void MPU6050_Base::setStandbyZGyroEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_PWR_MGMT_2, MPU6050_PWR2_STBY_ZG_BIT>::write(devAddr, enabled, wireObj);
 }
 
 // FIFO_COUNT* registers
@@ -2703,8 +2925,9 @@ void MPU6050_Base::setStandbyZGyroEnabled(bool enabled) {
  * @return Current FIFO buffer size
  */
 uint16_t MPU6050_Base::getFIFOCount() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, buffer, I2Cdev::readTimeout, wireObj);
-    return (((uint16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, data, I2Cdev::readTimeout, wireObj);
+    return (((uint16_t)data[0]) << 8) | data[1];
 }
 
 // FIFO_R_W register
@@ -2735,12 +2958,13 @@ uint16_t MPU6050_Base::getFIFOCount() {
  * @return Byte from FIFO buffer
  */
 uint8_t MPU6050_Base::getFIFOByte() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, buffer, I2Cdev::readTimeout, wireObj);
-    return buffer[0];
+    uint8_t data[1] = { 0 };
+    I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, data, I2Cdev::readTimeout, wireObj);
+    return data[0];
 }
-void MPU6050_Base::getFIFOBytes(uint8_t *data, uint8_t length) {
+void MPU6050_Base::getFIFOBytes(uint8_t *data, uint16_t length) {
     if(length > 0){
-        I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_R_W, length, data, I2Cdev::readTimeout, wireObj);
+        I2Cdev::readBytesLong(devAddr, MPU6050_RA_FIFO_R_W, length, data, I2Cdev::readTimeout, wireObj);
     } else {
     	*data = 0;
     }
@@ -2822,7 +3046,7 @@ void MPU6050_Base::setFIFOByte(uint8_t data) {
  * @see MPU6050_WHO_AM_I_LENGTH
  */
 uint8_t MPU6050_Base::getDeviceID() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 /** Set Device ID.
@@ -2835,7 +3059,7 @@ uint8_t MPU6050_Base::getDeviceID() {
  * @see MPU6050_WHO_AM_I_LENGTH
  */
 void MPU6050_Base::setDeviceID(uint8_t id) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH, id, wireObj);
+    I2CdevField<MPU6050_RA_WHO_AM_I, MPU6050_WHO_AM_I_BIT, MPU6050_WHO_AM_I_LENGTH>::write(devAddr, id, wireObj);
 }
 
 // ======== UNDOCUMENTED/DMP REGISTERS/METHODS ========
@@ -2843,38 +3067,38 @@ void MPU6050_Base::setDeviceID(uint8_t id) {
 // XG_OFFS_TC register
 
 uint8_t MPU6050_Base::getOTPBankValid() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 void MPU6050_Base::setOTPBankValid(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OTP_BNK_VLD_BIT>::write(devAddr, enabled, wireObj);
 }
 int8_t MPU6050_Base::getXGyroOffsetTC() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 void MPU6050_Base::setXGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset, wireObj);
+    I2CdevField<MPU6050_RA_XG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset, wireObj);
 }
 
 // YG_OFFS_TC register
 
 int8_t MPU6050_Base::getYGyroOffsetTC() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 void MPU6050_Base::setYGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset, wireObj);
+    I2CdevField<MPU6050_RA_YG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset, wireObj);
 }
 
 // ZG_OFFS_TC register
 
 int8_t MPU6050_Base::getZGyroOffsetTC() {
-    I2Cdev::readBits(devAddr, MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 void MPU6050_Base::setZGyroOffsetTC(int8_t offset) {
-    I2Cdev::writeBits(devAddr, MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH, offset, wireObj);
+    I2CdevField<MPU6050_RA_ZG_OFFS_TC, MPU6050_TC_OFFSET_BIT, MPU6050_TC_OFFSET_LENGTH>::write(devAddr, offset, wireObj);
 }
 
 // X_FINE_GAIN register
@@ -2976,69 +3200,69 @@ void MPU6050_Base::setZGyroOffset(int16_t offset) {
 // INT_ENABLE register (DMP functions)
 
 bool MPU6050_Base::getIntPLLReadyEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 void MPU6050_Base::setIntPLLReadyEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_PLL_RDY_INT_BIT>::write(devAddr, enabled, wireObj);
 }
 bool MPU6050_Base::getIntDMPEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 void MPU6050_Base::setIntDMPEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_INT_ENABLE, MPU6050_INTERRUPT_DMP_INT_BIT>::write(devAddr, enabled, wireObj);
 }
 
 // DMP_INT_STATUS
 
 bool MPU6050_Base::getDMPInt5Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_5_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_5_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 bool MPU6050_Base::getDMPInt4Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_4_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_4_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 bool MPU6050_Base::getDMPInt3Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_3_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_3_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 bool MPU6050_Base::getDMPInt2Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_2_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_2_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 bool MPU6050_Base::getDMPInt1Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_1_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_1_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 bool MPU6050_Base::getDMPInt0Status() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_0_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_DMP_INT_STATUS, MPU6050_DMPINT_0_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 
 // INT_STATUS register (DMP functions)
 
 bool MPU6050_Base::getIntPLLReadyStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_PLL_RDY_INT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_PLL_RDY_INT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 bool MPU6050_Base::getIntDMPStatus() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DMP_INT_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_INT_STATUS, MPU6050_INTERRUPT_DMP_INT_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 
 // USER_CTRL register (DMP functions)
 
 bool MPU6050_Base::getDMPEnabled() {
-    I2Cdev::readBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, buffer, I2Cdev::readTimeout, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT>::read(devAddr, buffer, I2Cdev::readTimeout, wireObj);
     return buffer[0];
 }
 void MPU6050_Base::setDMPEnabled(bool enabled) {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT, enabled, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_EN_BIT>::write(devAddr, enabled, wireObj);
 }
 void MPU6050_Base::resetDMP() {
-    I2Cdev::writeBit(devAddr, MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT, true, wireObj);
+    I2CdevField<MPU6050_RA_USER_CTRL, MPU6050_USERCTRL_DMP_RESET_BIT>::write(devAddr, true, wireObj);
 }
 
 // BANK_SEL register
@@ -3275,6 +3499,31 @@ void MPU6050_Base::setDMPConfig2(uint8_t config) {
     I2Cdev::writeByte(devAddr, MPU6050_RA_DMP_CFG_2, config, wireObj);
 }
 
+// Register map snapshot
+
+/** Read the complete writable configuration of the device.
+ * Reads all configuration, offset, interrupt and auxiliary I2C master
+ * registers in MPU6050_STATE_BLOCKS contiguous bursts instead of one
+ * transaction per getter. DMP firmware and memory banks are not included.
+ * @param state Buffer of at least MPU6050_STATE_SIZE bytes
+ * @return Status of operation (true = success)
+ * @see restoreState()
+ */
+bool MPU6050_Base::saveState(uint8_t *state) {
+    return I2Cdev::readRegisterMap(devAddr, mpu6050StateBlocks, MPU6050_STATE_BLOCKS, state, I2Cdev::readTimeout, wireObj);
+}
+/** Write a configuration snapshot back to the device.
+ * Intended for bringing a reconnected or reset device back to a known state
+ * in a handful of bursts. If the snapshot has the DMP enabled, the DMP
+ * firmware must be loaded again before calling this.
+ * @param state Buffer previously filled by saveState()
+ * @return Status of operation (true = success)
+ * @see saveState()
+ */
+bool MPU6050_Base::restoreState(const uint8_t *state) {
+    return I2Cdev::writeRegisterMap(devAddr, mpu6050StateBlocks, MPU6050_STATE_BLOCKS, state, wireObj);
+}
+
 
 //***************************************************************************************
 //**********************           Calibration Routines            **********************
@@ -3395,3 +3644,271 @@ void MPU6050_Base::PrintActiveOffsets() {
     Serial.print((float)offsets[4], 5); Serial.print(",\t");
     Serial.print((float)offsets[5], 5); Serial.print("\n\n");
 }
+
+/** Read all six offset registers.
+ * Gyro offsets (XG_OFFS_USR*) are read in one burst, as are the accelerometer
+ * offsets on the MPU-6050 (XA_OFFS_*). The MPU-6500 family keeps its
+ * accelerometer offsets at 0x77/0x7A/0x7D with reserved bytes in between, so
+ * those take one 2-byte read each.
+ * @param offsets Container for accel X/Y/Z then gyro X/Y/Z offsets
+ * @see writeOffsets()
+ */
+void MPU6050_Base::readOffsets(int16_t *offsets) {
+    uint8_t data[6] = { 0 };
+    if (getDeviceID() < 0x38) {
+        I2Cdev::readBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data, I2Cdev::readTimeout, wireObj);
+    } else {
+        for (uint8_t i = 0; i < 3; i++) {
+            I2Cdev::readBytes(devAddr, 0x77 + i * 3, 2, data + i * 2, I2Cdev::readTimeout, wireObj);
+        }
+    }
+    for (uint8_t i = 0; i < 3; i++) offsets[i] = (((int16_t)data[i * 2]) << 8) | data[i * 2 + 1];
+
+    I2Cdev::readBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data, I2Cdev::readTimeout, wireObj);
+    for (uint8_t i = 0; i < 3; i++) offsets[i + 3] = (((int16_t)data[i * 2]) << 8) | data[i * 2 + 1];
+}
+/** Write all six offset registers in as few bursts as the part allows.
+ * @param offsets Accel X/Y/Z then gyro X/Y/Z offsets
+ * @see readOffsets()
+ */
+void MPU6050_Base::writeOffsets(const int16_t *offsets) {
+    uint8_t data[6];
+    for (uint8_t i = 0; i < 3; i++) {
+        data[i * 2] = offsets[i] >> 8;
+        data[i * 2 + 1] = offsets[i];
+    }
+    if (getDeviceID() < 0x38) {
+        I2Cdev::writeBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data, wireObj);
+    } else {
+        for (uint8_t i = 0; i < 3; i++) {
+            I2Cdev::writeBytes(devAddr, 0x77 + i * 3, 2, data + i * 2, wireObj);
+        }
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+        data[i * 2] = offsets[i + 3] >> 8;
+        data[i * 2 + 1] = offsets[i + 3];
+    }
+    I2Cdev::writeBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data, wireObj);
+}
+/** Calibrate accelerometer and/or gyroscope offsets.
+ * The device must be stationary with the Z axis pointing up. Each iteration
+ * averages a block of accel+gyro samples collected through the FIFO, then
+ * corrects the offset registers directly from the measured mean error (the
+ * register-to-output relation is linear, so no PID loop is needed). It stops
+ * as soon as every calibrated axis is within one offset step of zero, or
+ * after maxIterations, so the run time is bounded by roughly
+ * maxIterations * samples milliseconds. Two or three iterations are typical.
+ *
+ * Range, filter, rate and FIFO configuration are saved with saveState() and
+ * restored afterwards; only the calibrated offsets are kept. The DMP is paused
+ * while sampling, so reset the FIFO before reading DMP packets again.
+ *
+ * @param sensors MPU6050_CALIBRATE_ACCEL and/or MPU6050_CALIBRATE_GYRO
+ * @param maxIterations Upper bound on measure/correct iterations
+ * @param samples Samples averaged per iteration (1 ms each)
+ * @param residual Optional container for the last measured mean error of
+ *        accel X/Y/Z (+/-2g LSB, gravity removed from Z) and gyro X/Y/Z
+ *        (+/-250 deg/s LSB)
+ * @return True if all calibrated axes converged within tolerance
+ * @see MPU6050_CALIBRATION_ACCEL_TOLERANCE
+ * @see MPU6050_CALIBRATION_GYRO_TOLERANCE
+ */
+bool MPU6050_Base::calibrateOffsets(uint8_t sensors, uint8_t maxIterations, uint16_t samples, int16_t *residual) {
+    uint8_t state[MPU6050_STATE_SIZE];
+    if (!saveState(state)) return false;
+
+    // 1 kHz sampling through a 42 Hz filter, at the ranges the offset
+    // register scaling below assumes
+    setDMPEnabled(false);
+    setFIFOEnabled(false);
+    setDLPFMode(MPU6050_DLPF_BW_42);
+    setRate(0);
+    setFullScaleAccelRange(MPU6050_ACCEL_FS_2);
+    setFullScaleGyroRange(MPU6050_GYRO_FS_250);
+    delay(20); // let the filter settle after the range change
+
+    int16_t offs[6];
+    int16_t means[6] = { 0, 0, 0, 0, 0, 0 };
+    readOffsets(offs);
+
+    bool converged = false;
+    bool sampled = false;
+    for (uint8_t iteration = 0; iteration < maxIterations; iteration++) {
+        if (!getFIFOMeans(samples, means)) break;
+        sampled = true;
+        means[2] -= 16384; // remove gravity from Z
+
+        converged = true;
+        for (uint8_t i = 0; i < 6; i++) {
+            bool accel = i < 3;
+            if (!(sensors & (accel ? MPU6050_CALIBRATE_ACCEL : MPU6050_CALIBRATE_GYRO))) continue;
+            int16_t tolerance = accel ? MPU6050_CALIBRATION_ACCEL_TOLERANCE : MPU6050_CALIBRATION_GYRO_TOLERANCE;
+            if (means[i] > tolerance || means[i] < -tolerance) converged = false;
+
+            // accel offsets are in +/-16g LSB (8 output LSB each at +/-2g) and
+            // bit 0 must be kept; gyro offsets are in +/-1000 deg/s LSB (4
+            // output LSB each at +/-250 deg/s)
+            int16_t step = accel ? 8 : 4;
+            int16_t delta = (means[i] + (means[i] < 0 ? -step / 2 : step / 2)) / step;
+            if (accel) offs[i] = ((offs[i] - delta) & 0xFFFE) | (offs[i] & 1);
+            else offs[i] -= delta;
+        }
+        if (converged) break;
+
+        writeOffsets(offs);
+        delay(5); // flush pre-correction samples out of the filter
+    }
+
+    // restore configuration, which also restores the old offset registers
+    // covered by the snapshot, then put the calibrated ones back
+    int16_t calibrated[6];
+    readOffsets(calibrated);
+    restoreState(state);
+    writeOffsets(calibrated);
+    resetFIFO();
+
+    if (residual && sampled) {
+        for (uint8_t i = 0; i < 6; i++) residual[i] = means[i];
+    }
+    return converged;
+}
+/** Average accel and gyro samples collected through the FIFO.
+ * Samples are gathered in batches that fit the FIFO: the FIFO is reset, fills
+ * with 12-byte accel+gyro records until a batch is queued, stops, and is then
+ * drained in bursts. FIFO writes are off while draining, so a slow bus can
+ * never overflow it.
+ * @param samples Number of samples to average
+ * @param means Container for accel X/Y/Z then gyro X/Y/Z means
+ * @return True if all samples were collected in time
+ */
+bool MPU6050_Base::getFIFOMeans(uint16_t samples, int16_t *means) {
+    int32_t sums[6] = { 0, 0, 0, 0, 0, 0 };
+    uint8_t data[8 * 12];
+    uint16_t collected = 0;
+
+    while (collected < samples) {
+        uint16_t batch = samples - collected;
+        if (batch > MPU6050_CALIBRATION_BATCH) batch = MPU6050_CALIBRATION_BATCH;
+
+        I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_EN, 0x00, wireObj);
+        resetFIFO();
+        setFIFOEnabled(true);
+        // XG, YG, ZG and ACCEL FIFO enables: ACCEL_X..Z then GYRO_X..Z per record
+        I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_EN, 0x78, wireObj);
+
+        uint32_t start = millis();
+        while (getFIFOCount() < batch * 12) {
+            if (millis() - start > (uint32_t)batch * 2 + 50) {
+                I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_EN, 0x00, wireObj);
+                return false;
+            }
+            delay(1);
+        }
+        I2Cdev::writeByte(devAddr, MPU6050_RA_FIFO_EN, 0x00, wireObj);
+
+        for (uint16_t left = batch; left > 0; ) {
+            uint8_t n = left > 8 ? 8 : left;
+            getFIFOBytes(data, n * 12);
+            for (uint8_t s = 0; s < n; s++) {
+                for (uint8_t i = 0; i < 6; i++) {
+                    sums[i] += (int16_t)((((int16_t)data[s * 12 + i * 2]) << 8) | data[s * 12 + i * 2 + 1]);
+                }
+            }
+            left -= n;
+        }
+        collected += batch;
+    }
+    setFIFOEnabled(false);
+
+    for (uint8_t i = 0; i < 6; i++) {
+        means[i] = (sums[i] + (sums[i] < 0 ? -(int32_t)samples / 2 : (int32_t)samples / 2)) / (int32_t)samples;
+    }
+    return true;
+}
+/** Capture the current offsets as a calibration record.
+ * Call this after a successful calibrateOffsets() (or CalibrateAccel() and
+ * CalibrateGyro()), then store the record with MPU6050_CalibrationRecord::save().
+ * @param record Container for the device ID, die temperature and offsets
+ * @param serial Caller-chosen serial to key the record with (0 if unused)
+ * @see applyCalibration()
+ */
+void MPU6050_Base::getCalibration(MPU6050_CalibrationRecord *record, uint32_t serial) {
+    record->deviceID = getDeviceID();
+    record->serial = serial;
+    record->temperature = getTemperature();
+    readOffsets(record->offsets);
+}
+/** Apply a stored calibration record if it belongs to this device.
+ * The record is only used if its device ID and serial match and the die
+ * temperature is within the given window of the one it was captured at, so a
+ * foreign or stale record falls back to recalibration instead of being
+ * applied blindly. All six offsets are written with writeOffsets().
+ * @param record Record previously filled by getCalibration() or loaded from storage
+ * @param serial Serial the record must have been saved with
+ * @param window Largest accepted raw TEMP_OUT difference
+ * @return True if the record matched and was applied
+ * @see getCalibration()
+ */
+bool MPU6050_Base::applyCalibration(const MPU6050_CalibrationRecord *record, uint32_t serial, int16_t window) {
+    if (!record->matches(getDeviceID(), serial, getTemperature(), window)) return false;
+    writeOffsets(record->offsets);
+    return true;
+}
+/** Prepare a gyro temperature model for use with this device.
+ * Loads the current gyro range and gyro offset registers into the model, so
+ * call it after calibration and again whenever either is changed by hand.
+ * The TEMP_OUT scale is picked from the device ID, since the MPU6500 and
+ * MPU9250 use a different sensitivity and zero point than the MPU6050.
+ * @param model Model to prepare (its learned table is kept)
+ * @see updateGyroTempModel()
+ */
+void MPU6050_Base::initGyroTempModel(GyroTempModel *model) {
+    int16_t offsets[6];
+    readOffsets(offsets);
+    model->setFullScale(getFullScaleGyroRange());
+    model->setAppliedOffsets(offsets + 3);
+    if (getDeviceID() < 0x38) model->setTemperatureScale(340.0f, 36.53f); // MPU6050,MPU9150
+    else model->setTemperatureScale(333.87f, 21.0f); // MPU6500,MPU9250
+}
+/** Learn gyro bias against temperature and keep the offset registers current.
+ * Call once per sample with the raw gyro output and TEMP_OUT (for example
+ * from a 14-byte ACCEL_XOUT_H burst). Samples taken at rest train the model;
+ * whenever the predicted offsets for the present temperature move by more
+ * than GYROTEMP_WRITE_HYSTERESIS from the applied ones, all three gyro offset
+ * registers are rewritten in one burst. With writeRegisters false the
+ * registers are left alone and GyroTempModel::correct() can be used instead.
+ * @param model Model prepared with initGyroTempModel()
+ * @param gx Raw X gyro output
+ * @param gy Raw Y gyro output
+ * @param gz Raw Z gyro output
+ * @param temperature Raw TEMP_OUT value read with the sample
+ * @param writeRegisters Update XG/YG/ZG_OFFS_USR from the model
+ * @return True if the offset registers were rewritten
+ * @see GyroTempModel
+ */
+bool MPU6050_Base::updateGyroTempModel(GyroTempModel *model, int16_t gx, int16_t gy, int16_t gz, int16_t temperature, bool writeRegisters) {
+    float celsius = model->toCelsius(temperature);
+    model->update(celsius, gx, gy, gz);
+    if (!writeRegisters) return false;
+
+    float predicted[3];
+    if (!model->predict(celsius, predicted)) return false;
+    const int16_t *applied = model->getAppliedOffsets();
+    bool stale = false;
+    for (uint8_t i = 0; i < 3; i++) {
+        float d = predicted[i] - applied[i];
+        if (d > GYROTEMP_WRITE_HYSTERESIS || d < -GYROTEMP_WRITE_HYSTERESIS) stale = true;
+    }
+    if (!stale) return false;
+
+    int16_t offsets[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        offsets[i] = (int16_t)(predicted[i] < 0.0f ? predicted[i] - 0.5f : predicted[i] + 0.5f);
+        buffer[i * 2] = offsets[i] >> 8;
+        buffer[i * 2 + 1] = offsets[i];
+    }
+    if (!I2Cdev::writeBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, buffer, wireObj)) return false;
+    model->setAppliedOffsets(offsets);
+    return true;
+}
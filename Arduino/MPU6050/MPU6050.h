@@ -40,6 +40,8 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 #include "helper_3dmath.h"
+#include "helper_calibration.h"
+#include "helper_gyrotemp.h"
 
 // supporting link:  http://forum.arduino.cc/index.php?&topic=143444.msg1079517#msg1079517
 // also: http://forum.arduino.cc/index.php?&topic=141571.msg1062899#msg1062899s
@@ -437,6 +439,25 @@ THE SOFTWARE.
 
 #define MPU6050_FIFO_DEFAULT_TIMEOUT 11000
 
+#define MPU6050_STATE_BLOCKS        7
+#define MPU6050_STATE_SIZE          59 // bytes covered by the MPU6050_STATE_BLOCKS register map
+
+#define MPU6050_AUX_MAG_NONE        0
+#define MPU6050_AUX_MAG_HMC5883L    1
+#define MPU6050_AUX_MAG_HMC5843     2
+#define MPU6050_AUX_MAG_AK8975      3
+#define MPU6050_AUX_MAG_AK8963      4
+
+#define MPU6050_AUX_TIMEOUT         300 // ms to wait for a slave 4 transfer (one sample period at the slowest rate)
+
+#define MPU6050_CALIBRATE_ACCEL             0x01
+#define MPU6050_CALIBRATE_GYRO              0x02
+#define MPU6050_CALIBRATION_ITERATIONS      8
+#define MPU6050_CALIBRATION_SAMPLES         256
+#define MPU6050_CALIBRATION_BATCH           64  // samples per FIFO fill (64 * 12 bytes fits the 1024-byte FIFO)
+#define MPU6050_CALIBRATION_ACCEL_TOLERANCE 16  // LSB at +/-2g (one even accel offset step)
+#define MPU6050_CALIBRATION_GYRO_TOLERANCE  4   // LSB at +/-250 deg/s (one gyro offset step)
+
 class MPU6050_Base {
     public:
         MPU6050_Base(uint8_t address=MPU6050_DEFAULT_ADDRESS, void *wireObj=0);
@@ -451,6 +472,7 @@ class MPU6050_Base {
         // SMPLRT_DIV register
         uint8_t getRate();
         void setRate(uint8_t rate);
+        float getSampleRate();
 
         // CONFIG register
         uint8_t getExternalFrameSync();
@@ -644,6 +666,12 @@ class MPU6050_Base {
         uint16_t getExternalSensorWord(int position);
         uint32_t getExternalSensorDWord(int position);
 
+        // Auxiliary magnetometer (auto-sampled into EXT_SENS_DATA_00..05)
+        bool setAuxMagnetometer(uint8_t type, uint8_t address=0);
+        uint8_t getAuxMagnetometer();
+        bool readAuxRegister(uint8_t address, uint8_t reg, uint8_t *data);
+        bool writeAuxRegister(uint8_t address, uint8_t reg, uint8_t data);
+
         // MOT_DETECT_STATUS register
         uint8_t getMotionStatus();
         bool getXNegMotionDetected();
@@ -720,7 +748,7 @@ class MPU6050_Base {
         uint8_t getFIFOByte();
 		int8_t GetCurrentFIFOPacket(uint8_t *data, uint8_t length);
         void setFIFOByte(uint8_t data);
-        void getFIFOBytes(uint8_t *data, uint8_t length);
+        void getFIFOBytes(uint8_t *data, uint16_t length);
         void setFIFOTimeout(uint32_t fifoTimeout);
         uint32_t getFIFOTimeout();
 
@@ -827,6 +855,19 @@ class MPU6050_Base {
         uint8_t getDMPConfig2();
         void setDMPConfig2(uint8_t config);
 
+        // Register map snapshot
+        bool saveState(uint8_t *state);
+        bool restoreState(const uint8_t *state);
+
+        // Offset calibration
+        void readOffsets(int16_t *offsets);
+        void writeOffsets(const int16_t *offsets);
+        bool calibrateOffsets(uint8_t sensors=MPU6050_CALIBRATE_ACCEL | MPU6050_CALIBRATE_GYRO, uint8_t maxIterations=MPU6050_CALIBRATION_ITERATIONS, uint16_t samples=MPU6050_CALIBRATION_SAMPLES, int16_t *residual=0);
+        void getCalibration(MPU6050_CalibrationRecord *record, uint32_t serial=0);
+        bool applyCalibration(const MPU6050_CalibrationRecord *record, uint32_t serial=0, int16_t window=MPU6050_CALIBRATION_TEMP_WINDOW);
+        void initGyroTempModel(GyroTempModel *model);
+        bool updateGyroTempModel(GyroTempModel *model, int16_t gx, int16_t gy, int16_t gz, int16_t temperature, bool writeRegisters=true);
+
 		// Calibration Routines
 		void CalibrateGyro(uint8_t Loops = 15); // Fine tune after setting offsets with less Loops.
 		void CalibrateAccel(uint8_t Loops = 15);// Fine tune after setting offsets with less Loops.
@@ -839,9 +880,11 @@ class MPU6050_Base {
         void *wireObj;
         uint8_t buffer[14];
         uint32_t fifoTimeout = MPU6050_FIFO_DEFAULT_TIMEOUT;
+        uint8_t auxMagType = MPU6050_AUX_MAG_NONE;
     
     private:
         int16_t offsets[6];
+        bool getFIFOMeans(uint16_t samples, int16_t *means);
 };
 
 #ifndef I2CDEVLIB_MPU6050_TYPEDEF
@@ -0,0 +1,306 @@
+// I2Cdev library collection - MPU6050 gyro temperature compensation helper
+// Online piecewise-linear model of gyro bias against die temperature
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_GYROTEMP_H_
+#define _HELPER_GYROTEMP_H_
+
+#include <stdint.h>
+
+// temperature table layout; each bin costs 36 bytes of RAM, so trim these
+// (define before including) on small AVR parts
+#ifndef GYROTEMP_BINS
+#define GYROTEMP_BINS               12
+#endif
+#ifndef GYROTEMP_MIN_C
+#define GYROTEMP_MIN_C              0.0f    // lower edge of first bin, degC
+#endif
+#ifndef GYROTEMP_BIN_C
+#define GYROTEMP_BIN_C              5.0f    // bin width, degC
+#endif
+
+#define GYROTEMP_MIN_WEIGHT         32.0f   // samples before a bin is used for prediction
+#define GYROTEMP_MAX_WEIGHT         4096.0f // effective memory per bin; older samples fade out
+#define GYROTEMP_MIN_SPREAD         0.04f   // degC^2 temperature variance needed to trust a bin's slope
+#define GYROTEMP_STILL_VARIANCE     64.0f   // offset LSB^2 (~0.25 deg/s rms) below which the device is still
+#define GYROTEMP_STILL_SAMPLES      64      // consecutive still samples before learning starts
+#define GYROTEMP_WRITE_HYSTERESIS   0.75f   // offset LSB change needed before registers are rewritten
+
+/** Temperature-compensated gyro bias model.
+ * Gyro zero-rate output on the MPU6050 moves by up to ~0.03 deg/s per degC, so
+ * offsets calibrated at power-up are wrong again once the die warms. This class
+ * learns, while the device is at rest, which XG/YG/ZG_OFFS_USR values cancel
+ * the bias at each temperature, and predicts them for the current temperature.
+ *
+ * The model is a table of temperature bins. Each bin keeps an incremental
+ * (Welford-style) least-squares fit of required offset against temperature:
+ * the weighted mean temperature, the mean offset per axis and their
+ * co-moments, so an update is a handful of multiply-adds and no samples are
+ * stored. Predictions interpolate linearly between the centroids of the
+ * trained bins on either side of the current temperature, and beyond the
+ * outermost trained bin follow that bin's own fitted slope for at most one
+ * bin width. The weight of a bin is capped, so the model keeps following a
+ * part whose behaviour ages.
+ *
+ * Everything is expressed in offset register units (+/-1000 deg/s LSB, 32.8
+ * LSB per deg/s), and samples are converted using the offsets currently
+ * applied, so learning continues undisturbed while the registers are being
+ * rewritten. Rest detection is built in: a sample only reaches the table once
+ * the short-term variance on all three axes has stayed below
+ * GYROTEMP_STILL_VARIANCE for GYROTEMP_STILL_SAMPLES samples.
+ *
+ * See MPU6050::initGyroTempModel() and MPU6050::updateGyroTempModel() for the
+ * register-level integration, or call update() and correct() directly to
+ * compensate in software only.
+ */
+class GyroTempModel {
+    public:
+        GyroTempModel() {
+            setFullScale(0);
+            setTemperatureScale(340.0f, 36.53f);
+            applied[0] = applied[1] = applied[2] = 0;
+            reset();
+        }
+
+        /** Forget everything learned and restart rest detection. */
+        void reset() {
+            for (uint8_t i = 0; i < GYROTEMP_BINS; i++) bins[i].weight = 0.0f;
+            stillCount = 0;
+            primed = false;
+        }
+
+        /** Set the gyro range the samples passed to update() are taken at.
+         * @param range MPU6050_GYRO_FS_250 ... MPU6050_GYRO_FS_2000
+         */
+        void setFullScale(uint8_t range) {
+            lsbPerOffset = 4.0f / (float)(1 << (range & 3));
+        }
+
+        /** Set how raw TEMP_OUT values convert to degC for toCelsius().
+         * The MPU6050 default is 340 LSB/degC with 36.53 degC at zero; the
+         * MPU6500 and MPU9250 use 333.87 LSB/degC with 21 degC at zero.
+         * @param lsbPerDegree TEMP_OUT sensitivity in LSB per degC
+         * @param zeroCelsius Temperature at a TEMP_OUT reading of zero
+         */
+        void setTemperatureScale(float lsbPerDegree, float zeroCelsius) {
+            tempScale = 1.0f / lsbPerDegree;
+            tempZero = zeroCelsius;
+        }
+
+        /** Convert a raw TEMP_OUT value with the scale from setTemperatureScale().
+         * @param temperature Raw TEMP_OUT value
+         * @return Die temperature in degC
+         */
+        float toCelsius(int16_t temperature) {
+            return temperature * tempScale + tempZero;
+        }
+
+        /** Tell the model which gyro offsets are currently in the registers.
+         * @param offsets X/Y/Z gyro offsets (XG/YG/ZG_OFFS_USR)
+         */
+        void setAppliedOffsets(const int16_t *offsets) {
+            for (uint8_t i = 0; i < 3; i++) applied[i] = offsets[i];
+        }
+
+        /** Get the gyro offsets last passed to setAppliedOffsets().
+         * @return X/Y/Z gyro offsets
+         */
+        const int16_t *getAppliedOffsets() {
+            return applied;
+        }
+
+        /** Feed one gyro sample; learns from it if the device is at rest.
+         * @param celsius Die temperature in degC
+         * @param gx Raw X gyro output at the configured full scale
+         * @param gy Raw Y gyro output
+         * @param gz Raw Z gyro output
+         * @return True if the sample was added to the table
+         */
+        bool update(float celsius, int16_t gx, int16_t gy, int16_t gz) {
+            // offset that would have zeroed this sample
+            float required[3];
+            required[0] = applied[0] - gx / lsbPerOffset;
+            required[1] = applied[1] - gy / lsbPerOffset;
+            required[2] = applied[2] - gz / lsbPerOffset;
+
+            // short-term mean and variance per axis, alpha = 1/16
+            bool still = primed;
+            for (uint8_t i = 0; i < 3; i++) {
+                if (!primed) {
+                    mean[i] = required[i];
+                    variance[i] = GYROTEMP_STILL_VARIANCE;
+                    continue;
+                }
+                float d = required[i] - mean[i];
+                mean[i] += d * 0.0625f;
+                variance[i] += (d * d - variance[i]) * 0.0625f;
+                if (variance[i] >= GYROTEMP_STILL_VARIANCE) still = false;
+            }
+            primed = true;
+            if (!still) {
+                stillCount = 0;
+                return false;
+            }
+            if (stillCount < GYROTEMP_STILL_SAMPLES) {
+                stillCount++;
+                return false;
+            }
+            learn(celsius, required);
+            return true;
+        }
+
+        /** Add a known at-rest observation to the table, bypassing rest detection.
+         * @param celsius Die temperature in degC
+         * @param required X/Y/Z gyro offsets that zero the output at this temperature
+         */
+        void learn(float celsius, const float *required) {
+            Bin *b = &bins[binIndex(celsius)];
+            if (b->weight >= GYROTEMP_MAX_WEIGHT) {
+                // fade old data: scaling weight and co-moments together keeps
+                // the means and slopes but lets new samples pull harder
+                float k = (GYROTEMP_MAX_WEIGHT - 1.0f) / b->weight;
+                b->weight *= k;
+                b->tt *= k;
+                for (uint8_t i = 0; i < 3; i++) b->tb[i] *= k;
+            }
+            if (b->weight == 0.0f) {
+                b->temp = celsius;
+                b->tt = 0.0f;
+                for (uint8_t i = 0; i < 3; i++) {
+                    b->bias[i] = required[i];
+                    b->tb[i] = 0.0f;
+                }
+                b->weight = 1.0f;
+                return;
+            }
+            b->weight += 1.0f;
+            float dt = celsius - b->temp;
+            b->temp += dt / b->weight;
+            b->tt += dt * (celsius - b->temp);
+            for (uint8_t i = 0; i < 3; i++) {
+                b->bias[i] += (required[i] - b->bias[i]) / b->weight;
+                b->tb[i] += dt * (required[i] - b->bias[i]);
+            }
+        }
+
+        /** Predict the gyro offsets that cancel the bias at a temperature.
+         * @param celsius Die temperature in degC
+         * @param offsets Container for X/Y/Z offsets in register units
+         * @return False (offsets untouched) if no bin is trained yet
+         */
+        bool predict(float celsius, float *offsets) {
+            int8_t lo = -1, hi = -1;
+            for (uint8_t i = 0; i < GYROTEMP_BINS; i++) {
+                if (bins[i].weight < GYROTEMP_MIN_WEIGHT) continue;
+                if (bins[i].temp <= celsius) lo = i;
+                else if (hi < 0) hi = i;
+            }
+            if (lo < 0 && hi < 0) return false;
+
+            if (lo >= 0 && hi >= 0) {
+                const Bin *a = &bins[lo], *b = &bins[hi];
+                float f = (celsius - a->temp) / (b->temp - a->temp);
+                for (uint8_t i = 0; i < 3; i++) offsets[i] = a->bias[i] + (b->bias[i] - a->bias[i]) * f;
+                return true;
+            }
+
+            // outside the trained range: follow the edge bin's own fit
+            const Bin *b = &bins[lo >= 0 ? lo : hi];
+            float dt = celsius - b->temp;
+            if (dt > GYROTEMP_BIN_C) dt = GYROTEMP_BIN_C;
+            else if (dt < -GYROTEMP_BIN_C) dt = -GYROTEMP_BIN_C;
+            bool sloped = b->tt >= b->weight * GYROTEMP_MIN_SPREAD;
+            for (uint8_t i = 0; i < 3; i++) offsets[i] = b->bias[i] + (sloped ? b->tb[i] / b->tt * dt : 0.0f);
+            return true;
+        }
+
+        /** Remove the residual bias from a sample in software.
+         * Corrects for the difference between the predicted offsets and the
+         * ones currently applied, so it also works with the registers left at
+         * their power-up calibration.
+         * @param celsius Die temperature in degC
+         * @param gyro X/Y/Z raw gyro output, corrected in place
+         * @return False (sample untouched) if no bin is trained yet
+         */
+        bool correct(float celsius, int16_t *gyro) {
+            float offsets[3];
+            if (!predict(celsius, offsets)) return false;
+            for (uint8_t i = 0; i < 3; i++) {
+                float v = gyro[i] + (offsets[i] - applied[i]) * lsbPerOffset;
+                if (v > 32767.0f) v = 32767.0f;
+                else if (v < -32768.0f) v = -32768.0f;
+                gyro[i] = (int16_t)(v < 0.0f ? v - 0.5f : v + 0.5f);
+            }
+            return true;
+        }
+
+        /** Check how many at-rest samples a temperature bin has absorbed.
+         * @param bin Bin index, 0 to GYROTEMP_BINS-1
+         * @return Effective sample weight (capped at GYROTEMP_MAX_WEIGHT)
+         */
+        float getBinWeight(uint8_t bin) {
+            return bin < GYROTEMP_BINS ? bins[bin].weight : 0.0f;
+        }
+
+        /** Check whether the last update() saw the device at rest.
+         * @return True if rest detection is currently satisfied
+         */
+        bool isStill() {
+            return stillCount >= GYROTEMP_STILL_SAMPLES;
+        }
+
+    private:
+        struct Bin {
+            float weight;   // effective number of samples
+            float temp;     // weighted mean temperature
+            float tt;       // sum of squared temperature deviations
+            float bias[3];  // weighted mean required offset per axis
+            float tb[3];    // temperature/offset co-moment per axis
+        };
+
+        uint8_t binIndex(float celsius) {
+            float f = (celsius - GYROTEMP_MIN_C) / GYROTEMP_BIN_C;
+            if (f < 0.0f) return 0;
+            if (f >= GYROTEMP_BINS) return GYROTEMP_BINS - 1;
+            return (uint8_t)f;
+        }
+
+        Bin bins[GYROTEMP_BINS];
+        float lsbPerOffset;
+        float tempScale;
+        float tempZero;
+        int16_t applied[3];
+        float mean[3];
+        float variance[3];
+        uint16_t stillCount;
+        bool primed;
+};
+
+#endif /* _HELPER_GYROTEMP_H_ */
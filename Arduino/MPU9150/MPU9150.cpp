@@ -2686,8 +2686,8 @@ uint8_t MPU9150::getFIFOByte() {
     I2Cdev::readByte(devAddr, MPU9150_RA_FIFO_R_W, buffer);
     return buffer[0];
 }
-void MPU9150::getFIFOBytes(uint8_t *data, uint8_t length) {
-    I2Cdev::readBytes(devAddr, MPU9150_RA_FIFO_R_W, length, data);
+void MPU9150::getFIFOBytes(uint8_t *data, uint16_t length) {
+    I2Cdev::readBytesLong(devAddr, MPU9150_RA_FIFO_R_W, length, data);
 }
 /** Write byte to FIFO buffer.
  * @see getFIFOByte()
@@ -688,7 +688,7 @@ class MPU9250 {
         // FIFO_R_W register
         uint8_t getFIFOByte();
         void setFIFOByte(uint8_t data);
-        void getFIFOBytes(uint8_t *data, uint8_t length);
+        void getFIFOBytes(uint8_t *data, uint16_t length);
 
         // WHO_AM_I register
         uint8_t getDeviceID();
@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2011-08-25 - initial release
+//     2026-10-19 - add framebuffer with dirty-span flush, burst data writes
         
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -39,9 +40,21 @@ THE SOFTWARE.
 #include "fixedWidthFont.h"
 //#endif
 
+// data bytes per bus transaction; one byte of the Wire buffer holds the
+// control byte (DATA_MODE)
+#define SSD1308_DATA_BURST (I2CDEVLIB_WIRE_BUFFER_LENGTH - 1)
+
 SSD1308::SSD1308(uint8_t address) :
   m_devAddr(address)
 {
+#if SSD1308_FRAMEBUFFER
+  for (uint16_t i = 0; i < PAGES * COLUMNS; i++)
+  {
+    m_frameBuffer[i] = 0;
+  }
+  // display RAM contents are unknown until the first flush
+  markAllDirty();
+#endif
 }
 
 void SSD1308::initialize() 
@@ -53,46 +66,70 @@ void SSD1308::initialize()
 void SSD1308::clearDisplay()
 {
   setDisplayOff();
-  setPageAddress(0, 7);     // all pages
-  setColumnAddress(0, 127); // all columns
-  for (uint8_t page = 0; page < 8; page++)
+#if SSD1308_FRAMEBUFFER
+  clearBuffer();
+  markAllDirty();
+  flush();
+#else
+  setPageAddress(0, MAX_PAGE);  // all pages
+  setColumnAddress(0, MAX_COL); // all columns
+  uint8_t zeros[SSD1308_DATA_BURST] = { 0 };
+  for (uint16_t sent = 0; sent < PAGES * COLUMNS; sent += SSD1308_DATA_BURST)
   {
-    for (uint8_t col = 0; col < 128; col++)
-    {
-      sendData(0x0);
-    }
+    const uint16_t left = PAGES * COLUMNS - sent;
+    sendData(left < SSD1308_DATA_BURST ? left : SSD1308_DATA_BURST, zeros);
   }
+#endif
   setDisplayOn();
 }
 
 void SSD1308::fillDisplay()
 {
-  setPageAddress(0, MAX_PAGE);      // all pages
+#if SSD1308_FRAMEBUFFER
+  for (uint16_t i = 0; i < PAGES * COLUMNS; i++)
+  {
+    m_frameBuffer[i] = i;
+  }
+  markAllDirty();
+  flush();
+#else
+  setPageAddress(0, MAX_PAGE);  // all pages
   setColumnAddress(0, MAX_COL); // all columns
 
+  uint8_t chunk[SSD1308_DATA_BURST];
   uint8_t b = 0;
-  for (uint8_t page = 0; page < PAGES; page++)
+  for (uint16_t sent = 0; sent < PAGES * COLUMNS; sent += SSD1308_DATA_BURST)
   {
-    for (uint8_t col = 0; col < COLUMNS; col++)
+    const uint16_t left = PAGES * COLUMNS - sent;
+    const uint8_t len = left < SSD1308_DATA_BURST ? left : SSD1308_DATA_BURST;
+    for (uint8_t i = 0; i < len; i++)
     {
-      sendData(b++);
+      chunk[i] = b++;
     }
+    sendData(len, chunk);
   }
+#endif
 }
 
 void SSD1308::writeChar(char chr)
 {
 //#ifdef SSD1308_USE_FONT
   const uint8_t char_index = chr - 0x20;
-  for (uint8_t i = 0; i < 8; i++) {
-     const uint8_t b = pgm_read_byte( &fontData[char_index][i] );
-     sendData( b ); 
+  uint8_t glyph[FONT_WIDTH];
+  for (uint8_t i = 0; i < FONT_WIDTH; i++) {
+     glyph[i] = pgm_read_byte( &fontData[char_index][i] );
   }
+  sendData(FONT_WIDTH, glyph);
 //#endif
 }
 
 void SSD1308::writeString(uint8_t row, uint8_t col, uint16_t len, const char * text)
 {
+#if SSD1308_FRAMEBUFFER
+  // keep the framebuffer in step with display RAM
+  drawString(row, col, len, text);
+  flush();
+#else
   uint16_t index = 0;
   setPageAddress(row, MAX_PAGE);
   const uint8_t col_addr = FONT_WIDTH*col;
@@ -121,8 +158,171 @@ void SSD1308::writeString(uint8_t row, uint8_t col, uint16_t len, const char * t
        }
     }
   }
+#endif
 }
 
+#if SSD1308_FRAMEBUFFER
+uint8_t* SSD1308::getFrameBuffer()
+{
+  return m_frameBuffer;
+}
+
+void SSD1308::clearBuffer()
+{
+  fillBuffer(0x00);
+}
+
+void SSD1308::fillBuffer(uint8_t pattern)
+{
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    for (uint8_t col = 0; col < COLUMNS; col++)
+    {
+      uint8_t* b = &m_frameBuffer[page * COLUMNS + col];
+      if (*b != pattern)
+      {
+        *b = pattern;
+        markDirty(page, col, col);
+      }
+    }
+  }
+}
+
+void SSD1308::setPixel(uint8_t x, uint8_t y, bool on)
+{
+  if (x >= COLUMNS || y >= ROWS) return;
+  uint8_t* b = &m_frameBuffer[(y / 8) * COLUMNS + x];
+  const uint8_t v = on ? (*b | (1 << (y % 8))) : (*b & ~(1 << (y % 8)));
+  if (v != *b)
+  {
+    *b = v;
+    markDirty(y / 8, x, x);
+  }
+}
+
+bool SSD1308::getPixel(uint8_t x, uint8_t y)
+{
+  if (x >= COLUMNS || y >= ROWS) return false;
+  return m_frameBuffer[(y / 8) * COLUMNS + x] & (1 << (y % 8));
+}
+
+void SSD1308::writeBuffer(uint8_t page, uint8_t col, uint8_t len, const uint8_t* data)
+{
+  if (page >= PAGES || col >= COLUMNS) return;
+  if (len > COLUMNS - col) len = COLUMNS - col; // clip at the end of the page
+
+  // only the span that actually changed is marked
+  int16_t first = -1, last = -1;
+  uint8_t* b = &m_frameBuffer[page * COLUMNS + col];
+  for (uint8_t i = 0; i < len; i++)
+  {
+    if (b[i] != data[i])
+    {
+      b[i] = data[i];
+      if (first < 0) first = i;
+      last = i;
+    }
+  }
+  if (first >= 0) markDirty(page, col + first, col + last);
+}
+
+void SSD1308::drawString(uint8_t row, uint8_t col, uint16_t len, const char * text)
+{
+  // characters run left to right, wrap to the next page and back to the top
+  uint16_t pos = row * CHARS + col;
+  for (uint16_t index = 0; index < len; index++, pos++)
+  {
+    pos %= PAGES * CHARS;
+    const uint8_t char_index = text[index] - 0x20;
+    uint8_t glyph[FONT_WIDTH];
+    for (uint8_t i = 0; i < FONT_WIDTH; i++) {
+       glyph[i] = pgm_read_byte( &fontData[char_index][i] );
+    }
+    writeBuffer(pos / CHARS, (pos % CHARS) * FONT_WIDTH, FONT_WIDTH, glyph);
+  }
+}
+
+void SSD1308::markDirty(uint8_t page, uint8_t start, uint8_t end)
+{
+  if (page >= PAGES) return;
+  if (end > MAX_COL) end = MAX_COL;
+  if (start > end) return;
+  if (m_dirtyEnd[page] < m_dirtyStart[page])
+  {
+    m_dirtyStart[page] = start;
+    m_dirtyEnd[page] = end;
+  }
+  else
+  {
+    if (start < m_dirtyStart[page]) m_dirtyStart[page] = start;
+    if (end > m_dirtyEnd[page]) m_dirtyEnd[page] = end;
+  }
+}
+
+void SSD1308::markAllDirty()
+{
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    m_dirtyStart[page] = 0;
+    m_dirtyEnd[page] = MAX_COL;
+  }
+}
+
+bool SSD1308::isDirty()
+{
+  for (uint8_t page = 0; page < PAGES; page++)
+  {
+    if (m_dirtyEnd[page] >= m_dirtyStart[page]) return true;
+  }
+  return false;
+}
+
+void SSD1308::flush()
+{
+  uint8_t page = 0;
+  while (page < PAGES)
+  {
+    const uint8_t start = m_dirtyStart[page];
+    const uint8_t end = m_dirtyEnd[page];
+    if (end < start)
+    {
+      page++;
+      continue;
+    }
+
+    // pages with an identical span are written through one address window;
+    // in horizontal addressing mode the RAM pointer wraps from the end column
+    // back to the start column of the next page
+    uint8_t last = page;
+    while (last < MAX_PAGE && m_dirtyStart[last + 1] == start && m_dirtyEnd[last + 1] == end)
+    {
+      last++;
+    }
+    setPageAddress(page, last);
+    setColumnAddress(start, end);
+
+    if (start == 0 && end == MAX_COL)
+    {
+      // full-width pages are contiguous in the framebuffer
+      sendDataBurst((last - page + 1) * COLUMNS, &m_frameBuffer[page * COLUMNS]);
+    }
+    else
+    {
+      for (uint8_t p = page; p <= last; p++)
+      {
+        sendDataBurst(end - start + 1, &m_frameBuffer[p * COLUMNS + start]);
+      }
+    }
+
+    for (; page <= last; page++)
+    {
+      m_dirtyStart[page] = COLUMNS;
+      m_dirtyEnd[page] = 0;
+    }
+  }
+}
+#endif
+
 void SSD1308::sendCommand(uint8_t command)
 {
   I2Cdev::writeByte(m_devAddr, COMMAND_MODE, command);
@@ -143,6 +343,17 @@ void SSD1308::sendData(uint8_t len, uint8_t* data)
   I2Cdev::writeBytes(m_devAddr, DATA_MODE, len, data);
 }
 
+void SSD1308::sendDataBurst(uint16_t len, const uint8_t* data)
+{
+  while (len > 0)
+  {
+    const uint8_t n = len < SSD1308_DATA_BURST ? len : SSD1308_DATA_BURST;
+    sendData(n, (uint8_t*)data);
+    data += n;
+    len -= n;
+  }
+}
+
 void SSD1308::setHorizontalAddressingMode()
 {
   setMemoryAddressingMode(HORIZONTAL_ADDRESSING_MODE); 
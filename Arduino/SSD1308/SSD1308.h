@@ -7,6 +7,7 @@
 //
 // Changelog:
 //     2011-08-25 - initial release
+//     2026-10-19 - add framebuffer with dirty-span flush, burst data writes
         
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -55,6 +56,18 @@ THE SOFTWARE.
 #define MAX_PAGE (PAGES - 1)
 #define MAX_COL (COLUMNS - 1)
 
+// keep a 1 KB host-side copy of display RAM in every SSD1308 instance. Off
+// by default on AVR, where that is half the RAM of an ATmega328; opt in (or
+// out elsewhere) with -DSSD1308_FRAMEBUFFER=1/0 in the build flags, since
+// the library and the sketch must agree on it
+#ifndef SSD1308_FRAMEBUFFER
+#ifdef __AVR__
+#define SSD1308_FRAMEBUFFER 0
+#else
+#define SSD1308_FRAMEBUFFER 1
+#endif
+#endif
+
 #define HORIZONTAL_ADDRESSING_MODE 0x00
 #define VERTICAL_ADDRESSING_MODE   0x01
 #define PAGE_ADDRESSING_MODE       0x02
@@ -134,6 +147,30 @@ class SSD1308
     // text will wrap around until it is done.
     void writeString(uint8_t row, uint8_t col, uint16_t len, const char* txt);
     
+#if SSD1308_FRAMEBUFFER
+    // framebuffer drawing; nothing reaches the display until flush().
+    // byte layout matches display RAM: page * COLUMNS + column, bit 0 on top.
+    uint8_t* getFrameBuffer();
+    void clearBuffer();
+    void fillBuffer(uint8_t pattern);
+    void setPixel(uint8_t x, uint8_t y, bool on);
+    bool getPixel(uint8_t x, uint8_t y);
+    void writeBuffer(uint8_t page, uint8_t col, uint8_t len, const uint8_t* data);
+    void drawString(uint8_t row, uint8_t col, uint16_t len, const char* txt);
+
+    // mark columns start..end (inclusive) of a page as changed, e.g. after
+    // writing through getFrameBuffer() directly
+    void markDirty(uint8_t page, uint8_t start, uint8_t end);
+    // mark the whole display as changed, e.g. after a power cycle
+    void markAllDirty();
+    bool isDirty();
+
+    // push only the changed column spans to the display, in bus-buffer-sized
+    // bursts; consecutive pages with the same span share one address window.
+    // requires horizontal addressing mode (set by initialize()).
+    void flush();
+#endif
+
     //void setXY(uint8_t, uint8_t y);
 
     void setHorizontalAddressingMode();
@@ -237,8 +274,15 @@ class SSD1308
     void sendCommands(uint8_t len, uint8_t* buf);
 
     void writeChar(char chr);
+    void sendDataBurst(uint16_t len, const uint8_t* data);
     
     uint8_t m_devAddr; // contains the I2C address of the device
+
+#if SSD1308_FRAMEBUFFER
+    uint8_t m_frameBuffer[PAGES * COLUMNS];
+    uint8_t m_dirtyStart[PAGES]; // first changed column per page
+    uint8_t m_dirtyEnd[PAGES];   // last changed column per page, < start if clean
+#endif
 };
 
 #endif
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-07-31 - initial release
+//     2026-10-19 - add shadowed multi-pin updates
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -37,6 +38,7 @@ THE SOFTWARE.
  */
 TCA6424A::TCA6424A() {
     devAddr = TCA6424A_DEFAULT_ADDRESS;
+    shadowValid = false;
 }
 
 /** Specific address constructor.
@@ -47,14 +49,18 @@ TCA6424A::TCA6424A() {
  */
 TCA6424A::TCA6424A(uint8_t address) {
     devAddr = address;
+    shadowValid = false;
 }
 
 /** Power on and prepare for general usage.
  * The TCA6424A I/O expander requires no preparation after power-on. All pins
  * will be default to INPUT mode, and the device is ready for usage immediately.
- * This is an empty function for consistency and/or future expansion.
+ * Any register shadow left over from a previous session is discarded so that
+ * it is reloaded from the device on the next batched pin update.
+ * @see syncShadow()
  */
 void TCA6424A::initialize() {
+    invalidateShadow();
 }
 
 /** Verify the I2C connection.
@@ -149,20 +155,22 @@ void TCA6424A::getAllOutputLevel(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2)
  * @param value New pin output logic level (0 or 1)
  */
 void TCA6424A::writePin(uint16_t pin, bool value) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_OUTPUT0 + (pin / 8), pin % 8, value);
+    writePins(1UL << pin, value ? 1UL << pin : 0);
 }
 /** Set all OUTPUT pins' logic levels in one bank.
  * @param bank Which bank to write (0/1/2 for P0*, P1*, P2* respectively)
  * @param value New pins' output logic level (0 or 1 for each pin)
  */
 void TCA6424A::writeBank(uint8_t bank, uint8_t value) {
-    I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, value);
+    if (I2Cdev::writeByte(devAddr, TCA6424A_RA_OUTPUT0 + bank, value)) outputShadow[bank] = value;
+    else shadowValid = false;
 }
 /** Set all OUTPUT pins' logic levels in all banks.
  * @param banks All pins' new logic values (P00-P27) in 3-byte array
  */
 void TCA6424A::writeAll(uint8_t *banks) {
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks);
+    if (I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, banks)) memcpy(outputShadow, banks, 3);
+    else shadowValid = false;
 }
 /** Set all OUTPUT pins' logic levels in all banks.
  * @param bank0 Bank 0's new logic values (P00-P07)
@@ -173,7 +181,8 @@ void TCA6424A::writeAll(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
     buffer[0] = bank0;
     buffer[1] = bank1;
     buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    if (I2Cdev::writeBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer)) memcpy(outputShadow, buffer, 3);
+    else shadowValid = false;
 }
 
 // POLARITY* registers (x8h - xAh)
@@ -217,20 +226,22 @@ void TCA6424A::getAllPolarity(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2) {
  * @param polarity New pin polarity setting (0 or 1)
  */
 void TCA6424A::setPinPolarity(uint16_t pin, bool polarity) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_POLARITY0 + (pin / 8), pin % 8, polarity);
+    setPinsPolarity(1UL << pin, polarity ? 1UL << pin : 0);
 }
 /** Set all pin polarity (normal/inverted) settings in one bank.
  * @param bank Which bank to write (0/1/2 for P0*, P1*, P2* respectively)
  * @return New pins' polarity settings (0 or 1 for each pin)
  */
 void TCA6424A::setBankPolarity(uint8_t bank, uint8_t polarity) {
-    I2Cdev::writeByte(devAddr, TCA6424A_RA_POLARITY0 + bank, polarity);
+    if (I2Cdev::writeByte(devAddr, TCA6424A_RA_POLARITY0 + bank, polarity)) polarityShadow[bank] = polarity;
+    else shadowValid = false;
 }
 /** Set all pin polarity (normal/inverted) settings in all banks.
  * @param banks All pins' new logic values (P00-P27) in 3-byte array
  */
 void TCA6424A::setAllPolarity(uint8_t *banks) {
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_POLARITY0 | TCA6424A_AUTO_INCREMENT, 3, banks);
+    if (I2Cdev::writeBytes(devAddr, TCA6424A_RA_POLARITY0 | TCA6424A_AUTO_INCREMENT, 3, banks)) memcpy(polarityShadow, banks, 3);
+    else shadowValid = false;
 }
 /** Set all pin polarity (normal/inverted) settings in all banks.
  * @param bank0 Bank 0's new polarity values (P00-P07)
@@ -241,7 +252,8 @@ void TCA6424A::setAllPolarity(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
     buffer[0] = bank0;
     buffer[1] = bank1;
     buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_POLARITY0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    if (I2Cdev::writeBytes(devAddr, TCA6424A_RA_POLARITY0 | TCA6424A_AUTO_INCREMENT, 3, buffer)) memcpy(polarityShadow, buffer, 3);
+    else shadowValid = false;
 }
 
 // CONFIG* registers (xCh - xEh)
@@ -285,20 +297,22 @@ void TCA6424A::getAllDirection(uint8_t *bank0, uint8_t *bank1, uint8_t *bank2) {
  * @param direction Pin direction setting (0 or 1)
  */
 void TCA6424A::setPinDirection(uint16_t pin, bool direction) {
-    I2Cdev::writeBit(devAddr, TCA6424A_RA_CONFIG0 + (pin / 8), pin % 8, direction);
+    setPinsDirection(1UL << pin, direction ? 1UL << pin : 0);
 }
 /** Set all pin direction (I/O) settings in one bank.
  * @param bank Which bank to read (0/1/2 for P0*, P1*, P2* respectively)
  * @param direction New pins' direction settings (0 or 1 for each pin)
  */
 void TCA6424A::setBankDirection(uint8_t bank, uint8_t direction) {
-    I2Cdev::writeByte(devAddr, TCA6424A_RA_CONFIG0 + bank, direction);
+    if (I2Cdev::writeByte(devAddr, TCA6424A_RA_CONFIG0 + bank, direction)) configShadow[bank] = direction;
+    else shadowValid = false;
 }
 /** Set all pin direction (I/O) settings in all banks.
  * @param banks All pins' new direction values (P00-P27) in 3-byte array
  */
 void TCA6424A::setAllDirection(uint8_t *banks) {
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, banks);
+    if (I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, banks)) memcpy(configShadow, banks, 3);
+    else shadowValid = false;
 }
 /** Set all pin direction (I/O) settings in all banks.
  * @param bank0 Bank 0's new direction values (P00-P07)
@@ -309,5 +323,115 @@ void TCA6424A::setAllDirection(uint8_t bank0, uint8_t bank1, uint8_t bank2) {
     buffer[0] = bank0;
     buffer[1] = bank1;
     buffer[2] = bank2;
-    I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    if (I2Cdev::writeBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, buffer)) memcpy(configShadow, buffer, 3);
+    else shadowValid = false;
+}
+
+// Batched multi-pin access
+
+/** Load the host-side OUTPUT, POLARITY and CONFIG register shadow from the device.
+ * Batched updates only transmit the banks whose value actually changes, so they
+ * need to know what the device currently holds. This is called automatically
+ * before the first batched update; call it manually if something other than
+ * this object (another master, a device reset) may have changed the registers.
+ * @return True if all three register groups were read successfully
+ * @see writePins()
+ */
+bool TCA6424A::syncShadow() {
+    shadowValid = I2Cdev::readBytes(devAddr, TCA6424A_RA_OUTPUT0 | TCA6424A_AUTO_INCREMENT, 3, outputShadow) == 3
+               && I2Cdev::readBytes(devAddr, TCA6424A_RA_POLARITY0 | TCA6424A_AUTO_INCREMENT, 3, polarityShadow) == 3
+               && I2Cdev::readBytes(devAddr, TCA6424A_RA_CONFIG0 | TCA6424A_AUTO_INCREMENT, 3, configShadow) == 3;
+    return shadowValid;
+}
+/** Discard the register shadow so it is reloaded before the next batched update.
+ * @see syncShadow()
+ */
+void TCA6424A::invalidateShadow() {
+    shadowValid = false;
+}
+/** Get all 24 INPUT pin logic levels in one burst.
+ * @return Pin logic levels, P00 in bit 0 through P27 in bit 23
+ */
+uint32_t TCA6424A::readAllPins() {
+    I2Cdev::readBytes(devAddr, TCA6424A_RA_INPUT0 | TCA6424A_AUTO_INCREMENT, 3, buffer);
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16);
+}
+/** Set the OUTPUT logic level of any combination of pins at once.
+ * Pins whose bit is clear in the mask keep their current level. Only the banks
+ * that change are written, in a single auto-increment burst, so toggling any
+ * number of pins costs at most one 4-byte bus write instead of a read and a
+ * write per pin.
+ * @param mask Pins to change, P00 in bit 0 through P27 in bit 23
+ * @param values New logic levels for the masked pins (same bit layout)
+ * @return True if the update was written (or nothing needed to change)
+ */
+bool TCA6424A::writePins(uint32_t mask, uint32_t values) {
+    return updateShadow(TCA6424A_RA_OUTPUT0, outputShadow, mask, values);
+}
+/** Set the polarity (normal/inverted) setting of any combination of pins at once.
+ * @param mask Pins to change, P00 in bit 0 through P27 in bit 23
+ * @param polarities New polarity settings for the masked pins (same bit layout)
+ * @return True if the update was written (or nothing needed to change)
+ * @see writePins()
+ */
+bool TCA6424A::setPinsPolarity(uint32_t mask, uint32_t polarities) {
+    return updateShadow(TCA6424A_RA_POLARITY0, polarityShadow, mask, polarities);
+}
+/** Set the direction (I/O) setting of any combination of pins at once.
+ * @param mask Pins to change, P00 in bit 0 through P27 in bit 23
+ * @param directions New direction settings for the masked pins (same bit layout)
+ * @return True if the update was written (or nothing needed to change)
+ * @see writePins()
+ */
+bool TCA6424A::setPinsDirection(uint32_t mask, uint32_t directions) {
+    return updateShadow(TCA6424A_RA_CONFIG0, configShadow, mask, directions);
+}
+/** Get the OUTPUT levels last written through this object, without bus access.
+ * @return Shadowed output levels, P00 in bit 0 through P27 in bit 23
+ */
+uint32_t TCA6424A::getOutputShadow() {
+    return (uint32_t)outputShadow[0] | ((uint32_t)outputShadow[1] << 8) | ((uint32_t)outputShadow[2] << 16);
+}
+/** Get the polarity settings last written through this object, without bus access.
+ * @return Shadowed polarity settings, P00 in bit 0 through P27 in bit 23
+ */
+uint32_t TCA6424A::getPolarityShadow() {
+    return (uint32_t)polarityShadow[0] | ((uint32_t)polarityShadow[1] << 8) | ((uint32_t)polarityShadow[2] << 16);
+}
+/** Get the direction settings last written through this object, without bus access.
+ * @return Shadowed direction settings, P00 in bit 0 through P27 in bit 23
+ */
+uint32_t TCA6424A::getDirectionShadow() {
+    return (uint32_t)configShadow[0] | ((uint32_t)configShadow[1] << 8) | ((uint32_t)configShadow[2] << 16);
+}
+/** Apply a masked update to one shadowed register group and write changed banks.
+ * @param regAddr First register of the group (OUTPUT0, POLARITY0 or CONFIG0)
+ * @param shadow 3-byte shadow for the group
+ * @param mask Bits to change
+ * @param values New values for the masked bits
+ * @return True if the update was written (or nothing needed to change)
+ */
+bool TCA6424A::updateShadow(uint8_t regAddr, uint8_t *shadow, uint32_t mask, uint32_t values) {
+    if (!shadowValid && !syncShadow()) return false;
+
+    int8_t first = -1, last = -1;
+    for (uint8_t bank = 0; bank < 3; bank++) {
+        uint8_t bankMask = mask >> (bank * 8);
+        buffer[bank] = (shadow[bank] & ~bankMask) | ((values >> (bank * 8)) & bankMask);
+        if (buffer[bank] != shadow[bank]) {
+            if (first < 0) first = bank;
+            last = bank;
+        }
+    }
+    if (first < 0) return true;
+
+    // an unchanged bank between two changed ones is rewritten with its shadow
+    // value, which is cheaper than a second addressed transaction
+    if (!I2Cdev::writeBytes(devAddr, (regAddr + first) | TCA6424A_AUTO_INCREMENT, last - first + 1, buffer + first)) {
+        // device state is now unknown, so reload it before the next update
+        shadowValid = false;
+        return false;
+    }
+    memcpy(shadow, buffer, 3);
+    return true;
 }
@@ -5,6 +5,7 @@
 //
 // Changelog:
 //     2011-07-31 - initial release
+//     2026-10-19 - add shadowed multi-pin updates
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -132,9 +133,26 @@ class TCA6424A {
         void setAllDirection(uint8_t *banks);
         void setAllDirection(uint8_t bank0, uint8_t bank1, uint8_t bank2);
 
+        // Batched multi-pin access (P00-P27 as bits 0-23)
+        bool syncShadow();
+        void invalidateShadow();
+        uint32_t readAllPins();
+        bool writePins(uint32_t mask, uint32_t values);
+        bool setPinsPolarity(uint32_t mask, uint32_t polarities);
+        bool setPinsDirection(uint32_t mask, uint32_t directions);
+        uint32_t getOutputShadow();
+        uint32_t getPolarityShadow();
+        uint32_t getDirectionShadow();
+
     private:
         uint8_t devAddr;
         uint8_t buffer[3];
+        uint8_t outputShadow[3];
+        uint8_t polarityShadow[3];
+        uint8_t configShadow[3];
+        bool shadowValid;
+
+        bool updateShadow(uint8_t regAddr, uint8_t *shadow, uint32_t mask, uint32_t values);
 };
 
 #endif /* _TCA6424A_H_ */
@@ -214,7 +214,9 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
  */
 int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data)
 {
-    uint8_t buff[length * 2];
+    // read straight into the caller's buffer and convert in place: word i
+    // only overlaps the two bytes it is decoded from
+    uint8_t *buff = (uint8_t *)data;
 
     if (readBytes(devAddr, regAddr, length * 2, buff) > 0)
     {
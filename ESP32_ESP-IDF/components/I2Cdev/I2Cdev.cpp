@@ -5,6 +5,9 @@
 //
 // Changelog:
 //      2015-01-02 - Initial release
+//      2026-10-19 - single command link with repeated START for reads, no per-call link allocation
+//      2026-10-19 - return errors instead of logging them, readTimeout-based timeouts, bus recovery
+//      2026-10-19 - add readBytesLong()/writeBytesLong() for transfers of 256 to 32767 bytes
 
 
 /* ============================================
@@ -35,14 +38,118 @@ THE SOFTWARE.
 #include <esp_err.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <driver/gpio.h>
 #include "sdkconfig.h"
+#if __has_include(<esp_idf_version.h>)
+#include <esp_idf_version.h>
+#endif
+#if __has_include(<esp_rom_sys.h>)
+#include <esp_rom_sys.h>
+#define I2CDEV_DELAY_US(us) esp_rom_delay_us(us)
+#else
+#include <rom/ets_sys.h>
+#define I2CDEV_DELAY_US(us) ets_delay_us(us)
+#endif
 
 #include "I2Cdev.h"
 
-#define I2C_NUM I2C_NUM_0
+static const char *TAG = "I2Cdev";
+
+// IDF 4.4 and later can build a command link inside a caller-supplied buffer,
+// which saves a heap allocation and free on every transaction. Two
+// START-delimited segments cover the longest link built here (register read).
+#if defined(ESP_IDF_VERSION) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+#define I2CDEV_CMD_LINK_STATIC  1
+#define I2CDEV_CMD_LINK_SIZE    I2C_LINK_RECOMMENDED_SIZE(2)
+#else
+#define I2CDEV_CMD_LINK_STATIC  0
+#define I2CDEV_CMD_LINK_SIZE    1
+#endif
+
+// queue one command on a link unless an earlier one already failed
+#define I2CDEV_LINK(x)          do { if (err == ESP_OK) err = (x); } while (0)
+
+static i2c_port_t i2cPort = I2C_NUM_0;
+static i2c_config_t i2cConfig;
+static bool i2cConfigValid = false;
+static thread_local esp_err_t lastError = ESP_OK;  // per task
+static uint8_t recoveryLevel = 0;       // backoff exponent, 0 = bus healthy
+static TickType_t recoveryHoldoff = 0;  // no new recovery before this tick
+
+// Serializes transactions against recoverBus(), which deletes and reinstalls
+// the driver, and guards the bus state above. Recursive because recovery
+// runs from inside a failed transaction.
+static StaticSemaphore_t busLockBuffer;
+static SemaphoreHandle_t busLock = NULL;
+static portMUX_TYPE busLockInit = portMUX_INITIALIZER_UNLOCKED;
+
+static bool busTake(TickType_t ticks) {
+	if (!busLock) {
+		portENTER_CRITICAL(&busLockInit);
+		if (!busLock) busLock = xSemaphoreCreateRecursiveMutexStatic(&busLockBuffer);
+		portEXIT_CRITICAL(&busLockInit);
+	}
+	return xSemaphoreTakeRecursive(busLock, ticks) == pdTRUE;
+}
+
+static inline void busGive() {
+	xSemaphoreGiveRecursive(busLock);
+}
 
-#undef ESP_ERROR_CHECK
-#define ESP_ERROR_CHECK(x)   do { esp_err_t rc = (x); if (rc != ESP_OK) { ESP_LOGE("err", "esp_err_t = %d", rc); /*assert(0 && #x);*/} } while(0);
+static inline i2c_cmd_handle_t cmdLinkCreate(uint8_t *buffer, uint32_t size) {
+#if I2CDEV_CMD_LINK_STATIC
+	return i2c_cmd_link_create_static(buffer, size);
+#else
+	return i2c_cmd_link_create();
+#endif
+}
+
+static inline void cmdLinkDelete(i2c_cmd_handle_t cmd) {
+#if I2CDEV_CMD_LINK_STATIC
+	i2c_cmd_link_delete_static(cmd);
+#else
+	i2c_cmd_link_delete(cmd);
+#endif
+}
+
+/** Run a built command link and account for the result.
+ * The link is always freed. Timeouts and driver state errors point at a
+ * stuck bus and trigger I2Cdev::recoverBus(); a NACK (ESP_FAIL) only means
+ * the device did not answer and is passed back as is. The transaction and
+ * any recovery run under the bus lock, which is waited for at most the same
+ * timeout.
+ * @param cmd Command link to execute
+ * @param err Result of building the link
+ * @param timeout Transaction timeout in milliseconds (0 to wait forever)
+ * @return ESP_OK or the first error seen
+ */
+static esp_err_t runLink(i2c_cmd_handle_t cmd, esp_err_t err, uint16_t timeout) {
+	if (err == ESP_OK) {
+		TickType_t ticks = portMAX_DELAY;
+		if (timeout) {
+			ticks = pdMS_TO_TICKS(timeout);
+			if (ticks == 0) ticks = 1;
+		}
+		if (!busTake(ticks)) {
+			cmdLinkDelete(cmd);
+			ESP_LOGW(TAG, "bus busy");
+			return lastError = ESP_ERR_TIMEOUT;
+		}
+		err = i2c_master_cmd_begin(i2cPort, cmd, ticks);
+		if (err == ESP_OK) {
+			recoveryLevel = 0;
+		} else if (err == ESP_ERR_TIMEOUT || err == ESP_ERR_INVALID_STATE) {
+			I2Cdev::recoverBus();
+		}
+		busGive();
+	}
+	cmdLinkDelete(cmd);
+
+	lastError = err;
+	if (err != ESP_OK) ESP_LOGW(TAG, "transaction failed: %s", esp_err_to_name(err));
+	return err;
+}
 
 /** Default constructor.
  */
@@ -62,6 +169,95 @@ void I2Cdev::enable(bool isEnabled) {
   
 }
 
+/** Select the I2C controller used for all transfers.
+ * Pass the configuration the driver was installed with to allow
+ * recoverBus() to clock a stuck slave free and reinstall the driver;
+ * without it recovery can only reset the controller FIFOs.
+ * @param port I2C controller (default I2C_NUM_0)
+ * @param config Configuration given to i2c_param_config(), or NULL
+ */
+void I2Cdev::setBus(i2c_port_t port, const i2c_config_t *config) {
+	busTake(portMAX_DELAY);
+	i2cPort = port;
+	i2cConfigValid = config != NULL;
+	if (config) i2cConfig = *config;
+	recoveryLevel = 0;
+	busGive();
+}
+
+/** Get the result of the calling task's most recent transaction.
+ * Each task sees only its own result, so a failure in one task is not
+ * reported to another sharing the bus.
+ * @return ESP_OK, ESP_FAIL (NACK), ESP_ERR_TIMEOUT, ESP_ERR_INVALID_STATE...
+ */
+esp_err_t I2Cdev::getLastError() {
+	return lastError;
+}
+
+/** Try to bring a stuck bus back.
+ * A slave that was interrupted mid-byte can hold SDA low indefinitely. With
+ * a configuration from setBus(), the driver is removed, SCL is clocked up to
+ * nine times until SDA is released, a STOP is generated by hand and the
+ * driver is reinstalled. Repeated recoveries back off exponentially from
+ * I2CDEV_RECOVERY_BACKOFF_MIN to I2CDEV_RECOVERY_BACKOFF_MAX milliseconds,
+ * so a dead bus costs each caller at most one timeout rather than a
+ * recovery storm. Called automatically on timeouts. Holds the bus lock, so
+ * other tasks' transactions wait for the driver to come back.
+ * @return True if a recovery was performed, false if still backing off
+ */
+bool I2Cdev::recoverBus() {
+	busTake(portMAX_DELAY);
+	TickType_t now = xTaskGetTickCount();
+	if (recoveryLevel && (int32_t)(now - recoveryHoldoff) < 0) {
+		busGive();
+		return false;
+	}
+
+	uint32_t backoff = (uint32_t)I2CDEV_RECOVERY_BACKOFF_MIN << recoveryLevel;
+	if (backoff >= I2CDEV_RECOVERY_BACKOFF_MAX) backoff = I2CDEV_RECOVERY_BACKOFF_MAX;
+	else recoveryLevel++;
+	recoveryHoldoff = now + pdMS_TO_TICKS(backoff);
+
+	if (!i2cConfigValid) {
+		i2c_reset_tx_fifo(i2cPort);
+		i2c_reset_rx_fifo(i2cPort);
+		busGive();
+		return true;
+	}
+
+	gpio_num_t sda = (gpio_num_t)i2cConfig.sda_io_num;
+	gpio_num_t scl = (gpio_num_t)i2cConfig.scl_io_num;
+	i2c_driver_delete(i2cPort);
+	gpio_set_level(sda, 1);
+	gpio_set_level(scl, 1);
+	gpio_set_direction(sda, GPIO_MODE_INPUT_OUTPUT_OD);
+	gpio_set_direction(scl, GPIO_MODE_INPUT_OUTPUT_OD);
+	gpio_set_pull_mode(sda, GPIO_PULLUP_ONLY);
+	gpio_set_pull_mode(scl, GPIO_PULLUP_ONLY);
+	I2CDEV_DELAY_US(5);
+	for (uint8_t i = 0; i < 9 && !gpio_get_level(sda); i++) {
+		gpio_set_level(scl, 0);
+		I2CDEV_DELAY_US(5);
+		gpio_set_level(scl, 1);
+		I2CDEV_DELAY_US(5);
+	}
+	// STOP: SDA rises while SCL is high
+	gpio_set_level(scl, 0);
+	I2CDEV_DELAY_US(5);
+	gpio_set_level(sda, 0);
+	I2CDEV_DELAY_US(5);
+	gpio_set_level(scl, 1);
+	I2CDEV_DELAY_US(5);
+	gpio_set_level(sda, 1);
+	I2CDEV_DELAY_US(5);
+
+	esp_err_t err = i2c_param_config(i2cPort, &i2cConfig);
+	if (err == ESP_OK) err = i2c_driver_install(i2cPort, i2cConfig.mode, 0, 0, 0);
+	if (err != ESP_OK) ESP_LOGE(TAG, "bus reinstall failed: %s", esp_err_to_name(err));
+	busGive();
+	return true;
+}
+
 /** Default timeout value for read operations.
  */
 uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
@@ -74,11 +270,9 @@ uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
  * @return Status of read operation (true = success)
  */
 int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
-
-
 	uint8_t b;
-    uint8_t count = readByte(devAddr, regAddr, &b, timeout);
-    *data = b & (1 << bitNum);
+    int8_t count = readByte(devAddr, regAddr, &b, timeout);
+    if (count > 0) *data = b & (1 << bitNum);
     return count;
 }
 
@@ -97,8 +291,9 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
     //    xxx   args: bitStart=4, length=3
     //    010   masked
     //   -> 010 shifted
-    uint8_t count, b;
-    if ((count = readByte(devAddr, regAddr, &b, timeout)) != 0) {
+    int8_t count;
+    uint8_t b;
+    if ((count = readByte(devAddr, regAddr, &b, timeout)) > 0) {
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         b &= mask;
         b >>= (bitStart - length + 1);
@@ -124,45 +319,57 @@ int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_
  * @param length Number of bytes to read
  * @param data Buffer to store read data in
  * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
- * @return I2C_TransferReturn_TypeDef http://downloads.energymicro.com/documentation/doxygen/group__I2C.html
+ * @return Number of bytes read (-1 indicates failure, see getLastError())
  */
 int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-	i2c_cmd_handle_t cmd;
-	SelectRegister(devAddr, regAddr);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
-
-	if(length>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, length-1, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+length-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	return readBytesLong(devAddr, regAddr, length, data, timeout);
+}
 
-	return length;
+/** Read up to I2CDEV_LONG_MAX_LENGTH (32767) bytes from an 8-bit device register.
+ * The driver has no transfer size limit, so this is still one link and one
+ * transaction (e.g. a full 1 KB MPU6050 FIFO drain).
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure, see getLastError())
+ */
+int16_t I2Cdev::readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+	if (length == 0) return 0;
+	if (length > I2CDEV_LONG_MAX_LENGTH) {
+		lastError = ESP_ERR_INVALID_SIZE;
+		return -1;
+	}
+
+	// START, address+W, register, repeated START, address+R, data, STOP as a
+	// single link, so the driver runs the whole transfer in one go
+	uint8_t link[I2CDEV_CMD_LINK_SIZE];
+	i2c_cmd_handle_t cmd = cmdLinkCreate(link, sizeof(link));
+	if (!cmd) {
+		lastError = ESP_ERR_NO_MEM;
+		return -1;
+	}
+	esp_err_t err = ESP_OK;
+	I2CDEV_LINK(i2c_master_start(cmd));
+	I2CDEV_LINK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
+	I2CDEV_LINK(i2c_master_write_byte(cmd, regAddr, 1));
+	I2CDEV_LINK(i2c_master_start(cmd));
+	I2CDEV_LINK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_READ, 1));
+	I2CDEV_LINK(i2c_master_read(cmd, data, length, I2C_MASTER_LAST_NACK));
+	I2CDEV_LINK(i2c_master_stop(cmd));
+
+	return runLink(cmd, err, timeout) == ESP_OK ? length : -1;
 }
 
 bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
 
 	uint8_t data1[] = {(uint8_t)(data>>8), (uint8_t)(data & 0xff)};
-	writeBytes(devAddr, regAddr, 2, data1);
-	return true;
+	return writeBytes(devAddr, regAddr, 2, data1);
 }
 
 void I2Cdev::SelectRegister(uint8_t dev, uint8_t reg){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (dev << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, reg, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
+	writeBytes(dev, reg, 0, NULL);
 }
 
 /** write a single bit in an 8-bit device register.
@@ -174,7 +381,7 @@ void I2Cdev::SelectRegister(uint8_t dev, uint8_t reg){
  */
 bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
     uint8_t b;
-    readByte(devAddr, regAddr, &b);
+    if (readByte(devAddr, regAddr, &b) <= 0) return false;
     b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
     return writeByte(devAddr, regAddr, b);
 }
@@ -196,7 +403,7 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
     // 10100011 original & ~mask
     // 10101011 masked | value
     uint8_t b = 0;
-    if (readByte(devAddr, regAddr, &b) != 0) {
+    if (readByte(devAddr, regAddr, &b) > 0) {
         uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
         data <<= (bitStart - length + 1); // shift data into correct position
         data &= mask; // zero all non-important bits in data
@@ -215,40 +422,49 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data, 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-
-	return true;
+	return writeBytes(devAddr, regAddr, 1, &data);
 }
 
-/** Write single byte to an 8-bit device register.
+/** Write multiple bytes to an 8-bit device register.
+ * Uses I2Cdev::readTimeout as the transaction timeout.
  * @param devAddr I2C slave device address
  * @param regAddr Register address to write to
  * @param length Number of bytes to write
  * @param data Array of bytes to write
- * @return Status of operation (true = success)
+ * @return Status of operation (true = success, see getLastError() otherwise)
  */
 bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
-	i2c_cmd_handle_t cmd;
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, regAddr, 1));
-	ESP_ERROR_CHECK(i2c_master_write(cmd, data, length-1, 0));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, data[length-1], 1));
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000/portTICK_PERIOD_MS));
-	i2c_cmd_link_delete(cmd);
-	return true;
+	return writeBytesLong(devAddr, regAddr, length, data);
+}
+
+/** Write up to I2CDEV_LONG_MAX_LENGTH (32767) bytes to an 8-bit device register as a single link.
+ * Uses I2Cdev::readTimeout as the transaction timeout.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register address to write to
+ * @param length Number of bytes to write (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Array of bytes to write
+ * @return Status of operation (true = success, see getLastError() otherwise)
+ */
+bool I2Cdev::writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data){
+	if (length > I2CDEV_LONG_MAX_LENGTH) {
+		lastError = ESP_ERR_INVALID_SIZE;
+		return false;
+	}
+	uint8_t link[I2CDEV_CMD_LINK_SIZE];
+	i2c_cmd_handle_t cmd = cmdLinkCreate(link, sizeof(link));
+	if (!cmd) {
+		lastError = ESP_ERR_NO_MEM;
+		return false;
+	}
+	esp_err_t err = ESP_OK;
+	I2CDEV_LINK(i2c_master_start(cmd));
+	I2CDEV_LINK(i2c_master_write_byte(cmd, (devAddr << 1) | I2C_MASTER_WRITE, 1));
+	I2CDEV_LINK(i2c_master_write_byte(cmd, regAddr, 1));
+	if (length > 0)
+		I2CDEV_LINK(i2c_master_write(cmd, data, length, 1));
+	I2CDEV_LINK(i2c_master_stop(cmd));
+
+	return runLink(cmd, err, readTimeout) == ESP_OK;
 }
 
 
@@ -258,13 +474,11 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
  * @param regAddr
  * @param data
  * @param timeout
- * @return
+ * @return Number of words read (-1 indicates failure)
  */
 int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout){
 	uint8_t msb[2] = {0,0};
-	readBytes(devAddr, regAddr, 2, msb);
+	if (readBytes(devAddr, regAddr, 2, msb, timeout) != 2) return -1;
 	*data = (int16_t)((msb[0] << 8) | msb[1]);
-	return 0;
+	return 1;
 }
-
-
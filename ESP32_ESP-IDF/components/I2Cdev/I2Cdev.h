@@ -5,6 +5,8 @@
 //
 // Changelog:
 //      2015-01-02 - Initial release
+//      2026-10-19 - add readBytesLong()/writeBytesLong() for transfers of 256 to 32767 bytes
+//      2026-10-19 - serialize transactions and bus recovery with a mutex, per-task getLastError()
 
 
 /* ============================================
@@ -48,12 +50,23 @@ THE SOFTWARE.
 
 #define I2CDEV_DEFAULT_READ_TIMEOUT 1000
 
+// longest readBytesLong()/writeBytesLong() transfer; the byte count comes
+// back as int16_t, so anything longer is rejected
+#define I2CDEV_LONG_MAX_LENGTH 32767
+
+// bus recovery backoff range in milliseconds, see I2Cdev::recoverBus()
+#define I2CDEV_RECOVERY_BACKOFF_MIN 10
+#define I2CDEV_RECOVERY_BACKOFF_MAX 1000
+
 class I2Cdev {
     public:
         I2Cdev();
 
         static void initialize();
         static void enable(bool isEnabled);
+        static void setBus(i2c_port_t port, const i2c_config_t *config=NULL);
+        static esp_err_t getLastError();
+        static bool recoverBus();
 
         static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
         //TODO static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
@@ -62,6 +75,7 @@ class I2Cdev {
         static int8_t readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
         static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
         static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int16_t readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
         //TODO static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
 
         static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
@@ -71,6 +85,7 @@ class I2Cdev {
         static bool writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data);
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
+        static bool writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
         //TODO static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
 
         static uint16_t readTimeout;
@@ -0,0 +1,96 @@
+// I2Cdev library collection - ESP-IDF host test support
+// See mock_idf.h.
+
+#include <cstdio>
+#include <cstring>
+#include "mock_idf.h"
+#include "driver/gpio.h"
+#include "esp_rom_sys.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+MockIdf mock;
+
+void mockReset() {
+    mock = MockIdf();
+    mock.result = ESP_OK;
+    mock.lockHeldDuringBegin = true;
+}
+
+static void record(const char *op) {
+    if (!mock.link.empty()) mock.link += ' ';
+    mock.link += op;
+}
+
+static void record(const char *fmt, unsigned value) {
+    char op[16];
+    snprintf(op, sizeof(op), fmt, value);
+    record(op);
+}
+
+const char *esp_err_to_name(esp_err_t) { return "mock"; }
+void esp_rom_delay_us(uint32_t) {}
+
+TickType_t xTaskGetTickCount() { return mock.now; }
+void vTaskDelay(TickType_t ticks) { mock.now += ticks; }
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutexStatic(StaticSemaphore_t *buffer) { return buffer; }
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t, TickType_t) {
+    if (mock.lockHeldElsewhere) return pdFALSE;
+    if (++mock.lockDepth > mock.lockMaxDepth) mock.lockMaxDepth = mock.lockDepth;
+    return pdTRUE;
+}
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t) {
+    mock.lockDepth--;
+    return pdTRUE;
+}
+
+i2c_cmd_handle_t i2c_cmd_link_create() {
+    mock.heapLinks++;
+    mock.link.clear();
+    return &mock;
+}
+void i2c_cmd_link_delete(i2c_cmd_handle_t) {}
+i2c_cmd_handle_t i2c_cmd_link_create_static(uint8_t *buffer, uint32_t size) {
+    mock.link.clear();
+    return size >= I2C_LINK_RECOMMENDED_SIZE(1) ? buffer : NULL;
+}
+void i2c_cmd_link_delete_static(i2c_cmd_handle_t) {}
+
+esp_err_t i2c_master_start(i2c_cmd_handle_t) { record("S"); return ESP_OK; }
+esp_err_t i2c_master_stop(i2c_cmd_handle_t) { record("P"); return ESP_OK; }
+esp_err_t i2c_master_write_byte(i2c_cmd_handle_t, uint8_t data, bool) { record("W%02X", data); return ESP_OK; }
+esp_err_t i2c_master_write(i2c_cmd_handle_t, const uint8_t *, size_t len, bool) { record("W[%u]", (unsigned)len); return ESP_OK; }
+esp_err_t i2c_master_read_byte(i2c_cmd_handle_t, uint8_t *data, i2c_ack_type_t) {
+    record("R1");
+    *data = 0xA5;
+    return ESP_OK;
+}
+esp_err_t i2c_master_read(i2c_cmd_handle_t, uint8_t *data, size_t len, i2c_ack_type_t ack) {
+    record(ack == I2C_MASTER_LAST_NACK ? "R%u" : "R%u+", (unsigned)len);
+    memset(data, 0xA5, len);
+    return ESP_OK;
+}
+esp_err_t i2c_master_cmd_begin(i2c_port_t, i2c_cmd_handle_t, TickType_t ticks) {
+    mock.cmdBegins++;
+    mock.lastTicks = ticks;
+    if (mock.lockDepth == 0) mock.lockHeldDuringBegin = false;
+    return mock.result;
+}
+
+esp_err_t i2c_reset_tx_fifo(i2c_port_t) { mock.fifoResets++; return ESP_OK; }
+esp_err_t i2c_reset_rx_fifo(i2c_port_t) { return ESP_OK; }
+esp_err_t i2c_param_config(i2c_port_t, const i2c_config_t *) { return ESP_OK; }
+esp_err_t i2c_driver_install(i2c_port_t, i2c_mode_t, size_t, size_t, int) { mock.driverInstalls++; return ESP_OK; }
+esp_err_t i2c_driver_delete(i2c_port_t) { mock.driverDeletes++; return ESP_OK; }
+
+esp_err_t gpio_set_level(gpio_num_t gpio, uint32_t level) {
+    if (gpio == MOCK_SCL && level == 0) {
+        mock.sclPulses++;
+        if (mock.sdaStuckPulses) mock.sdaStuckPulses--;
+    }
+    return ESP_OK;
+}
+int gpio_get_level(gpio_num_t gpio) { return gpio == MOCK_SDA && mock.sdaStuckPulses ? 0 : 1; }
+esp_err_t gpio_set_direction(gpio_num_t, gpio_mode_t) { return ESP_OK; }
+esp_err_t gpio_set_pull_mode(gpio_num_t, gpio_pull_mode_t) { return ESP_OK; }
@@ -0,0 +1,41 @@
+// I2Cdev library collection - ESP-IDF host test support
+// Recording mock of the i2c_master_* driver, GPIO and FreeRTOS calls made by
+// I2Cdev.cpp. Tests set the knobs and inspect the counters below.
+
+#ifndef _MOCK_IDF_H_
+#define _MOCK_IDF_H_
+
+#include <string>
+#include "driver/i2c.h"
+
+// pins the tests pass to I2Cdev::setBus()
+#define MOCK_SDA 21
+#define MOCK_SCL 22
+
+struct MockIdf {
+    // knobs
+    esp_err_t result;           // returned by i2c_master_cmd_begin()
+    int sdaStuckPulses;         // SCL pulses until a stuck slave lets SDA go
+    bool lockHeldElsewhere;     // another task owns the bus mutex
+    TickType_t now;             // xTaskGetTickCount()
+
+    // observations
+    std::string link;           // last command link, e.g. "S W68 W3B S W69 R14 P"
+    int heapLinks;              // i2c_cmd_link_create() calls
+    int cmdBegins;              // i2c_master_cmd_begin() calls
+    TickType_t lastTicks;       // timeout given to i2c_master_cmd_begin()
+    int fifoResets;
+    int sclPulses;
+    int driverDeletes;
+    int driverInstalls;
+    int lockDepth;              // current mutex nesting
+    int lockMaxDepth;
+    bool lockHeldDuringBegin;   // every cmd_begin ran under the mutex
+};
+
+extern MockIdf mock;
+
+/** Reset all knobs and counters. */
+void mockReset();
+
+#endif /* _MOCK_IDF_H_ */
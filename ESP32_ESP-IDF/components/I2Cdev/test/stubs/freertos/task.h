@@ -0,0 +1,5 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
@@ -0,0 +1,124 @@
+// I2Cdev library collection - ESP-IDF host test
+// Checks error propagation, stuck-bus recovery with backoff, the bus mutex
+// and the per-task getLastError().
+
+#include <cassert>
+#include <cstdio>
+#include <thread>
+#include "mock_idf.h"
+#include "I2Cdev.h"
+
+static void testNack() {
+    uint8_t data[4];
+    uint16_t word;
+    mockReset();
+    mock.result = ESP_FAIL;
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data) == -1);
+    assert(I2Cdev::getLastError() == ESP_FAIL);
+    assert(!I2Cdev::writeByte(0x68, 0x6B, 0));
+    assert(I2Cdev::readWord(0x68, 0x3B, &word) == -1);
+    assert(!I2Cdev::writeBits(0x68, 0x6B, 3, 2, 1));
+    // a NACK is the device's answer, not a stuck bus
+    assert(mock.fifoResets == 0 && mock.driverDeletes == 0);
+
+    mock.result = ESP_OK;
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data) == 4);
+    assert(I2Cdev::getLastError() == ESP_OK);
+}
+
+static void testSizeLimit() {
+    uint8_t data[1];
+    mockReset();
+    assert(I2Cdev::readBytesLong(0x68, 0x74, I2CDEV_LONG_MAX_LENGTH + 1, data) == -1);
+    assert(I2Cdev::getLastError() == ESP_ERR_INVALID_SIZE);
+    assert(!I2Cdev::writeBytesLong(0x68, 0x74, I2CDEV_LONG_MAX_LENGTH + 1, data));
+    assert(mock.cmdBegins == 0);
+}
+
+static void testRecoveryWithoutConfig() {
+    uint8_t data[4];
+    mockReset();
+    I2Cdev::setBus(I2C_NUM_0);
+    mock.result = ESP_ERR_TIMEOUT;
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data) == -1);
+    assert(I2Cdev::getLastError() == ESP_ERR_TIMEOUT);
+    assert(mock.fifoResets == 1 && mock.driverDeletes == 0);
+    // backing off: the next failure does not reset again straight away
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data) == -1);
+    assert(mock.fifoResets == 1);
+}
+
+static void testRecoveryBackoff() {
+    uint8_t data[4];
+    i2c_config_t config = i2c_config_t();
+    config.sda_io_num = MOCK_SDA;
+    config.scl_io_num = MOCK_SCL;
+    mockReset();
+    I2Cdev::setBus(I2C_NUM_0, &config);
+
+    // a slave holding SDA low is clocked free and the driver reinstalled
+    mock.result = ESP_ERR_INVALID_STATE;
+    mock.sdaStuckPulses = 3;
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data) == -1);
+    assert(mock.sdaStuckPulses == 0 && mock.driverDeletes == 1 && mock.driverInstalls == 1);
+
+    mock.result = ESP_ERR_TIMEOUT;
+    mock.now += I2CDEV_RECOVERY_BACKOFF_MIN / 2;
+    I2Cdev::readBytes(0x68, 0x3B, 4, data);
+    assert(mock.driverInstalls == 1);
+    mock.now += I2CDEV_RECOVERY_BACKOFF_MIN / 2;
+    I2Cdev::readBytes(0x68, 0x3B, 4, data);
+    assert(mock.driverInstalls == 2);
+    // the holdoff doubles with every recovery
+    mock.now += I2CDEV_RECOVERY_BACKOFF_MIN * 3 / 2;
+    I2Cdev::readBytes(0x68, 0x3B, 4, data);
+    assert(mock.driverInstalls == 2);
+    mock.now += I2CDEV_RECOVERY_BACKOFF_MIN;
+    I2Cdev::readBytes(0x68, 0x3B, 4, data);
+    assert(mock.driverInstalls == 3);
+
+    // a good transfer resets the backoff
+    mock.result = ESP_OK;
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data) == 4);
+    mock.result = ESP_ERR_TIMEOUT;
+    mock.now += I2CDEV_RECOVERY_BACKOFF_MIN;
+    I2Cdev::readBytes(0x68, 0x3B, 4, data);
+    assert(mock.driverInstalls == 4);
+    I2Cdev::setBus(I2C_NUM_0);
+}
+
+static void testLocking() {
+    uint8_t data[4];
+    mockReset();
+    I2Cdev::setBus(I2C_NUM_0);
+    mock.result = ESP_ERR_TIMEOUT;
+    I2Cdev::readBytes(0x68, 0x3B, 4, data);
+    // recovery runs inside the failed transaction's lock
+    assert(mock.lockHeldDuringBegin && mock.lockMaxDepth == 2 && mock.lockDepth == 0);
+
+    mockReset();
+    mock.lockHeldElsewhere = true;
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data, 10) == -1);
+    assert(I2Cdev::getLastError() == ESP_ERR_TIMEOUT && mock.cmdBegins == 0);
+}
+
+static void testLastErrorPerTask() {
+    uint8_t data[4];
+    mockReset();
+    mock.result = ESP_FAIL;
+    assert(I2Cdev::readBytes(0x68, 0x3B, 4, data) == -1);
+    std::thread other([] { assert(I2Cdev::getLastError() == ESP_OK); });
+    other.join();
+    assert(I2Cdev::getLastError() == ESP_FAIL);
+}
+
+int main() {
+    testNack();
+    testSizeLimit();
+    testRecoveryWithoutConfig();
+    testRecoveryBackoff();
+    testLocking();
+    testLastErrorPerTask();
+    puts("ESP-IDF I2Cdev errors: all tests passed");
+    return 0;
+}
@@ -0,0 +1,67 @@
+// I2Cdev library collection - ESP-IDF host test
+// Checks the shape of the command links I2Cdev.cpp builds: one link and one
+// i2c_master_cmd_begin() per transfer, register reads as a repeated-start
+// sequence, and no heap links on IDF 4.4 and later.
+
+#include <cassert>
+#include <cstdio>
+#include "mock_idf.h"
+#include "esp_idf_version.h"
+#include "I2Cdev.h"
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 4, 0)
+#define HEAP_LINKS_PER_TRANSFER 0
+#else
+#define HEAP_LINKS_PER_TRANSFER 1
+#endif
+
+static void testRead() {
+    uint8_t data[14];
+    mockReset();
+    assert(I2Cdev::readBytes(0x68, 0x3B, 14, data) == 14);
+    assert(mock.link == "S WD0 W3B S WD1 R14 P");
+    assert(mock.cmdBegins == 1 && mock.heapLinks == HEAP_LINKS_PER_TRANSFER);
+    assert(data[13] == 0xA5);
+
+    uint16_t word;
+    mockReset();
+    assert(I2Cdev::readWord(0x68, 0x3B, &word) == 1);
+    assert(mock.link == "S WD0 W3B S WD1 R2 P" && mock.cmdBegins == 1);
+}
+
+static void testLongRead() {
+    static uint8_t fifo[1024];
+    mockReset();
+    assert(I2Cdev::readBytesLong(0x68, 0x74, 1024, fifo) == 1024);
+    assert(mock.link == "S WD0 W74 S WD1 R1024 P" && mock.cmdBegins == 1);
+}
+
+static void testWrite() {
+    uint8_t data[3] = { 1, 2, 3 };
+    mockReset();
+    assert(I2Cdev::writeBytes(0x68, 0x6B, 3, data));
+    assert(mock.link == "S WD0 W6B W[3] P");
+    assert(mock.cmdBegins == 1 && mock.heapLinks == HEAP_LINKS_PER_TRANSFER);
+
+    mockReset();
+    I2Cdev::SelectRegister(0x68, 0x75);
+    assert(mock.link == "S WD0 W75 P" && mock.cmdBegins == 1);
+}
+
+static void testTimeout() {
+    uint8_t data;
+    mockReset();
+    I2Cdev::readBytes(0x68, 0x75, 1, &data, 50);
+    assert(mock.lastTicks == pdMS_TO_TICKS(50));
+    I2Cdev::readBytes(0x68, 0x75, 1, &data, 0);
+    assert(mock.lastTicks == portMAX_DELAY);
+}
+
+int main() {
+    testRead();
+    testLongRead();
+    testWrite();
+    testTimeout();
+    puts("ESP-IDF I2Cdev link: all tests passed");
+    return 0;
+}
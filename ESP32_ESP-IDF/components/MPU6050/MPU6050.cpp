@@ -37,25 +37,8 @@ THE SOFTWARE.
 #include "MPU6050.h"
 #include <string.h>
 
-#define I2C_NUM I2C_NUM_0
-
 void MPU6050::ReadRegister(uint8_t reg, uint8_t *data, uint8_t len){
-	uint8_t dev = 0x68;
-	i2c_cmd_handle_t cmd;
-	I2Cdev::SelectRegister(dev, reg);
-
-	cmd = i2c_cmd_link_create();
-	ESP_ERROR_CHECK(i2c_master_start(cmd));
-	ESP_ERROR_CHECK(i2c_master_write_byte(cmd, (dev << 1) | I2C_MASTER_READ, 1));
-
-	if(len>1)
-		ESP_ERROR_CHECK(i2c_master_read(cmd, data, len, I2C_MASTER_ACK));
-
-	ESP_ERROR_CHECK(i2c_master_read_byte(cmd, data+len-1, I2C_MASTER_NACK));
-
-	ESP_ERROR_CHECK(i2c_master_stop(cmd));
-	ESP_ERROR_CHECK(i2c_master_cmd_begin(I2C_NUM, cmd, 1000));
-	i2c_cmd_link_delete(cmd);
+	I2Cdev::readBytes(devAddr, reg, len, data);
 }
 
 
@@ -1813,13 +1796,14 @@ void MPU6050::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, buffer);
-    *ax = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *ay = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *az = (((int16_t)buffer[4]) << 8) | buffer[5];
-    *gx = (((int16_t)buffer[8]) << 8) | buffer[9];
-    *gy = (((int16_t)buffer[10]) << 8) | buffer[11];
-    *gz = (((int16_t)buffer[12]) << 8) | buffer[13];
+    uint8_t data[14] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, data);
+    *ax = (((int16_t)data[0]) << 8) | data[1];
+    *ay = (((int16_t)data[2]) << 8) | data[3];
+    *az = (((int16_t)data[4]) << 8) | data[5];
+    *gx = (((int16_t)data[8]) << 8) | data[9];
+    *gy = (((int16_t)data[10]) << 8) | data[11];
+    *gz = (((int16_t)data[12]) << 8) | data[13];
 }
 /** Get 3-axis accelerometer readings.
  * These registers store the most recent accelerometer measurements.
@@ -1858,10 +1842,11 @@ void MPU6050::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, buffer);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    uint8_t data[6] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, data);
+    *x = (((int16_t)data[0]) << 8) | data[1];
+    *y = (((int16_t)data[2]) << 8) | data[3];
+    *z = (((int16_t)data[4]) << 8) | data[5];
 }
 /** Get X-axis accelerometer reading.
  * @return X-axis acceleration measurement in 16-bit 2's complement format
@@ -1869,8 +1854,9 @@ void MPU6050::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 int16_t MPU6050::getAccelerationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, data);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Y-axis accelerometer reading.
  * @return Y-axis acceleration measurement in 16-bit 2's complement format
@@ -1878,8 +1864,9 @@ int16_t MPU6050::getAccelerationX() {
  * @see MPU6050_RA_ACCEL_YOUT_H
  */
 int16_t MPU6050::getAccelerationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, data);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Z-axis accelerometer reading.
  * @return Z-axis acceleration measurement in 16-bit 2's complement format
@@ -1887,8 +1874,9 @@ int16_t MPU6050::getAccelerationY() {
  * @see MPU6050_RA_ACCEL_ZOUT_H
  */
 int16_t MPU6050::getAccelerationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, data);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // TEMP_OUT_* registers
@@ -1898,8 +1886,9 @@ int16_t MPU6050::getAccelerationZ() {
  * @see MPU6050_RA_TEMP_OUT_H
  */
 int16_t MPU6050::getTemperature() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, data);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // GYRO_*OUT_* registers
@@ -1937,10 +1926,11 @@ int16_t MPU6050::getTemperature() {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050::getRotation(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, buffer);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    uint8_t data[6] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, data);
+    *x = (((int16_t)data[0]) << 8) | data[1];
+    *y = (((int16_t)data[2]) << 8) | data[3];
+    *z = (((int16_t)data[4]) << 8) | data[5];
 }
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
@@ -1948,8 +1938,9 @@ void MPU6050::getRotation(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 int16_t MPU6050::getRotationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, data);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Y-axis gyroscope reading.
  * @return Y-axis rotation measurement in 16-bit 2's complement format
@@ -1957,8 +1948,9 @@ int16_t MPU6050::getRotationX() {
  * @see MPU6050_RA_GYRO_YOUT_H
  */
 int16_t MPU6050::getRotationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, data);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Z-axis gyroscope reading.
  * @return Z-axis rotation measurement in 16-bit 2's complement format
@@ -1966,8 +1958,9 @@ int16_t MPU6050::getRotationY() {
  * @see MPU6050_RA_GYRO_ZOUT_H
  */
 int16_t MPU6050::getRotationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, buffer);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, data);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // EXT_SENS_DATA_* registers
@@ -2728,8 +2721,9 @@ void MPU6050::setStandbyZGyroEnabled(bool enabled) {
  * @return Current FIFO buffer size
  */
 uint16_t MPU6050::getFIFOCount() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, buffer);
-    return (((uint16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, data);
+    return (((uint16_t)data[0]) << 8) | data[1];
 }
 
 // FIFO_R_W register
@@ -2760,12 +2754,13 @@ uint16_t MPU6050::getFIFOCount() {
  * @return Byte from FIFO buffer
  */
 uint8_t MPU6050::getFIFOByte() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, buffer);
-    return buffer[0];
+    uint8_t data[1] = { 0 };
+    I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, data);
+    return data[0];
 }
-void MPU6050::getFIFOBytes(uint8_t *data, uint8_t length) {
+void MPU6050::getFIFOBytes(uint8_t *data, uint16_t length) {
     if(length > 0){
-        I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_R_W, length, data);
+        I2Cdev::readBytesLong(devAddr, MPU6050_RA_FIFO_R_W, length, data);
     } else {
     	*data = 0;
     }
@@ -3352,4 +3347,79 @@ void MPU6050::PID(uint8_t ReadAddress, float kP,float kI, uint8_t Loops){
     }
     resetFIFO();
     resetDMP();
-}
\ No newline at end of file
+}
+
+/** Read all six offset registers.
+ * Gyro offsets (XG_OFFS_USR*) are read in one burst, as are the accelerometer
+ * offsets on the MPU-6050 (XA_OFFS_*). The MPU-6500 family keeps its
+ * accelerometer offsets at 0x77/0x7A/0x7D with reserved bytes in between, so
+ * those take one 2-byte read each.
+ * @param offsets Container for accel X/Y/Z then gyro X/Y/Z offsets
+ * @see writeOffsets()
+ */
+void MPU6050::readOffsets(int16_t *offsets) {
+    uint8_t data[6] = { 0 };
+    if (getDeviceID() < 0x38) {
+        I2Cdev::readBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data);
+    } else {
+        for (uint8_t i = 0; i < 3; i++) {
+            I2Cdev::readBytes(devAddr, 0x77 + i * 3, 2, data + i * 2);
+        }
+    }
+    for (uint8_t i = 0; i < 3; i++) offsets[i] = (((int16_t)data[i * 2]) << 8) | data[i * 2 + 1];
+
+    I2Cdev::readBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data);
+    for (uint8_t i = 0; i < 3; i++) offsets[i + 3] = (((int16_t)data[i * 2]) << 8) | data[i * 2 + 1];
+}
+/** Write all six offset registers in as few bursts as the part allows.
+ * @param offsets Accel X/Y/Z then gyro X/Y/Z offsets
+ * @see readOffsets()
+ */
+void MPU6050::writeOffsets(const int16_t *offsets) {
+    uint8_t data[6];
+    for (uint8_t i = 0; i < 3; i++) {
+        data[i * 2] = offsets[i] >> 8;
+        data[i * 2 + 1] = offsets[i];
+    }
+    if (getDeviceID() < 0x38) {
+        I2Cdev::writeBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data);
+    } else {
+        for (uint8_t i = 0; i < 3; i++) {
+            I2Cdev::writeBytes(devAddr, 0x77 + i * 3, 2, data + i * 2);
+        }
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+        data[i * 2] = offsets[i + 3] >> 8;
+        data[i * 2 + 1] = offsets[i + 3];
+    }
+    I2Cdev::writeBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data);
+}
+/** Capture the current offsets as a calibration record.
+ * Call this after CalibrateAccel() and CalibrateGyro(), then store the record with MPU6050_CalibrationRecord::save().
+ * @param record Container for the device ID, die temperature and offsets
+ * @param serial Caller-chosen serial to key the record with (0 if unused)
+ * @see applyCalibration()
+ */
+void MPU6050::getCalibration(MPU6050_CalibrationRecord *record, uint32_t serial) {
+    record->deviceID = getDeviceID();
+    record->serial = serial;
+    record->temperature = getTemperature();
+    readOffsets(record->offsets);
+}
+/** Apply a stored calibration record if it belongs to this device.
+ * The record is only used if its device ID and serial match and the die
+ * temperature is within the given window of the one it was captured at, so a
+ * foreign or stale record falls back to recalibration instead of being
+ * applied blindly. All six offsets are written with writeOffsets().
+ * @param record Record previously filled by getCalibration() or loaded from storage
+ * @param serial Serial the record must have been saved with
+ * @param window Largest accepted raw TEMP_OUT difference
+ * @return True if the record matched and was applied
+ * @see getCalibration()
+ */
+bool MPU6050::applyCalibration(const MPU6050_CalibrationRecord *record, uint32_t serial, int16_t window) {
+    if (!record->matches(getDeviceID(), serial, getTemperature(), window)) return false;
+    writeOffsets(record->offsets);
+    return true;
+}
@@ -38,6 +38,7 @@ THE SOFTWARE.
 #define _MPU6050_H_
 
 #include "helper_3dmath.h"
+#include "helper_calibration.h"
 #include "I2Cdev.h"
 
 // supporting link:  http://forum.arduino.cc/index.php?&topic=143444.msg1079517#msg1079517
@@ -718,7 +719,7 @@ class MPU6050 {
         // FIFO_R_W register
         uint8_t getFIFOByte();
         void setFIFOByte(uint8_t data);
-        void getFIFOBytes(uint8_t *data, uint8_t length);
+        void getFIFOBytes(uint8_t *data, uint16_t length);
 
         // WHO_AM_I register
         uint8_t getDeviceID();
@@ -1026,6 +1027,11 @@ class MPU6050 {
             uint16_t dmpGetFIFOPacketSize();
         #endif
 
+    void readOffsets(int16_t *offsets);
+    void writeOffsets(const int16_t *offsets);
+    void getCalibration(MPU6050_CalibrationRecord *record, uint32_t serial=0);
+    bool applyCalibration(const MPU6050_CalibrationRecord *record, uint32_t serial=0, int16_t window=MPU6050_CALIBRATION_TEMP_WINDOW);
+
     void CalibrateGyro(uint8_t Loops = 15); // Fine tune after setting offsets with less Loops.
     void CalibrateAccel(uint8_t Loops = 15);// Fine tune after setting offsets with less Loops.
     void PID(uint8_t ReadAddress, float kP,float kI, uint8_t Loops);  // Does the
@@ -0,0 +1,229 @@
+// I2Cdev library collection - MPU6050 calibration record helper
+// Versioned, checksummed binary offset record with platform storage hooks
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_CALIBRATION_H_
+#define _HELPER_CALIBRATION_H_
+
+#include <stdint.h>
+
+#define MPU6050_CALIBRATION_MAGIC       0x4D43 // "CM" in little-endian byte order
+#define MPU6050_CALIBRATION_VERSION     1
+#define MPU6050_CALIBRATION_SIZE        24     // packed record length in bytes
+#define MPU6050_CALIBRATION_TEMP_WINDOW 3400   // default max TEMP_OUT difference (340 LSB/degC, so 10 degC)
+
+// storage hooks: move a packed record to/from non-volatile storage
+typedef bool (*MPU6050_CalibrationSaveHook)(const uint8_t *data, uint8_t length, void *context);
+typedef bool (*MPU6050_CalibrationLoadHook)(uint8_t *data, uint8_t length, void *context);
+
+/** Offset calibration record that can be stored and re-applied at boot.
+ * The packed form is 24 bytes, little-endian and independent of the
+ * compiler's struct layout:
+ *
+ * <pre>
+ *  0  magic (2)        4  serial (4)        10  offsets (6 x 2)
+ *  2  version (1)      8  temperature (2)   22  CRC-16/CCITT of bytes 0-21 (2)
+ *  3  device ID (1)
+ * </pre>
+ *
+ * The record is keyed by the WHO_AM_I device ID and a caller-chosen serial
+ * (e.g. a board ID; 0 if unused), and remembers the die temperature at which
+ * the offsets were measured, so a stale or foreign record is never applied.
+ * See MPU6050::getCalibration() and MPU6050::applyCalibration().
+ */
+class MPU6050_CalibrationRecord {
+    public:
+        uint8_t deviceID;
+        uint32_t serial;
+        int16_t temperature;   // raw TEMP_OUT at calibration time
+        int16_t offsets[6];    // accel X/Y/Z then gyro X/Y/Z offset registers
+
+        MPU6050_CalibrationRecord() {
+            deviceID = 0;
+            serial = 0;
+            temperature = 0;
+            for (uint8_t i = 0; i < 6; i++) offsets[i] = 0;
+        }
+
+        /** Serialize the record.
+         * @param data Container of at least MPU6050_CALIBRATION_SIZE bytes
+         */
+        void pack(uint8_t *data) const {
+            put16(data, MPU6050_CALIBRATION_MAGIC);
+            data[2] = MPU6050_CALIBRATION_VERSION;
+            data[3] = deviceID;
+            put16(data + 4, serial);
+            put16(data + 6, serial >> 16);
+            put16(data + 8, temperature);
+            for (uint8_t i = 0; i < 6; i++) put16(data + 10 + i * 2, offsets[i]);
+            put16(data + 22, crc16(data, 22));
+        }
+
+        /** Deserialize and validate a record.
+         * @param data MPU6050_CALIBRATION_SIZE bytes previously produced by pack()
+         * @return True if magic, version and checksum are all valid (the record
+         *         is left unchanged otherwise)
+         */
+        bool unpack(const uint8_t *data) {
+            if (get16(data) != MPU6050_CALIBRATION_MAGIC) return false;
+            if (data[2] != MPU6050_CALIBRATION_VERSION) return false;
+            if (get16(data + 22) != crc16(data, 22)) return false;
+            deviceID = data[3];
+            serial = get16(data + 4) | ((uint32_t)get16(data + 6) << 16);
+            temperature = get16(data + 8);
+            for (uint8_t i = 0; i < 6; i++) offsets[i] = get16(data + 10 + i * 2);
+            return true;
+        }
+
+        /** Check whether the record applies to a device and temperature.
+         * @param id WHO_AM_I device ID of the target
+         * @param sn Serial the record must have been saved with
+         * @param temp Current raw TEMP_OUT value
+         * @param window Largest accepted raw temperature difference
+         * @return True if the record may be applied
+         */
+        bool matches(uint8_t id, uint32_t sn, int16_t temp, int16_t window=MPU6050_CALIBRATION_TEMP_WINDOW) const {
+            int32_t delta = (int32_t)temp - temperature;
+            return id == deviceID && sn == serial && delta <= window && delta >= -window;
+        }
+
+        /** Pack the record and hand it to a storage hook.
+         * @param hook Platform save function (see below for built-in ones)
+         * @param context Hook-specific location (EEPROM address, NVS key, file path)
+         * @return True if the hook reported success
+         */
+        bool save(MPU6050_CalibrationSaveHook hook, void *context) const {
+            uint8_t data[MPU6050_CALIBRATION_SIZE];
+            pack(data);
+            return hook(data, MPU6050_CALIBRATION_SIZE, context);
+        }
+
+        /** Fetch a record through a storage hook and validate it.
+         * @param hook Platform load function
+         * @param context Hook-specific location
+         * @return True if a valid record was loaded
+         */
+        bool load(MPU6050_CalibrationLoadHook hook, void *context) {
+            uint8_t data[MPU6050_CALIBRATION_SIZE];
+            if (!hook(data, MPU6050_CALIBRATION_SIZE, context)) return false;
+            return unpack(data);
+        }
+
+        /** CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), bitwise to stay small.
+         * @param data Bytes to check
+         * @param length Number of bytes
+         * @return CRC value
+         */
+        static uint16_t crc16(const uint8_t *data, uint8_t length) {
+            uint16_t crc = 0xFFFF;
+            while (length--) {
+                crc ^= (uint16_t)*data++ << 8;
+                for (uint8_t b = 0; b < 8; b++) crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+            }
+            return crc;
+        }
+
+    private:
+        static void put16(uint8_t *p, uint16_t v) {
+            p[0] = v;
+            p[1] = v >> 8;
+        }
+        static uint16_t get16(const uint8_t *p) {
+            return p[0] | ((uint16_t)p[1] << 8);
+        }
+};
+
+#if defined(__AVR__)
+#include <avr/eeprom.h>
+
+// AVR EEPROM hooks; context is the EEPROM byte address cast to a pointer,
+// e.g. (void *)0. Unchanged bytes are not rewritten, sparing write cycles.
+inline bool mpu6050CalibrationSaveEEPROM(const uint8_t *data, uint8_t length, void *context) {
+    eeprom_update_block(data, (void *)context, length);
+    return true;
+}
+inline bool mpu6050CalibrationLoadEEPROM(uint8_t *data, uint8_t length, void *context) {
+    eeprom_read_block(data, (const void *)context, length);
+    return true;
+}
+#endif
+
+#if defined(ESP_PLATFORM)
+#include "nvs.h"
+
+// ESP32 NVS hooks; context is the blob key (const char *, at most 15
+// characters) in the "i2cdevlib" namespace. nvs_flash_init() must have been
+// called by the application.
+inline bool mpu6050CalibrationSaveNVS(const uint8_t *data, uint8_t length, void *context) {
+    nvs_handle_t handle;
+    if (nvs_open("i2cdevlib", NVS_READWRITE, &handle) != ESP_OK) return false;
+    bool ok = nvs_set_blob(handle, (const char *)context, data, length) == ESP_OK && nvs_commit(handle) == ESP_OK;
+    nvs_close(handle);
+    return ok;
+}
+inline bool mpu6050CalibrationLoadNVS(uint8_t *data, uint8_t length, void *context) {
+    nvs_handle_t handle;
+    if (nvs_open("i2cdevlib", NVS_READONLY, &handle) != ESP_OK) return false;
+    size_t size = length;
+    bool ok = nvs_get_blob(handle, (const char *)context, data, &size) == ESP_OK && size == length;
+    nvs_close(handle);
+    return ok;
+}
+#endif
+
+#if defined(__linux__)
+#include <stdio.h>
+#include <string.h>
+
+// Linux file hooks; context is the file path (const char *). The record is
+// written to "<path>.tmp" and renamed over the old one, so a crash mid-write
+// never leaves a truncated record behind.
+inline bool mpu6050CalibrationSaveFile(const uint8_t *data, uint8_t length, void *context) {
+    const char *path = (const char *)context;
+    char tmp[256];
+    if (strlen(path) + 5 > sizeof(tmp)) return false;
+    strcpy(tmp, path);
+    strcat(tmp, ".tmp");
+    FILE *f = fopen(tmp, "wb");
+    if (!f) return false;
+    bool ok = fwrite(data, 1, length, f) == length;
+    ok = fclose(f) == 0 && ok;
+    return ok && rename(tmp, path) == 0;
+}
+inline bool mpu6050CalibrationLoadFile(uint8_t *data, uint8_t length, void *context) {
+    FILE *f = fopen((const char *)context, "rb");
+    if (!f) return false;
+    bool ok = fread(data, 1, length, f) == length;
+    fclose(f);
+    return ok;
+}
+#endif
+
+#endif /* _HELPER_CALIBRATION_H_ */
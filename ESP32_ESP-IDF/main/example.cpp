@@ -34,6 +34,7 @@ void task_initI2C(void *ignore) {
 	conf.master.clk_speed = 400000;
 	ESP_ERROR_CHECK(i2c_param_config(I2C_NUM_0, &conf));
 	ESP_ERROR_CHECK(i2c_driver_install(I2C_NUM_0, I2C_MODE_MASTER, 0, 0, 0));
+	I2Cdev::setBus(I2C_NUM_0, &conf); // lets I2Cdev recover a stuck bus
 	vTaskDelete(NULL);
 }
 
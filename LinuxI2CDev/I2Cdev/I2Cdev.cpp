@@ -3,6 +3,8 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - detect adapter I2C_FUNCS, route transfers via I2C_RDWR or SMBus block/word/byte
+//      2026-10-19 - add readBytesLong()/writeBytesLong(), up to 32767 bytes
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -54,17 +56,221 @@ THE SOFTWARE.
 #include <string.h>
 #include <stdio.h>
 #include <sys/ioctl.h>
+#include <linux/i2c.h>
 #include <linux/i2c-dev.h>
 
 static const char* i2cDev = NULL;
+static unsigned long i2cFuncs = 0;
+
 /** Default constructor.
  */
 I2Cdev::I2Cdev() {
 }
 
+/** Select the bus and query what its adapter can do.
+ * Full I2C adapters get combined I2C_RDWR transfers; SMBus-only adapters get
+ * SMBus I2C-block, word or byte transfers. If the query fails, plain
+ * write()/read() is used as before.
+ * @param devPath i2c-dev node, e.g. "/dev/i2c-1"
+ */
 void I2Cdev::initialize(const char* devPath) {
 	i2cDev = devPath;
+	i2cFuncs = 0;
+	int fd = open(i2cDev, O_RDWR);
+	if (fd < 0) {
+		fprintf(stderr, "Failed to open i2c device %s: %s\n", i2cDev, strerror(errno));
+		return;
+	}
+	if (ioctl(fd, I2C_FUNCS, &i2cFuncs) < 0) {
+		fprintf(stderr, "Failed to query i2c functionality: %s\n", strerror(errno));
+		i2cFuncs = 0;
+	}
+	close(fd);
+}
+
+/** Get the adapter functionality mask found by initialize().
+ * @return I2C_FUNC_* bits from <linux/i2c.h> (0 if unknown)
+ */
+unsigned long I2Cdev::getFunctionality() {
+	return i2cFuncs;
+}
+
+/** Open the bus for one transaction. I2C_RDWR addresses every message
+ * itself, so the I2C_SLAVE binding (which fails with EBUSY on addresses a
+ * kernel driver has claimed) is only needed for read()/write() and SMBus.
+ */
+static int openBus(uint8_t devAddr, uint16_t timeout) {
+    int fd = open(i2cDev, O_RDWR);
+    if (fd < 0) {
+        fprintf(stderr, "Failed to open i2c device %s: %s\n", i2cDev, strerror(errno));
+        return -1;
+    }
+    if (!(i2cFuncs & I2C_FUNC_I2C) && ioctl(fd, I2C_SLAVE, (unsigned long) devAddr) < 0) {
+        fprintf(stderr, "Failed to set i2c address to %u: %s\n", devAddr, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    if (timeout != 0 && ioctl(fd, I2C_TIMEOUT, (unsigned long) timeout / 100) < 0) {
+        fprintf(stderr, "Failed to set i2c timeout: %s\n", strerror(errno));
+    }
+    return fd;
+}
+
+static bool smbusAccess(int fd, uint8_t readWrite, uint8_t command, uint32_t size, union i2c_smbus_data *data) {
+    struct i2c_smbus_ioctl_data args;
+    args.read_write = readWrite;
+    args.command = command;
+    args.size = size;
+    args.data = data;
+    return ioctl(fd, I2C_SMBUS, &args) >= 0;
+}
+
+/** Read one chunk using the fastest transfer the adapter supports.
+ * @return Number of bytes read (may be less than length), -1 on failure
+ */
+static int16_t readChunk(int fd, uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+    union i2c_smbus_data smbus;
+    if (i2cFuncs & I2C_FUNC_I2C) {
+        // register write and data read as one repeated-start transaction
+        if (length > I2CDEV_RDWR_MAX_LENGTH) length = I2CDEV_RDWR_MAX_LENGTH;
+        struct i2c_msg msgs[2];
+        msgs[0].addr = devAddr;
+        msgs[0].flags = 0;
+        msgs[0].len = 1;
+        msgs[0].buf = &regAddr;
+        msgs[1].addr = devAddr;
+        msgs[1].flags = I2C_M_RD;
+        msgs[1].len = length;
+        msgs[1].buf = data;
+        struct i2c_rdwr_ioctl_data xfer;
+        xfer.msgs = msgs;
+        xfer.nmsgs = 2;
+        if (ioctl(fd, I2C_RDWR, &xfer) != 2) return -1;
+        return length;
+    } else if (i2cFuncs & I2C_FUNC_SMBUS_READ_I2C_BLOCK) {
+        if (length > I2C_SMBUS_BLOCK_MAX) length = I2C_SMBUS_BLOCK_MAX;
+        smbus.block[0] = length;
+        if (!smbusAccess(fd, I2C_SMBUS_READ, regAddr, I2C_SMBUS_I2C_BLOCK_DATA, &smbus)) return -1;
+        if (smbus.block[0] < length) length = smbus.block[0];
+        memcpy(data, &smbus.block[1], length);
+        return length;
+    } else if (length >= 2 && (i2cFuncs & I2C_FUNC_SMBUS_READ_WORD_DATA)) {
+        // SMBus words go low byte first, i.e. in register order; longer
+        // reads are split by the caller into word (and byte) chunks
+        if (!smbusAccess(fd, I2C_SMBUS_READ, regAddr, I2C_SMBUS_WORD_DATA, &smbus)) return -1;
+        data[0] = smbus.word & 0xFF;
+        data[1] = smbus.word >> 8;
+        return 2;
+    } else if (length >= 1 && (i2cFuncs & I2C_FUNC_SMBUS_READ_BYTE_DATA)) {
+        if (!smbusAccess(fd, I2C_SMBUS_READ, regAddr, I2C_SMBUS_BYTE_DATA, &smbus)) return -1;
+        data[0] = smbus.byte;
+        return 1;
+    } else if (i2cFuncs == 0) {
+        // functionality unknown, plain write()/read()
+        if (write(fd, &regAddr, 1) != 1) return -1;
+        if (read(fd, data, length) != (ssize_t)length) return -1;
+        return length;
+    }
+    fprintf(stderr, "i2c adapter cannot read %u bytes (functionality 0x%08lx)\n", length, i2cFuncs);
+    errno = EOPNOTSUPP;
+    return -1;
+}
+
+/** Write one chunk using the fastest transfer the adapter supports.
+ * @return Number of bytes written (may be less than length), -1 on failure
+ */
+static int16_t writeChunk(int fd, uint8_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data) {
+    union i2c_smbus_data smbus;
+    if ((i2cFuncs & I2C_FUNC_I2C) || i2cFuncs == 0) {
+        if (length > I2CDEV_RDWR_MAX_LENGTH - 1) length = I2CDEV_RDWR_MAX_LENGTH - 1;
+        uint8_t buff[length + 1];
+        buff[0] = regAddr;
+        memcpy(&buff[1], data, length);
+        if (i2cFuncs == 0) {
+            if (write(fd, buff, length + 1) != (ssize_t)(length + 1)) return -1;
+            return length;
+        }
+        struct i2c_msg msg;
+        msg.addr = devAddr;
+        msg.flags = 0;
+        msg.len = length + 1;
+        msg.buf = buff;
+        struct i2c_rdwr_ioctl_data xfer;
+        xfer.msgs = &msg;
+        xfer.nmsgs = 1;
+        if (ioctl(fd, I2C_RDWR, &xfer) != 1) return -1;
+        return length;
+    } else if (length > 0 && (i2cFuncs & I2C_FUNC_SMBUS_WRITE_I2C_BLOCK)) {
+        if (length > I2C_SMBUS_BLOCK_MAX) length = I2C_SMBUS_BLOCK_MAX;
+        smbus.block[0] = length;
+        memcpy(&smbus.block[1], data, length);
+        if (!smbusAccess(fd, I2C_SMBUS_WRITE, regAddr, I2C_SMBUS_I2C_BLOCK_DATA, &smbus)) return -1;
+        return length;
+    } else if (length >= 2 && (i2cFuncs & I2C_FUNC_SMBUS_WRITE_WORD_DATA)) {
+        smbus.word = data[0] | (data[1] << 8);
+        if (!smbusAccess(fd, I2C_SMBUS_WRITE, regAddr, I2C_SMBUS_WORD_DATA, &smbus)) return -1;
+        return 2;
+    } else if (length >= 1 && (i2cFuncs & I2C_FUNC_SMBUS_WRITE_BYTE_DATA)) {
+        smbus.byte = data[0];
+        if (!smbusAccess(fd, I2C_SMBUS_WRITE, regAddr, I2C_SMBUS_BYTE_DATA, &smbus)) return -1;
+        return 1;
+    } else if (length == 0 && (i2cFuncs & I2C_FUNC_SMBUS_WRITE_BYTE)) {
+        // register pointer only
+        if (!smbusAccess(fd, I2C_SMBUS_WRITE, regAddr, I2C_SMBUS_BYTE, NULL)) return -1;
+        return 0;
+    }
+    fprintf(stderr, "i2c adapter cannot write %u bytes (functionality 0x%08lx)\n", length, i2cFuncs);
+    errno = EOPNOTSUPP;
+    return -1;
+}
+
+/** Read length bytes in as many chunks as the adapter needs.
+ * Each chunk is a separate transaction that starts again at a register
+ * address: regAddr itself for FIFO data ports, otherwise the register after
+ * the last one transferred, so a block of registers split on an SMBus-only
+ * adapter still reads the right ones.
+ * @return Number of bytes read, -1 on failure
+ */
+static int16_t readRegisters(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout, bool fifo) {
+    int fd = openBus(devAddr, timeout);
+    if (fd < 0) return -1;
+    uint16_t count = 0;
+    while (count < length) {
+        uint8_t reg = fifo ? regAddr : regAddr + count;
+        int16_t chunk = readChunk(fd, devAddr, reg, length - count, data + count);
+        if (chunk <= 0) {
+            fprintf(stderr, "Failed to read reg: %s\n", strerror(errno));
+            close(fd);
+            return -1;
+        }
+        count += chunk;
+    }
+    close(fd);
+    return length;
+}
+
+/** Write length bytes in as many chunks as the adapter needs.
+ * @see readRegisters()
+ * @return True on success
+ */
+static bool writeRegisters(uint8_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data, bool fifo) {
+    int fd = openBus(devAddr, 0);
+    if (fd < 0) return false;
+    uint16_t count = 0;
+    do {
+        uint8_t reg = fifo ? regAddr : regAddr + count;
+        int16_t chunk = writeChunk(fd, devAddr, reg, length - count, data + count);
+        if (chunk < 0 || (chunk == 0 && count < length)) {
+            fprintf(stderr, "Failed to write reg: %s\n", strerror(errno));
+            close(fd);
+            return false;
+        }
+        count += chunk;
+    } while (count < length);
+    close(fd);
+    return true;
 }
+
 /** Read a single bit from an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
@@ -169,6 +375,8 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16
 }
 
 /** Read multiple bytes from an 8-bit device register.
+ * On SMBus-only adapters reads longer than I2C_SMBUS_BLOCK_MAX are split,
+ * each chunk starting at the register where the previous one stopped.
  * @param devAddr I2C slave device address
  * @param regAddr First register regAddr to read from
  * @param length Number of bytes to read
@@ -177,29 +385,28 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16
  * @return Number of bytes read (-1 indicates failure)
  */
 int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
-    int fd = open(i2cDev, O_RDWR);
-    if (fd < 0) {
-        fprintf(stderr, "Failed to open i2c device %s: %s\n", i2cDev, strerror(errno));
-        return -1;
-    }
-    if (ioctl(fd, I2C_SLAVE, (unsigned long) devAddr) < 0) {
-        fprintf(stderr, "Failed to set i2c address to %u: %s\n", devAddr, strerror(errno));
-        close(fd);
-        return -1;
-    }
-    if (timeout != 0 && ioctl(fd, I2C_TIMEOUT, (unsigned long) timeout / 100) < 0) {
-        fprintf(stderr, "Failed to set i2c timeout: %s\n", strerror(errno));
-    }
-    if (write(fd, &regAddr, 1) != 1) {
-        fprintf(stderr, "Failed to write reg: %s\n", strerror(errno));
-    }
-    if (read(fd, data, length) != length) {
-        fprintf(stderr, "Failed to read reg: %s\n", strerror(errno));
-        close(fd);
+    return readRegisters(devAddr, regAddr, length, data, timeout, false);
+}
+
+/** Read up to I2CDEV_LONG_MAX_LENGTH (32767) bytes from an 8-bit device register.
+ * Full I2C adapters fetch up to I2CDEV_RDWR_MAX_LENGTH bytes per combined
+ * transaction (a full 1 KB MPU6050 FIFO drain in one go); SMBus-only
+ * adapters are limited to I2C_SMBUS_BLOCK_MAX. Longer reads are split into
+ * chunks that each re-address the same register, which suits FIFO data
+ * ports (e.g. MPU6050 FIFO_R_W); use readBytes() for register blocks.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure or a length over the limit)
+ */
+int16_t I2Cdev::readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout) {
+    if (length > I2CDEV_LONG_MAX_LENGTH) {
+        errno = EINVAL;
         return -1;
     }
-    close(fd);
-    return length;
+    return readRegisters(devAddr, regAddr, length, data, timeout, true);
 }
 
 /** Read multiple words from a 16-bit device register.
@@ -211,9 +418,11 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
  * @return Number of words read (-1 indicates failure)
  */
 int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
-    uint8_t buff[length * 2];
+    // read straight into the caller's buffer and convert in place: word i
+    // only overlaps the two bytes it is decoded from
+    uint8_t *buff = (uint8_t *)data;
 
-    if (readBytes(devAddr, regAddr, length * 2, buff, timeout) > 0)
+    if (readRegisters(devAddr, regAddr, length * 2, buff, timeout, false) > 0)
     {
         for (int i = 0; i < length; i++)
         {
@@ -332,6 +541,7 @@ bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
 }
 
 /** Write multiple bytes to an 8-bit device register.
+ * Split like readBytes(), each chunk starting at its own register.
  * @param devAddr I2C slave device address
  * @param regAddr First register address to write to
  * @param length Number of bytes to write
@@ -339,30 +549,24 @@ bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
-    int fd = open(i2cDev, O_RDWR);
-    if (fd < 0) {
-        fprintf(stderr, "Failed to open i2c device %s: %s\n", i2cDev, strerror(errno));
-        return -1;
-    }
-    if (ioctl(fd, I2C_SLAVE, (unsigned long) devAddr) < 0) {
-        fprintf(stderr, "Failed to set i2c address to %u: %s\n", devAddr, strerror(errno));
-        close(fd);
-        return -1;
-    }
-    uint16_t buff_length = length + 1;
-    uint8_t buff[buff_length];
-    buff[0] = regAddr;
-
-    memcpy(&buff[1], data, length);
+    return writeRegisters(devAddr, regAddr, length, data, false);
+}
 
-    if (write(fd, buff, buff_length) != buff_length)
-    {
-        fprintf(stderr, "Failed to write reg: %s\n", strerror(errno));
-        close(fd);
+/** Write up to I2CDEV_LONG_MAX_LENGTH (32767) bytes to an 8-bit device register.
+ * Chunked like readBytesLong(); every chunk re-addresses the same register.
+ * Use writeBytes() for register blocks.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t* data) {
+    if (length > I2CDEV_LONG_MAX_LENGTH) {
+        errno = EINVAL;
         return false;
     }
-    close(fd);
-    return true;
+    return writeRegisters(devAddr, regAddr, length, data, true);
 }
 
 /** Write multiple words to a 16-bit device register.
@@ -381,7 +585,7 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
         buff[1 + 2 * i] = (uint8_t)(data[i] >> 0); //LSByte
     }
 
-    return writeBytes(devAddr, regAddr, length * 2, buff);
+    return writeRegisters(devAddr, regAddr, length * 2, buff, false);
 }
 
 /** Default timeout value for read operations.
@@ -3,6 +3,8 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-19 - detect adapter I2C_FUNCS, route transfers via I2C_RDWR or SMBus block/word/byte
+//      2026-10-19 - add readBytesLong()/writeBytesLong(), up to 32767 bytes
 //      2021-09-28 - allow custom Wire object as transaction function argument
 //      2020-01-20 - hardija : complete support for Teensy 3.x
 //      2015-10-30 - simondlevy : support i2c_t3 for Teensy3.1
@@ -71,11 +73,22 @@ THE SOFTWARE.
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     1000
 
+// longest single I2C_RDWR message; 8192 is the i2c-dev limit, lower it for
+// adapters with a smaller transfer quirk (longer transfers are chunked)
+#ifndef I2CDEV_RDWR_MAX_LENGTH
+#define I2CDEV_RDWR_MAX_LENGTH          8192
+#endif
+
+// longest readBytesLong()/writeBytesLong() transfer; the byte count comes
+// back as int16_t, so anything longer is rejected
+#define I2CDEV_LONG_MAX_LENGTH          32767
+
 class I2Cdev {
     public:
         I2Cdev();
 
         static void initialize(const char* i2cDev);
+        static unsigned long getFunctionality();
         static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
         static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
         static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
@@ -84,6 +97,7 @@ class I2Cdev {
         static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
         static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
         static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout=I2Cdev::readTimeout);
+        static int16_t readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint16_t timeout=I2Cdev::readTimeout);
 
         static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
         static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
@@ -93,6 +107,7 @@ class I2Cdev {
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static bool writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
 
         static uint16_t readTimeout;
 };
@@ -0,0 +1,212 @@
+// I2Cdev library collection - data-ready interrupt sources for Linux
+// Wait on a sensor INT/DRDY line through the GPIO character device
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_INTERRUPT_H_
+#define _HELPER_INTERRUPT_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+// One data-ready edge as reported by an I2CdevInterruptSource
+struct I2CdevInterruptEvent {
+    uint64_t timestamp;     // time of the edge in nanoseconds (CLOCK_MONOTONIC for GPIO lines)
+    uint32_t sequence;      // edge number on this line, starting at 1
+    uint32_t missed;        // earlier edges merged into this one or dropped on overrun
+};
+
+/** Something that signals "new data" with a timestamped edge.
+ * wait() sleeps in poll() until an edge arrives, so sampling costs no CPU
+ * between samples and wakes as soon as the sensor asserts its line. If the
+ * reader falls behind, queued edges are merged and only the newest one is
+ * returned, with the rest counted in missed. getFd() allows the source to be
+ * added to an existing poll()/epoll() loop instead.
+ */
+class I2CdevInterruptSource {
+    public:
+        I2CdevInterruptSource() {
+            fd = -1;
+            lastSequence = 0;
+        }
+
+        virtual ~I2CdevInterruptSource() {}
+
+        /** Wait for the next edge.
+         * @param event Filled in with the newest edge
+         * @param timeout Milliseconds to wait (-1 waits forever, 0 only checks)
+         * @return 1 = edge received, 0 = timeout, -1 = error (see errno)
+         */
+        int8_t wait(I2CdevInterruptEvent *event, int32_t timeout=-1) {
+            if (fd < 0) {
+                errno = EBADF;
+                return -1;
+            }
+            struct pollfd p;
+            p.fd = fd;
+            p.events = POLLIN;
+            p.revents = 0;
+            int ret;
+            do {
+                ret = poll(&p, 1, timeout);
+            } while (ret < 0 && errno == EINTR);
+            if (ret <= 0) return ret;
+            if (!readEvent(event)) return -1;
+            while (poll(&p, 1, 0) > 0 && readEvent(event));
+            event->missed = event->sequence - lastSequence - 1;
+            lastSequence = event->sequence;
+            return 1;
+        }
+
+        /** Get the descriptor that becomes readable when an edge is pending.
+         * @return File descriptor, or -1 if the source is not open
+         */
+        int getFd() {
+            return fd;
+        }
+
+    protected:
+        virtual bool readEvent(I2CdevInterruptEvent *event) = 0;
+
+        int fd;
+        uint32_t lastSequence;
+};
+
+/** Data-ready line on a GPIO controller (GPIO character device uAPI v2,
+ * Linux 5.10+). The kernel timestamps each edge in its interrupt handler,
+ * so timestamps do not include scheduling latency:
+ *
+ * <pre>
+ * I2CdevGpioInterrupt drdy;
+ * drdy.open("/dev/gpiochip0", 17);    // BCM GPIO17 on a Raspberry Pi
+ * I2CdevInterruptEvent ev;
+ * while (drdy.wait(&ev, 100) > 0) { ... }
+ * </pre>
+ */
+class I2CdevGpioInterrupt : public I2CdevInterruptSource {
+    public:
+        ~I2CdevGpioInterrupt() {
+            close();
+        }
+
+        /** Request a line as an edge-detecting input.
+         * @param chipPath GPIO chip device, e.g. "/dev/gpiochip0"
+         * @param line Line offset on that chip
+         * @param activeLow True if the sensor drives the line low when asserting
+         * @return True on success (errno is set on failure)
+         */
+        bool open(const char *chipPath, uint32_t line, bool activeLow=false) {
+            close();
+            int chip = ::open(chipPath, O_RDONLY | O_CLOEXEC);
+            if (chip < 0) return false;
+            struct gpio_v2_line_request req;
+            memset(&req, 0, sizeof(req));
+            req.offsets[0] = line;
+            req.num_lines = 1;
+            strncpy(req.consumer, "i2cdevlib", sizeof(req.consumer) - 1);
+            // with ACTIVE_LOW a "rising" edge is the physical falling edge
+            req.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING;
+            if (activeLow) req.config.flags |= GPIO_V2_LINE_FLAG_ACTIVE_LOW;
+            int ret = ioctl(chip, GPIO_V2_GET_LINE_IOCTL, &req);
+            int err = errno;
+            ::close(chip);
+            if (ret < 0) {
+                errno = err;
+                return false;
+            }
+            fd = req.fd;
+            lastSequence = 0;
+            return true;
+        }
+
+        /** Release the line. */
+        void close() {
+            if (fd >= 0) ::close(fd);
+            fd = -1;
+        }
+
+    protected:
+        bool readEvent(I2CdevInterruptEvent *event) {
+            struct gpio_v2_line_event e;
+            if (read(fd, &e, sizeof(e)) != (ssize_t)sizeof(e)) return false;
+            event->timestamp = e.timestamp_ns;
+            event->sequence = e.line_seqno;
+            return true;
+        }
+};
+
+/** Interrupt source driven by software, for tests and simulated sensors.
+ * trigger() may be called from any thread; the edge is delivered through a
+ * pipe so wait() behaves exactly as it does for a GPIO line.
+ */
+class I2CdevFakeInterrupt : public I2CdevInterruptSource {
+    public:
+        I2CdevFakeInterrupt() {
+            int p[2];
+            writeFd = -1;
+            sequence = 0;
+            if (pipe2(p, O_CLOEXEC) == 0) {
+                fd = p[0];
+                writeFd = p[1];
+            }
+        }
+
+        ~I2CdevFakeInterrupt() {
+            if (fd >= 0) ::close(fd);
+            if (writeFd >= 0) ::close(writeFd);
+        }
+
+        /** Inject an edge.
+         * @param timestamp Edge time in nanoseconds
+         * @return True if the edge was queued
+         */
+        bool trigger(uint64_t timestamp) {
+            I2CdevInterruptEvent e;
+            e.timestamp = timestamp;
+            e.sequence = __sync_add_and_fetch(&sequence, 1);
+            e.missed = 0;
+            return write(writeFd, &e, sizeof(e)) == (ssize_t)sizeof(e);
+        }
+
+    protected:
+        bool readEvent(I2CdevInterruptEvent *event) {
+            return read(fd, event, sizeof(*event)) == (ssize_t)sizeof(*event);
+        }
+
+        int writeFd;
+        uint32_t sequence;
+};
+
+#endif /* _HELPER_INTERRUPT_H_ */
@@ -0,0 +1,311 @@
+// I2Cdev library collection - shared-memory sample ring for Linux
+// One writer (the bus-owning daemon) publishes, any number of processes read
+// Updates should (hopefully) always be available at https://github.com/jrowberg/i2cdevlib
+//
+// Changelog:
+//     2026-10-19 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2012 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _HELPER_SHMRING_H_
+#define _HELPER_SHMRING_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define I2CDEV_SHM_MAGIC            0x44433249 // "I2CD" in little-endian byte order
+#define I2CDEV_SHM_VERSION          1
+#define I2CDEV_SHM_DEFAULT_NAME     "/i2cdevd"
+
+// number of slots, must be a power of two; at 1 kHz total this holds ~1 s
+#ifndef I2CDEV_SHM_SLOTS
+#define I2CDEV_SHM_SLOTS            1024
+#endif
+
+#define I2CDEV_SAMPLE_MPU6050_DMP   1
+#define I2CDEV_SAMPLE_HMC5883L      2
+#define I2CDEV_SAMPLE_BMP085        3
+
+// One published reading. Fixed 64-byte layout so readers built separately
+// from the daemon agree on it; check type before using the union.
+struct I2CdevSample {
+    uint64_t timestamp;             // CLOCK_MONOTONIC nanoseconds (INT edge time when available)
+    uint16_t type;                  // I2CDEV_SAMPLE_*
+    uint8_t devAddr;
+    uint8_t reserved[5];
+    union {
+        struct {
+            float quaternion[4];    // w, x, y, z
+            int16_t accel[3];       // raw DMP accel
+            int16_t gyro[3];        // raw DMP gyro
+        } dmp;
+        struct {
+            int16_t heading[3];     // raw x, y, z
+        } mag;
+        struct {
+            float temperature;      // degrees C
+            int32_t pressure;       // Pa
+        } baro;
+        uint8_t raw[48];
+    } data;
+};
+
+// Seqlock slot: sequence is odd while the writer is inside, and advances by
+// 2 per write, so the n-th sample through a slot leaves it at 2 * n
+struct I2CdevShmSlot {
+    uint32_t sequence;
+    uint32_t reserved;
+    I2CdevSample sample;
+};
+
+struct I2CdevShmRing {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t sampleSize;
+    uint64_t head;                  // samples published so far
+    uint32_t notify;                // futex word, bumped on every publish
+    uint32_t reserved;
+    I2CdevShmSlot slots[I2CDEV_SHM_SLOTS];
+};
+
+/** Publishing side of the ring; exactly one per ring.
+ * publish() never blocks and never looks at readers: a reader that falls
+ * more than I2CDEV_SHM_SLOTS samples behind loses the oldest ones (and is
+ * told so) instead of stalling acquisition.
+ */
+class I2CdevShmWriter {
+    public:
+        I2CdevShmWriter() {
+            ring = NULL;
+        }
+
+        ~I2CdevShmWriter() {
+            close();
+        }
+
+        /** Create (or replace) the shared-memory object and map it.
+         * An existing object of the same name (e.g. left by a writer that
+         * crashed) is unlinked rather than reused: readers still mapping it
+         * keep a consistent, frozen ring instead of seeing it truncated
+         * (SIGBUS) or its head start over, and can tell with isCurrent().
+         * @param name POSIX shm name, e.g. "/i2cdevd" (appears in /dev/shm)
+         * @param mode Permission bits for readers
+         * @return True on success (errno is set on failure)
+         */
+        bool open(const char *name=I2CDEV_SHM_DEFAULT_NAME, mode_t mode=0644) {
+            close();
+            shm_unlink(name);
+            int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, mode);
+            if (fd < 0) return false;
+            fchmod(fd, mode); // not narrowed by umask
+            if (ftruncate(fd, sizeof(I2CdevShmRing)) < 0) {
+                int err = errno;
+                ::close(fd);
+                errno = err;
+                return false;
+            }
+            void *p = mmap(NULL, sizeof(I2CdevShmRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (p == MAP_FAILED) return false;
+            ring = (I2CdevShmRing *)p;
+            ring->version = I2CDEV_SHM_VERSION;
+            ring->slotCount = I2CDEV_SHM_SLOTS;
+            ring->sampleSize = sizeof(I2CdevSample);
+            // magic last: readers treat the ring as valid from here on
+            __atomic_store_n(&ring->magic, I2CDEV_SHM_MAGIC, __ATOMIC_RELEASE);
+            return true;
+        }
+
+        void close() {
+            if (ring) munmap(ring, sizeof(I2CdevShmRing));
+            ring = NULL;
+        }
+
+        /** Copy a sample into the next slot and wake sleeping readers.
+         * @param sample Reading to publish
+         */
+        void publish(const I2CdevSample *sample) {
+            uint64_t head = ring->head;
+            I2CdevShmSlot *slot = &ring->slots[head & (I2CDEV_SHM_SLOTS - 1)];
+            uint32_t sequence = slot->sequence;
+            __atomic_store_n(&slot->sequence, sequence + 1, __ATOMIC_RELAXED);
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+            memcpy(&slot->sample, sample, sizeof(I2CdevSample));
+            __atomic_store_n(&slot->sequence, sequence + 2, __ATOMIC_RELEASE);
+            __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+            __atomic_add_fetch(&ring->notify, 1, __ATOMIC_RELEASE);
+            // readers cannot register themselves in a read-only mapping, so
+            // always wake; with nobody waiting this is a hash-bucket lookup
+            syscall(SYS_futex, &ring->notify, FUTEX_WAKE, INT32_MAX, NULL, NULL, 0);
+        }
+
+    private:
+        I2CdevShmRing *ring;
+};
+
+/** Reading side of the ring; any number per ring, in any process.
+ * Readers only ever load from the mapping (it is mapped read-only), so
+ * they cannot disturb the writer or each other. Each reader keeps its own
+ * position and copies a slot out under the seqlock, retrying nothing: a
+ * slot overwritten mid-copy is counted as dropped and skipped.
+ */
+class I2CdevShmReader {
+    public:
+        I2CdevShmReader() {
+            ring = NULL;
+            next = 0;
+            dropped = 0;
+            device = 0;
+            inode = 0;
+        }
+
+        ~I2CdevShmReader() {
+            close();
+        }
+
+        /** Map a ring created by I2CdevShmWriter.
+         * @param name POSIX shm name used by the writer
+         * @param fromStart True to begin at the oldest retained sample instead of the newest
+         * @return True on success (errno is set on failure, EPROTO for a layout mismatch)
+         */
+        bool open(const char *name=I2CDEV_SHM_DEFAULT_NAME, bool fromStart=false) {
+            close();
+            int fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+            if (fd < 0) return false;
+            struct stat st;
+            if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(I2CdevShmRing)) {
+                ::close(fd);
+                errno = EPROTO;
+                return false;
+            }
+            device = st.st_dev;
+            inode = st.st_ino;
+            void *p = mmap(NULL, sizeof(I2CdevShmRing), PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (p == MAP_FAILED) return false;
+            ring = (I2CdevShmRing *)p;
+            if (__atomic_load_n(&ring->magic, __ATOMIC_ACQUIRE) != I2CDEV_SHM_MAGIC
+                    || ring->version != I2CDEV_SHM_VERSION
+                    || ring->slotCount != I2CDEV_SHM_SLOTS
+                    || ring->sampleSize != sizeof(I2CdevSample)) {
+                close();
+                errno = EPROTO;
+                return false;
+            }
+            uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+            next = (fromStart && head > I2CDEV_SHM_SLOTS) ? head - I2CDEV_SHM_SLOTS : (fromStart ? 0 : head);
+            dropped = 0;
+            return true;
+        }
+
+        void close() {
+            if (ring) munmap((void *)ring, sizeof(I2CdevShmRing));
+            ring = NULL;
+        }
+
+        /** Copy out the next unread sample.
+         * @param sample Filled in on success
+         * @return True if a sample was read, false if the reader is caught up
+         */
+        bool read(I2CdevSample *sample) {
+            for (;;) {
+                uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+                if (next >= head) return false;
+                if (head - next > I2CDEV_SHM_SLOTS) {
+                    // lapped by the writer
+                    dropped += head - next - I2CDEV_SHM_SLOTS;
+                    next = head - I2CDEV_SHM_SLOTS;
+                }
+                const I2CdevShmSlot *slot = &ring->slots[next & (I2CDEV_SHM_SLOTS - 1)];
+                uint32_t expected = (uint32_t)(2 * (next / I2CDEV_SHM_SLOTS + 1));
+                uint32_t before = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+                memcpy(sample, (const void *)&slot->sample, sizeof(I2CdevSample));
+                __atomic_thread_fence(__ATOMIC_ACQUIRE);
+                uint32_t after = __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED);
+                next++;
+                if (before == expected && after == expected) return true;
+                dropped++;
+            }
+        }
+
+        /** Sleep until the writer publishes something new.
+         * @param timeout Milliseconds to wait (-1 waits forever)
+         * @return True if unread samples are available
+         */
+        bool wait(int32_t timeout=-1) {
+            struct timespec ts, *pts = NULL;
+            if (timeout >= 0) {
+                ts.tv_sec = timeout / 1000;
+                ts.tv_nsec = (timeout % 1000) * 1000000L;
+                pts = &ts;
+            }
+            uint32_t notify = __atomic_load_n(&ring->notify, __ATOMIC_ACQUIRE);
+            if (next < __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE)) return true;
+            // returns at once if a publish landed after notify was sampled
+            syscall(SYS_futex, &ring->notify, FUTEX_WAIT, notify, pts, NULL, 0);
+            return next < __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        }
+
+        /** Check whether the mapped ring is still the one published under name.
+         * A restarted writer creates a new object, and the old mapping simply
+         * stops advancing; call this when wait() times out and re-open() if
+         * it returns false.
+         * @param name POSIX shm name used by the writer
+         * @return False if the writer has replaced or removed the ring
+         */
+        bool isCurrent(const char *name=I2CDEV_SHM_DEFAULT_NAME) {
+            int fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+            if (fd < 0) return false;
+            struct stat st;
+            bool same = fstat(fd, &st) == 0 && st.st_dev == device && st.st_ino == inode;
+            ::close(fd);
+            return same;
+        }
+
+        /** Get the number of samples this reader has lost by falling behind.
+         * @return Samples skipped since open()
+         */
+        uint64_t getDropped() {
+            return dropped;
+        }
+
+    private:
+        const I2CdevShmRing *ring;
+        uint64_t next;
+        uint64_t dropped;
+        dev_t device;               // identity of the mapped object, see isCurrent()
+        ino_t inode;
+};
+
+#endif /* _HELPER_SHMRING_H_ */
@@ -0,0 +1,379 @@
+/*
+I2Cdev library collection - Linux acquisition daemon
+Owns one I2C bus, samples MPU6050 (DMP), HMC5883L and BMP085 on their own
+schedules and publishes every reading into a shared-memory ring (see
+helper_shmring.h) that any number of local processes can map and read
+without copying through a socket or pipe.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile (any Linux board with /dev/i2c-N)
+  1. enable i2c and connect your i2c devices
+  2. then from bash
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -o i2cdevd ${PATH_I2CDEVLIB}LinuxI2CDev/I2Cdevd/i2cdevd.cpp \
+         -I ${PATH_I2CDEVLIB}LinuxI2CDev/I2Cdev ${PATH_I2CDEVLIB}LinuxI2CDev/I2Cdev/I2Cdev.cpp \
+         -I ${PATH_I2CDEVLIB}LinuxI2CDev/MPU6050 ${PATH_I2CDEVLIB}LinuxI2CDev/MPU6050/MPU6050.cpp \
+         ${PATH_I2CDEVLIB}LinuxI2CDev/MPU6050/MPU6050_6Axis_MotionApps20.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/HMC5883L ${PATH_I2CDEVLIB}Arduino/HMC5883L/HMC5883L.cpp \
+         -I ${PATH_I2CDEVLIB}Arduino/BMP085 ${PATH_I2CDEVLIB}Arduino/BMP085/BMP085.cpp -l rt -l m
+      $ sudo ./i2cdevd -m -c 75 -b 10 -g /dev/gpiochip0:17 -r 50
+
+Options
+  -d path       I2C bus device (default /dev/i2c-1)
+  -s name       shared-memory ring name (default /i2cdevd, i.e. /dev/shm/i2cdevd)
+  -m            enable MPU6050 DMP output (rate is set by the DMP firmware, 100 Hz by default)
+  -p hz         MPU6050 FIFO polling rate when no -g line is given (default 200)
+  -g chip:line  GPIO line wired to the MPU6050 INT pin; the FIFO is then read on each edge
+  -c hz         enable HMC5883L at this rate (up to 75)
+  -b hz         enable BMP085 at this rate (up to about 30)
+  -r prio       run as SCHED_FIFO at this priority with all memory locked
+
+Readers map the ring with I2CdevShmReader; see i2cdevd_dump.cpp.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <poll.h>
+#include <sched.h>
+#include <getopt.h>
+#include <sys/mman.h>
+#include "I2Cdev.h"
+#include "helper_interrupt.h"
+#include "helper_shmring.h"
+#include "MPU6050_6Axis_MotionApps20.h"
+#include "HMC5883L.h"
+#include "BMP085.h"
+
+// must match the value MPU6050_6Axis_MotionApps20.cpp was built with
+#ifndef MPU6050_DMP_FIFO_RATE_DIVISOR
+#define MPU6050_DMP_FIFO_RATE_DIVISOR 0x01
+#endif
+
+#define NS_PER_SEC                  1000000000ULL
+
+static volatile sig_atomic_t running = 1;
+static I2CdevShmWriter ring;
+
+static void stop(int) {
+    running = 0;
+}
+
+static uint64_t now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+/** Move a periodic deadline forward by one period. Deadlines advance from
+ * the previous deadline rather than from "now", so jitter does not
+ * accumulate; if the loop fell a whole period behind, the missed samples
+ * are skipped instead of being taken back-to-back.
+ */
+static void advance(uint64_t *due, uint64_t period, uint64_t t) {
+    *due += period;
+    if (*due <= t) *due = t + period;
+}
+
+// ============================================================================
+// MPU6050 DMP
+// ============================================================================
+
+static MPU6050 mpu;
+static uint16_t mpuPacketSize;
+static uint64_t mpuPacketPeriod;
+static uint8_t mpuFIFO[1024];
+
+/** Publish whole DMP packets already copied out of the FIFO. The newest
+ * packet gets the given timestamp and older ones are back-dated by the DMP
+ * output period, since they were produced at that fixed rate.
+ */
+static void mpuPublish(uint16_t count, uint64_t timestamp) {
+    uint16_t packets = count / mpuPacketSize;
+    for (uint16_t i = 0; i < packets; i++) {
+        const uint8_t *packet = mpuFIFO + i * mpuPacketSize;
+        I2CdevSample sample;
+        memset(&sample, 0, sizeof(sample));
+        sample.timestamp = timestamp - (uint64_t)(packets - 1 - i) * mpuPacketPeriod;
+        sample.type = I2CDEV_SAMPLE_MPU6050_DMP;
+        sample.devAddr = MPU6050_DEFAULT_ADDRESS;
+        Quaternion q;
+        mpu.dmpGetQuaternion(&q, packet);
+        sample.data.dmp.quaternion[0] = q.w;
+        sample.data.dmp.quaternion[1] = q.x;
+        sample.data.dmp.quaternion[2] = q.y;
+        sample.data.dmp.quaternion[3] = q.z;
+        mpu.dmpGetAccel(sample.data.dmp.accel, packet);
+        mpu.dmpGetGyro(sample.data.dmp.gyro, packet);
+        ring.publish(&sample);
+    }
+}
+
+/** Drain the FIFO without an interrupt line (polled mode). */
+static void mpuPoll(uint64_t t) {
+    if (mpu.getIntStatus() & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) {
+        mpu.resetFIFO();
+        return;
+    }
+    uint16_t count = mpu.getFIFOCount();
+    if (count > sizeof(mpuFIFO)) count = sizeof(mpuFIFO);
+    count -= count % mpuPacketSize;
+    if (count == 0) return;
+    mpu.getFIFOBytes(mpuFIFO, count);
+    mpuPublish(count, t);
+}
+
+static bool mpuSetup() {
+    mpu.initialize();
+    if (!mpu.testConnection()) {
+        fprintf(stderr, "MPU6050 connection test failed\n");
+        return false;
+    }
+    uint8_t status = mpu.dmpInitialize();
+    if (status != 0) {
+        fprintf(stderr, "MPU6050 DMP initialization failed (code %d)\n", status);
+        return false;
+    }
+    mpu.setDMPEnabled(true);
+    mpuPacketSize = mpu.dmpGetFIFOPacketSize();
+    mpuPacketPeriod = NS_PER_SEC * (1 + MPU6050_DMP_FIFO_RATE_DIVISOR) / 200;
+    mpu.resetFIFO();
+    return true;
+}
+
+// ============================================================================
+// HMC5883L
+// ============================================================================
+
+static HMC5883L mag;
+
+static void magSample(uint64_t t) {
+    I2CdevSample sample;
+    memset(&sample, 0, sizeof(sample));
+    sample.timestamp = t;
+    sample.type = I2CDEV_SAMPLE_HMC5883L;
+    sample.devAddr = HMC5883L_DEFAULT_ADDRESS;
+    mag.getHeading(&sample.data.mag.heading[0], &sample.data.mag.heading[1], &sample.data.mag.heading[2]);
+    ring.publish(&sample);
+}
+
+static bool magSetup(uint32_t hz) {
+    if (!mag.testConnection()) {
+        fprintf(stderr, "HMC5883L connection test failed\n");
+        return false;
+    }
+    mag.initialize();
+    // output rate no slower than the sampling rate, so each read is fresh
+    uint8_t rate;
+    if (hz <= 15) rate = HMC5883L_RATE_15;
+    else if (hz <= 30) rate = HMC5883L_RATE_30;
+    else rate = HMC5883L_RATE_75;
+    mag.setDataRate(rate);
+    return true;
+}
+
+// ============================================================================
+// BMP085
+// ============================================================================
+
+static BMP085 baro;
+static uint8_t baroPhase;           // 0 = idle, 1 = temperature running, 2 = pressure running
+static uint64_t baroStart;          // time the current measurement cycle started
+static float baroTemperature;
+
+/** Step the temperature/pressure conversion cycle. Conversions take up to
+ * 30 ms, so instead of sleeping in the driver the cycle returns to the
+ * main loop after starting each conversion and is resumed when it is due.
+ * @return Time of the next step
+ */
+static uint64_t baroStep(uint64_t t, uint64_t period) {
+    switch (baroPhase) {
+        case 0:
+            baroStart = t;
+            baro.setControl(BMP085_MODE_TEMPERATURE);
+            baroPhase = 1;
+            return t + baro.getMeasureDelayMicroseconds() * 1000ULL;
+        case 1:
+            baroTemperature = baro.getTemperatureC();
+            baro.setControl(BMP085_MODE_PRESSURE_3);
+            baroPhase = 2;
+            return t + baro.getMeasureDelayMicroseconds() * 1000ULL;
+        default: {
+            I2CdevSample sample;
+            memset(&sample, 0, sizeof(sample));
+            sample.timestamp = t;
+            sample.type = I2CDEV_SAMPLE_BMP085;
+            sample.devAddr = BMP085_DEFAULT_ADDRESS;
+            sample.data.baro.temperature = baroTemperature;
+            sample.data.baro.pressure = baro.getPressure();
+            ring.publish(&sample);
+            baroPhase = 0;
+            uint64_t due = baroStart;
+            advance(&due, period, t);
+            return due;
+        }
+    }
+}
+
+static bool baroSetup() {
+    if (!baro.testConnection()) {
+        fprintf(stderr, "BMP085 connection test failed\n");
+        return false;
+    }
+    baro.initialize();
+    baroPhase = 0;
+    return true;
+}
+
+// ============================================================================
+// main loop
+// ============================================================================
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-d i2cdev] [-s shmname] [-m] [-p hz] [-g chip:line] [-c hz] [-b hz] [-r prio]\n", name);
+}
+
+int main(int argc, char **argv) {
+    const char *bus = "/dev/i2c-1";
+    const char *shmName = I2CDEV_SHM_DEFAULT_NAME;
+    const char *gpio = NULL;
+    bool mpuEnabled = false;
+    uint32_t mpuHz = 200, magHz = 0, baroHz = 0;
+    int priority = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "d:s:mp:g:c:b:r:")) != -1) {
+        switch (opt) {
+            case 'd': bus = optarg; break;
+            case 's': shmName = optarg; break;
+            case 'm': mpuEnabled = true; break;
+            case 'p': mpuHz = atoi(optarg); break;
+            case 'g': gpio = optarg; break;
+            case 'c': magHz = atoi(optarg); break;
+            case 'b': baroHz = atoi(optarg); break;
+            case 'r': priority = atoi(optarg); break;
+            default: usage(argv[0]); return 1;
+        }
+    }
+    if ((!mpuEnabled && !magHz && !baroHz) || (mpuEnabled && !gpio && !mpuHz)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    I2Cdev::initialize(bus);
+
+    I2CdevGpioInterrupt drdy;
+    if (mpuEnabled && gpio) {
+        char chip[64];
+        const char *colon = strrchr(gpio, ':');
+        if (!colon || colon == gpio || (size_t)(colon - gpio) >= sizeof(chip)) {
+            usage(argv[0]);
+            return 1;
+        }
+        memcpy(chip, gpio, colon - gpio);
+        chip[colon - gpio] = 0;
+        if (!drdy.open(chip, atoi(colon + 1))) {
+            perror("GPIO line request failed");
+            return 1;
+        }
+    }
+    if (mpuEnabled && !mpuSetup()) return 1;
+    if (magHz && !magSetup(magHz)) return 1;
+    if (baroHz && !baroSetup()) return 1;
+
+    if (!ring.open(shmName)) {
+        perror("shared memory ring creation failed");
+        return 1;
+    }
+
+    if (priority > 0) {
+        // lock first so page faults cannot stall the sampling loop later
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0) perror("mlockall failed");
+        struct sched_param sp;
+        memset(&sp, 0, sizeof(sp));
+        sp.sched_priority = priority;
+        if (sched_setscheduler(0, SCHED_FIFO, &sp) < 0) perror("SCHED_FIFO failed");
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = stop;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    uint64_t t = now();
+    uint64_t mpuPeriod = mpuHz ? NS_PER_SEC / mpuHz : 0;
+    uint64_t magPeriod = magHz ? NS_PER_SEC / magHz : 0;
+    uint64_t baroPeriod = baroHz ? NS_PER_SEC / baroHz : 0;
+    bool mpuPolled = mpuEnabled && drdy.getFd() < 0;
+    uint64_t mpuDue = t, magDue = t, baroDue = t;
+
+    printf("i2cdevd sampling %s into %s\n", bus, shmName);
+    fflush(stdout);
+
+    while (running) {
+        t = now();
+        if (mpuPolled && mpuDue <= t) {
+            mpuPoll(t);
+            advance(&mpuDue, mpuPeriod, t);
+        }
+        if (magHz && magDue <= t) {
+            magSample(t);
+            advance(&magDue, magPeriod, t);
+        }
+        if (baroHz && baroDue <= t) {
+            baroDue = baroStep(t, baroPeriod);
+        }
+
+        // sleep until the next deadline or an INT edge, whichever is first
+        uint64_t next = UINT64_MAX;
+        if (mpuPolled && mpuDue < next) next = mpuDue;
+        if (magHz && magDue < next) next = magDue;
+        if (baroHz && baroDue < next) next = baroDue;
+        t = now();
+        struct timespec timeout, *pts = NULL;
+        if (next != UINT64_MAX) {
+            uint64_t wait = next > t ? next - t : 0;
+            timeout.tv_sec = wait / NS_PER_SEC;
+            timeout.tv_nsec = wait % NS_PER_SEC;
+            pts = &timeout;
+        }
+        struct pollfd p;
+        p.fd = drdy.getFd();
+        p.events = POLLIN;
+        p.revents = 0;
+        int ret = ppoll(&p, p.fd >= 0 ? 1 : 0, pts, NULL);
+        if (ret > 0 && (p.revents & POLLIN)) {
+            uint64_t timestamp;
+            int16_t count = mpu.readFIFOOnInterrupt(&drdy, mpuFIFO, sizeof(mpuFIFO), mpuPacketSize, &timestamp, 0);
+            if (count > 0) mpuPublish(count, timestamp);
+        }
+    }
+
+    if (mpuEnabled) mpu.setDMPEnabled(false);
+    ring.close();
+    shm_unlink(shmName);
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+I2Cdev library collection - i2cdevd ring reader example
+Maps the ring published by i2cdevd and prints every sample. Any number of
+these can run at once; none of them touch the I2C bus or slow the daemon.
+
+==============================================
+I2Cdev device library code is placed under the MIT license
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+
+To compile
+      $ PATH_I2CDEVLIB=~/i2cdevlib/
+      $ g++ -O2 -o i2cdevd_dump ${PATH_I2CDEVLIB}LinuxI2CDev/I2Cdevd/i2cdevd_dump.cpp \
+         -I ${PATH_I2CDEVLIB}LinuxI2CDev/I2Cdev -l rt
+      $ ./i2cdevd_dump [shmname]
+*/
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "helper_shmring.h"
+
+int main(int argc, char **argv) {
+    const char *shmName = argc > 1 ? argv[1] : I2CDEV_SHM_DEFAULT_NAME;
+    I2CdevShmReader reader;
+    if (!reader.open(shmName)) {
+        perror("cannot map i2cdevd ring (is i2cdevd running?)");
+        return 1;
+    }
+    uint64_t dropped = 0;
+    I2CdevSample s;
+    while (true) {
+        if (!reader.wait(1000) && !reader.isCurrent(shmName)) {
+            // i2cdevd restarted (or stopped): follow it to its new ring
+            fprintf(stderr, "i2cdevd ring replaced, reopening\n");
+            while (!reader.open(shmName)) sleep(1);
+            dropped = 0;
+            continue;
+        }
+        while (reader.read(&s)) {
+            double t = s.timestamp / 1e9;
+            switch (s.type) {
+                case I2CDEV_SAMPLE_MPU6050_DMP:
+                    printf("%.6f mpu  q %7.4f %7.4f %7.4f %7.4f  a %6d %6d %6d  g %6d %6d %6d\n", t,
+                        s.data.dmp.quaternion[0], s.data.dmp.quaternion[1], s.data.dmp.quaternion[2], s.data.dmp.quaternion[3],
+                        s.data.dmp.accel[0], s.data.dmp.accel[1], s.data.dmp.accel[2],
+                        s.data.dmp.gyro[0], s.data.dmp.gyro[1], s.data.dmp.gyro[2]);
+                    break;
+                case I2CDEV_SAMPLE_HMC5883L:
+                    printf("%.6f mag  %6d %6d %6d\n", t,
+                        s.data.mag.heading[0], s.data.mag.heading[1], s.data.mag.heading[2]);
+                    break;
+                case I2CDEV_SAMPLE_BMP085:
+                    printf("%.6f baro %5.1f C  %" PRId32 " Pa\n", t,
+                        s.data.baro.temperature, s.data.baro.pressure);
+                    break;
+            }
+        }
+        if (reader.getDropped() != dropped) {
+            dropped = reader.getDropped();
+            fprintf(stderr, "fell behind, %" PRIu64 " samples dropped so far\n", dropped);
+        }
+        fflush(stdout);
+    }
+    return 0;
+}
@@ -37,6 +37,7 @@ THE SOFTWARE.
 */
 
 #include "MPU6050.h"
+#include "helper_interrupt.h"
 #include <math.h>
 #include <time.h>
 #include <stdlib.h>
@@ -1794,13 +1795,14 @@ void MPU6050_Base::getMotion9(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 void MPU6050_Base::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx, int16_t* gy, int16_t* gz) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, buffer, I2Cdev::readTimeout);
-    *ax = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *ay = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *az = (((int16_t)buffer[4]) << 8) | buffer[5];
-    *gx = (((int16_t)buffer[8]) << 8) | buffer[9];
-    *gy = (((int16_t)buffer[10]) << 8) | buffer[11];
-    *gz = (((int16_t)buffer[12]) << 8) | buffer[13];
+    uint8_t data[14] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 14, data, I2Cdev::readTimeout);
+    *ax = (((int16_t)data[0]) << 8) | data[1];
+    *ay = (((int16_t)data[2]) << 8) | data[3];
+    *az = (((int16_t)data[4]) << 8) | data[5];
+    *gx = (((int16_t)data[8]) << 8) | data[9];
+    *gy = (((int16_t)data[10]) << 8) | data[11];
+    *gz = (((int16_t)data[12]) << 8) | data[13];
 }
 /** Get 3-axis accelerometer readings.
  * These registers store the most recent accelerometer measurements.
@@ -1839,10 +1841,11 @@ void MPU6050_Base::getMotion6(int16_t* ax, int16_t* ay, int16_t* az, int16_t* gx
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050_Base::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, buffer, I2Cdev::readTimeout);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    uint8_t data[6] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 6, data, I2Cdev::readTimeout);
+    *x = (((int16_t)data[0]) << 8) | data[1];
+    *y = (((int16_t)data[2]) << 8) | data[3];
+    *z = (((int16_t)data[4]) << 8) | data[5];
 }
 /** Get X-axis accelerometer reading.
  * @return X-axis acceleration measurement in 16-bit 2's complement format
@@ -1850,8 +1853,9 @@ void MPU6050_Base::getAcceleration(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_ACCEL_XOUT_H
  */
 int16_t MPU6050_Base::getAccelerationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, buffer, I2Cdev::readTimeout);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_XOUT_H, 2, data, I2Cdev::readTimeout);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Y-axis accelerometer reading.
  * @return Y-axis acceleration measurement in 16-bit 2's complement format
@@ -1859,8 +1863,9 @@ int16_t MPU6050_Base::getAccelerationX() {
  * @see MPU6050_RA_ACCEL_YOUT_H
  */
 int16_t MPU6050_Base::getAccelerationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, buffer, I2Cdev::readTimeout);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_YOUT_H, 2, data, I2Cdev::readTimeout);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Z-axis accelerometer reading.
  * @return Z-axis acceleration measurement in 16-bit 2's complement format
@@ -1868,8 +1873,9 @@ int16_t MPU6050_Base::getAccelerationY() {
  * @see MPU6050_RA_ACCEL_ZOUT_H
  */
 int16_t MPU6050_Base::getAccelerationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, buffer, I2Cdev::readTimeout);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_ACCEL_ZOUT_H, 2, data, I2Cdev::readTimeout);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // TEMP_OUT_* registers
@@ -1879,8 +1885,9 @@ int16_t MPU6050_Base::getAccelerationZ() {
  * @see MPU6050_RA_TEMP_OUT_H
  */
 int16_t MPU6050_Base::getTemperature() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, buffer, I2Cdev::readTimeout);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_TEMP_OUT_H, 2, data, I2Cdev::readTimeout);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // GYRO_*OUT_* registers
@@ -1918,10 +1925,11 @@ int16_t MPU6050_Base::getTemperature() {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 void MPU6050_Base::getRotation(int16_t* x, int16_t* y, int16_t* z) {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, buffer, I2Cdev::readTimeout);
-    *x = (((int16_t)buffer[0]) << 8) | buffer[1];
-    *y = (((int16_t)buffer[2]) << 8) | buffer[3];
-    *z = (((int16_t)buffer[4]) << 8) | buffer[5];
+    uint8_t data[6] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 6, data, I2Cdev::readTimeout);
+    *x = (((int16_t)data[0]) << 8) | data[1];
+    *y = (((int16_t)data[2]) << 8) | data[3];
+    *z = (((int16_t)data[4]) << 8) | data[5];
 }
 /** Get X-axis gyroscope reading.
  * @return X-axis rotation measurement in 16-bit 2's complement format
@@ -1929,8 +1937,9 @@ void MPU6050_Base::getRotation(int16_t* x, int16_t* y, int16_t* z) {
  * @see MPU6050_RA_GYRO_XOUT_H
  */
 int16_t MPU6050_Base::getRotationX() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, buffer, I2Cdev::readTimeout);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_XOUT_H, 2, data, I2Cdev::readTimeout);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Y-axis gyroscope reading.
  * @return Y-axis rotation measurement in 16-bit 2's complement format
@@ -1938,8 +1947,9 @@ int16_t MPU6050_Base::getRotationX() {
  * @see MPU6050_RA_GYRO_YOUT_H
  */
 int16_t MPU6050_Base::getRotationY() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, buffer, I2Cdev::readTimeout);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_YOUT_H, 2, data, I2Cdev::readTimeout);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 /** Get Z-axis gyroscope reading.
  * @return Z-axis rotation measurement in 16-bit 2's complement format
@@ -1947,8 +1957,9 @@ int16_t MPU6050_Base::getRotationY() {
  * @see MPU6050_RA_GYRO_ZOUT_H
  */
 int16_t MPU6050_Base::getRotationZ() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, buffer, I2Cdev::readTimeout);
-    return (((int16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_GYRO_ZOUT_H, 2, data, I2Cdev::readTimeout);
+    return (((int16_t)data[0]) << 8) | data[1];
 }
 
 // EXT_SENS_DATA_* registers
@@ -2709,8 +2720,9 @@ void MPU6050_Base::setStandbyZGyroEnabled(bool enabled) {
  * @return Current FIFO buffer size
  */
 uint16_t MPU6050_Base::getFIFOCount() {
-    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, buffer, I2Cdev::readTimeout);
-    return (((uint16_t)buffer[0]) << 8) | buffer[1];
+    uint8_t data[2] = { 0 };
+    I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_COUNTH, 2, data, I2Cdev::readTimeout);
+    return (((uint16_t)data[0]) << 8) | data[1];
 }
 
 // FIFO_R_W register
@@ -2741,12 +2753,13 @@ uint16_t MPU6050_Base::getFIFOCount() {
  * @return Byte from FIFO buffer
  */
 uint8_t MPU6050_Base::getFIFOByte() {
-    I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, buffer, I2Cdev::readTimeout);
-    return buffer[0];
+    uint8_t data[1] = { 0 };
+    I2Cdev::readByte(devAddr, MPU6050_RA_FIFO_R_W, data, I2Cdev::readTimeout);
+    return data[0];
 }
-void MPU6050_Base::getFIFOBytes(uint8_t *data, uint8_t length) {
+void MPU6050_Base::getFIFOBytes(uint8_t *data, uint16_t length) {
     if(length > 0){
-        I2Cdev::readBytes(devAddr, MPU6050_RA_FIFO_R_W, length, data, I2Cdev::readTimeout);
+        I2Cdev::readBytesLong(devAddr, MPU6050_RA_FIFO_R_W, length, data, I2Cdev::readTimeout);
     } else {
     	*data = 0;
     }
@@ -2768,6 +2781,44 @@ void MPU6050_Base::setFIFOTimeout(uint32_t fifoTimeout) {
 	this->fifoTimeout = fifoTimeout;
 }
 
+/** Sleep until the INT pin fires, then drain the FIFO in one burst.
+ * Replaces polling getIntDataReadyStatus()/getFIFOCount(): the thread sleeps
+ * in poll() and wakes as soon as the sensor asserts INT. Configure INT as a
+ * data-ready source first (setIntDataReadyEnabled(true)); latched or 50us
+ * pulse mode both work with the edge-triggered line. INT_STATUS is read to
+ * release a latched INT, and whole packets only are read so a packet is
+ * never split across calls.
+ * @param source Data-ready line the MPU6050 INT pin is wired to
+ * @param data Buffer for FIFO contents
+ * @param length Size of data in bytes
+ * @param packetSize FIFO packet size (e.g. 12 for accel+gyro)
+ * @param timestamp Optional, set to the interrupt edge time in nanoseconds;
+ *        this is the sample time of the newest packet returned
+ * @param timeout Milliseconds to wait for INT (-1 waits forever)
+ * @return Bytes read, 0 on timeout, -1 on error (FIFO reset if the burst
+ *         itself failed) or FIFO overflow (FIFO reset)
+ */
+int16_t MPU6050_Base::readFIFOOnInterrupt(I2CdevInterruptSource *source, uint8_t *data, uint16_t length, uint8_t packetSize, uint64_t *timestamp, int32_t timeout) {
+    I2CdevInterruptEvent event;
+    int8_t ret = source->wait(&event, timeout);
+    if (ret <= 0) return ret;
+    if (getIntStatus() & (1 << MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) {
+        // oldest data was overwritten mid-packet, start clean
+        resetFIFO();
+        return -1;
+    }
+    uint16_t count = getFIFOCount();
+    if (count > length) count = length;
+    count -= count % packetSize;
+    if (count > 0 && I2Cdev::readBytesLong(devAddr, MPU6050_RA_FIFO_R_W, count, data, I2Cdev::readTimeout) != count) {
+        // part of a packet may already be gone, realign on a clean FIFO
+        resetFIFO();
+        return -1;
+    }
+    if (timestamp) *timestamp = event.timestamp;
+    return count;
+}
+
 /** Replacement for Arduino micros().
  * @return Number of microseconds since process start
  */
@@ -3411,3 +3462,79 @@ void MPU6050_Base::PrintActiveOffsets() {
     fprintf(stderr, "%.5f,\t", (float)offsets[4]);
     fprintf(stderr, "%.5f\n\n", (float)offsets[5]);
 }
+
+/** Read all six offset registers.
+ * Gyro offsets (XG_OFFS_USR*) are read in one burst, as are the accelerometer
+ * offsets on the MPU-6050 (XA_OFFS_*). The MPU-6500 family keeps its
+ * accelerometer offsets at 0x77/0x7A/0x7D with reserved bytes in between, so
+ * those take one 2-byte read each.
+ * @param offsets Container for accel X/Y/Z then gyro X/Y/Z offsets
+ * @see writeOffsets()
+ */
+void MPU6050_Base::readOffsets(int16_t *offsets) {
+    uint8_t data[6] = { 0 };
+    if (getDeviceID() < 0x38) {
+        I2Cdev::readBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data, I2Cdev::readTimeout);
+    } else {
+        for (uint8_t i = 0; i < 3; i++) {
+            I2Cdev::readBytes(devAddr, 0x77 + i * 3, 2, data + i * 2, I2Cdev::readTimeout);
+        }
+    }
+    for (uint8_t i = 0; i < 3; i++) offsets[i] = (((int16_t)data[i * 2]) << 8) | data[i * 2 + 1];
+
+    I2Cdev::readBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data, I2Cdev::readTimeout);
+    for (uint8_t i = 0; i < 3; i++) offsets[i + 3] = (((int16_t)data[i * 2]) << 8) | data[i * 2 + 1];
+}
+/** Write all six offset registers in as few bursts as the part allows.
+ * @param offsets Accel X/Y/Z then gyro X/Y/Z offsets
+ * @see readOffsets()
+ */
+void MPU6050_Base::writeOffsets(const int16_t *offsets) {
+    uint8_t data[6];
+    for (uint8_t i = 0; i < 3; i++) {
+        data[i * 2] = offsets[i] >> 8;
+        data[i * 2 + 1] = offsets[i];
+    }
+    if (getDeviceID() < 0x38) {
+        I2Cdev::writeBytes(devAddr, MPU6050_RA_XA_OFFS_H, 6, data);
+    } else {
+        for (uint8_t i = 0; i < 3; i++) {
+            I2Cdev::writeBytes(devAddr, 0x77 + i * 3, 2, data + i * 2);
+        }
+    }
+
+    for (uint8_t i = 0; i < 3; i++) {
+        data[i * 2] = offsets[i + 3] >> 8;
+        data[i * 2 + 1] = offsets[i + 3];
+    }
+    I2Cdev::writeBytes(devAddr, MPU6050_RA_XG_OFFS_USRH, 6, data);
+}
+/** Capture the current offsets as a calibration record.
+ * Call this after CalibrateAccel() and CalibrateGyro(), then store the
+ * record with MPU6050_CalibrationRecord::save().
+ * @param record Container for the device ID, die temperature and offsets
+ * @param serial Caller-chosen serial to key the record with (0 if unused)
+ * @see applyCalibration()
+ */
+void MPU6050_Base::getCalibration(MPU6050_CalibrationRecord *record, uint32_t serial) {
+    record->deviceID = getDeviceID();
+    record->serial = serial;
+    record->temperature = getTemperature();
+    readOffsets(record->offsets);
+}
+/** Apply a stored calibration record if it belongs to this device.
+ * The record is only used if its device ID and serial match and the die
+ * temperature is within the given window of the one it was captured at, so a
+ * foreign or stale record falls back to recalibration instead of being
+ * applied blindly. All six offsets are written with writeOffsets().
+ * @param record Record previously filled by getCalibration() or loaded from storage
+ * @param serial Serial the record must have been saved with
+ * @param window Largest accepted raw TEMP_OUT difference
+ * @return True if the record matched and was applied
+ * @see getCalibration()
+ */
+bool MPU6050_Base::applyCalibration(const MPU6050_CalibrationRecord *record, uint32_t serial, int16_t window) {
+    if (!record->matches(getDeviceID(), serial, getTemperature(), window)) return false;
+    writeOffsets(record->offsets);
+    return true;
+}
@@ -40,6 +40,9 @@ THE SOFTWARE.
 
 #include "I2Cdev.h"
 #include "helper_3dmath.h"
+#include "helper_calibration.h"
+
+class I2CdevInterruptSource;
 
 #define MPU6050_ADDRESS_AD0_LOW     0x68 // address pin low (GND), default for InvenSense evaluation board
 #define MPU6050_ADDRESS_AD0_HIGH    0x69 // address pin high (VCC)
@@ -704,9 +707,10 @@ class MPU6050_Base {
         uint8_t getFIFOByte();
 		int8_t GetCurrentFIFOPacket(uint8_t *data, uint8_t length);
         void setFIFOByte(uint8_t data);
-        void getFIFOBytes(uint8_t *data, uint8_t length);
+        void getFIFOBytes(uint8_t *data, uint16_t length);
         void setFIFOTimeout(uint32_t fifoTimeout);
         uint32_t getFIFOTimeout();
+        int16_t readFIFOOnInterrupt(I2CdevInterruptSource *source, uint8_t *data, uint16_t length, uint8_t packetSize, uint64_t *timestamp=NULL, int32_t timeout=-1);
 
         // WHO_AM_I register
         uint8_t getDeviceID();
@@ -811,6 +815,11 @@ class MPU6050_Base {
         uint8_t getDMPConfig2();
         void setDMPConfig2(uint8_t config);
 
+        void readOffsets(int16_t *offsets);
+        void writeOffsets(const int16_t *offsets);
+        void getCalibration(MPU6050_CalibrationRecord *record, uint32_t serial=0);
+        bool applyCalibration(const MPU6050_CalibrationRecord *record, uint32_t serial=0, int16_t window=MPU6050_CALIBRATION_TEMP_WINDOW);
+
 		// Calibration Routines
 		void CalibrateGyro(uint8_t Loops = 15); // Fine tune after setting offsets with less Loops.
 		void CalibrateAccel(uint8_t Loops = 15);// Fine tune after setting offsets with less Loops.
@@ -5,6 +5,8 @@
 //
 // Changelog:
 //		2021-09-29 - Initial port release by Gino Ipóliti.
+//		2026-10-19 - DMA transfers with completion callback, selectable instance, 1MHz support
+//		2026-10-19 - readBytesLong()/writeBytesLong() up to 32767 bytes, DMA transfers of up to 1 KB
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -31,12 +33,261 @@ THE SOFTWARE.
 */
 
 #include "I2Cdev.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+#ifdef i2c_default
+static i2c_inst_t *i2cInst = i2c_default;
+#else
+static i2c_inst_t *i2cInst = i2c0;
+#endif
+
+// DMA state; channels stay unclaimed (-1) until initialize() is called, and
+// every transfer then falls back to the blocking SDK functions
+static int txChannel = -1;
+static int rxChannel = -1;
+static uint16_t commands[I2CDEV_DMA_MAX_LENGTH + 1];    // IC_DATA_CMD words: register + one per byte
+static volatile uint8_t transferState = I2CDEV_TRANSFER_IDLE;
+static volatile int16_t transferResult = 0;
+static uint16_t transferLength = 0;
+static bool transferRead = false;
+static I2CdevCallback transferCallback = NULL;
+static void *transferContext = NULL;
+
+/** Finish the current asynchronous transfer and notify the caller. */
+static void finishTransfer(int16_t result) {
+    i2c_get_hw(i2cInst)->intr_mask = 0;
+    transferResult = result;
+    transferState = result < 0 ? I2CDEV_TRANSFER_ERROR : I2CDEV_TRANSFER_DONE;
+    if (transferCallback) transferCallback(result, transferContext);
+    __sev(); // wake a waiter on the other core
+}
+
+/** I2C interrupt: STOP_DET ends a transfer, TX_ABRT (NACK, lost arbitration)
+ * fails it. The controller always issues a STOP after an abort, so both are
+ * handled here.
+ */
+static void i2cIrqHandler() {
+    i2c_hw_t *hw = i2c_get_hw(i2cInst);
+    uint32_t status = hw->intr_stat;
+    if (transferState != I2CDEV_TRANSFER_BUSY) {
+        hw->intr_mask = 0;
+        return;
+    }
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        dma_channel_abort(txChannel);
+        dma_channel_abort(rxChannel);
+        (void)hw->clr_tx_abrt;
+        (void)hw->clr_stop_det;
+        finishTransfer(-1);
+    } else if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+        // the last bytes can still be on their way out of the RX FIFO
+        if (transferRead) dma_channel_wait_for_finish_blocking(rxChannel);
+        finishTransfer(transferLength);
+    }
+}
+
+/** Queue a register read or write on the DMA channels.
+ * The TX channel feeds IC_DATA_CMD with the register address followed by one
+ * command word per byte: data for writes, or read commands (RESTART on the
+ * first, STOP on the last) while the RX channel drains the received bytes.
+ */
+static bool startTransfer(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *rxData, const uint8_t *txData, I2CdevCallback callback, void *context) {
+    if (txChannel < 0 || transferState == I2CDEV_TRANSFER_BUSY) return false;
+    if ((rxData && length == 0) || length > I2CDEV_DMA_MAX_LENGTH) return false;
+
+    uint16_t n = 0;
+    commands[n++] = regAddr;
+    for (uint16_t i = 0; i < length; i++) {
+        uint16_t cmd = rxData ? I2C_IC_DATA_CMD_CMD_BITS : txData[i];
+        if (rxData && i == 0) cmd |= I2C_IC_DATA_CMD_RESTART_BITS;
+        if (i == length - 1) cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+        commands[n++] = cmd;
+    }
+    if (length == 0) commands[0] |= I2C_IC_DATA_CMD_STOP_BITS;
+
+    i2c_hw_t *hw = i2c_get_hw(i2cInst);
+    hw->enable = 0;
+    hw->tar = devAddr;
+    hw->enable = 1;
+    (void)hw->clr_intr;
+
+    transferLength = length;
+    transferRead = rxData != NULL;
+    transferCallback = callback;
+    transferContext = context;
+    transferState = I2CDEV_TRANSFER_BUSY;
+    hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+
+    if (rxData) {
+        dma_channel_config c = dma_channel_get_default_config(rxChannel);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_dreq(&c, i2c_get_dreq(i2cInst, false));
+        dma_channel_configure(rxChannel, &c, rxData, &hw->data_cmd, length, true);
+    }
+    dma_channel_config c = dma_channel_get_default_config(txChannel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2cInst, true));
+    dma_channel_configure(txChannel, &c, &hw->data_cmd, commands, n, true);
+    return true;
+}
+
+/** Wait for an asynchronous transfer to leave the controller.
+ * The blocking functions share the controller with the DMA path, so they
+ * must not touch it while a transfer started by readBytesAsync() or
+ * writeBytesAsync() is still on the bus. The transfer's result is left in
+ * place for its own caller.
+ * @param timeout Timeout in milliseconds (0 to disable)
+ * @return False if the transfer was still busy at the timeout
+ */
+static bool waitIdle(uint32_t timeout) {
+    absolute_time_t deadline = timeout ? make_timeout_time_ms(timeout) : at_the_end_of_time;
+    while (transferState == I2CDEV_TRANSFER_BUSY) {
+        if (best_effort_wfe_or_timeout(deadline)) return false;
+    }
+    return true;
+}
 
 /** Default constructor.
  */
 I2Cdev::I2Cdev() {
 }
 
+/** Set up an I2C controller and enable DMA transfers on it.
+ * Configures the pins, selects the controller for all following transfers
+ * and claims two DMA channels plus the controller's interrupt. Baud rates up
+ * to 1000000 (Fast-mode Plus) are supported; above 400kHz the pads are set
+ * to 12mA drive and fast slew, and the bus needs correspondingly strong
+ * (around 1k) pull-up resistors.
+ * @param i2c Controller to use (i2c0 or i2c1)
+ * @param baudrate Bus clock in Hz
+ * @param sda GPIO used for SDA
+ * @param scl GPIO used for SCL
+ * @return True if DMA channels were available
+ */
+bool I2Cdev::initialize(i2c_inst_t *i2c, uint32_t baudrate, uint sda, uint scl) {
+    setInstance(i2c);
+    i2c_init(i2c, baudrate);
+    gpio_set_function(sda, GPIO_FUNC_I2C);
+    gpio_set_function(scl, GPIO_FUNC_I2C);
+    gpio_pull_up(sda);
+    gpio_pull_up(scl);
+    if (baudrate > 400000) {
+        gpio_set_drive_strength(sda, GPIO_DRIVE_STRENGTH_12MA);
+        gpio_set_drive_strength(scl, GPIO_DRIVE_STRENGTH_12MA);
+        gpio_set_slew_rate(sda, GPIO_SLEW_RATE_FAST);
+        gpio_set_slew_rate(scl, GPIO_SLEW_RATE_FAST);
+    }
+
+    if (txChannel < 0) txChannel = dma_claim_unused_channel(false);
+    if (rxChannel < 0) rxChannel = dma_claim_unused_channel(false);
+    if (txChannel < 0 || rxChannel < 0) {
+        if (txChannel >= 0) dma_channel_unclaim(txChannel);
+        if (rxChannel >= 0) dma_channel_unclaim(rxChannel);
+        txChannel = rxChannel = -1;
+        return false;
+    }
+
+    i2c_hw_t *hw = i2c_get_hw(i2c);
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS | I2C_IC_DMA_CR_RDMAE_BITS;
+    hw->dma_tdlr = 4;   // refill the 16-entry TX FIFO when 4 or fewer remain
+    hw->dma_rdlr = 0;   // drain the RX FIFO as soon as a byte arrives
+    hw->intr_mask = 0;
+    uint irq = I2C0_IRQ + i2c_hw_index(i2c);
+    irq_set_exclusive_handler(irq, i2cIrqHandler);
+    irq_set_enabled(irq, true);
+    return true;
+}
+
+/** Select the I2C controller used for all following transfers.
+ * Only needed when initialize() is not used, e.g. with a bus set up through
+ * i2c_init() directly. Transfers then use the blocking SDK functions.
+ * @param i2c Controller to use (i2c0 or i2c1)
+ */
+void I2Cdev::setInstance(i2c_inst_t *i2c) {
+    i2cInst = i2c;
+}
+
+/** Get the I2C controller in use.
+ * @return i2c0 or i2c1
+ */
+i2c_inst_t *I2Cdev::getInstance() {
+    return i2cInst;
+}
+
+/** Start a DMA read of consecutive registers and return immediately.
+ * The CPU is free while the bytes are clocked in; completion is reported
+ * through the callback (from interrupt context), getTransferState() or
+ * waitTransfer(). data must stay valid until then.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read (up to I2CDEV_DMA_MAX_LENGTH)
+ * @param data Buffer to store read data in
+ * @param callback Optional completion callback
+ * @param context Passed to the callback
+ * @return False if DMA is not set up or another transfer is in progress
+ */
+bool I2Cdev::readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2CdevCallback callback, void *context) {
+    return startTransfer(devAddr, regAddr, length, data, NULL, callback, context);
+}
+
+/** Start a DMA write of consecutive registers and return immediately.
+ * The data is copied before this returns, so the buffer may be reused.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write (up to I2CDEV_DMA_MAX_LENGTH)
+ * @param data Buffer to copy new data from
+ * @param callback Optional completion callback
+ * @param context Passed to the callback
+ * @return False if DMA is not set up or another transfer is in progress
+ */
+bool I2Cdev::writeBytesAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data, I2CdevCallback callback, void *context) {
+    return startTransfer(devAddr, regAddr, length, NULL, data, callback, context);
+}
+
+/** Get the state of the last asynchronous transfer.
+ * @return I2CDEV_TRANSFER_IDLE, _BUSY, _DONE or _ERROR
+ */
+uint8_t I2Cdev::getTransferState() {
+    return transferState;
+}
+
+/** Wait for the current asynchronous transfer to end.
+ * The core sleeps in WFE until an event or the deadline, so a stuck bus
+ * still times out and a waiter on the other core is woken by the SEV from
+ * the completion interrupt. On timeout the transfer is aborted on the bus.
+ * @param timeout Timeout in milliseconds (0 to disable)
+ * @return Bytes transferred, or -1 on abort or timeout
+ */
+int16_t I2Cdev::waitTransfer(uint32_t timeout) {
+    absolute_time_t deadline = timeout ? make_timeout_time_ms(timeout) : at_the_end_of_time;
+    while (transferState == I2CDEV_TRANSFER_BUSY) {
+        if (best_effort_wfe_or_timeout(deadline)) {
+            i2c_hw_t *hw = i2c_get_hw(i2cInst);
+            uint32_t irqs = save_and_disable_interrupts();
+            if (transferState == I2CDEV_TRANSFER_BUSY) {
+                transferCallback = NULL;
+                dma_channel_abort(txChannel);
+                dma_channel_abort(rxChannel);
+                hw->enable |= I2C_IC_ENABLE_ABORT_BITS;
+                finishTransfer(-1);
+            }
+            restore_interrupts(irqs);
+            break;
+        }
+    }
+    if (transferState == I2CDEV_TRANSFER_BUSY) return -1;
+    int16_t result = transferResult;
+    transferState = I2CDEV_TRANSFER_IDLE;
+    return result;
+}
+
 /** Read a single bit from an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to read from
@@ -149,12 +400,39 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint32
  * @return Number of bytes read (-1 indicates failure)
  */
 int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint32_t timeout) {
-    uint8_t count = 0;
+    return readBytesLong(devAddr, regAddr, length, data, timeout);
+}
+
+/** Read up to I2CDEV_LONG_MAX_LENGTH (32767) bytes from an 8-bit device register.
+ * Up to I2CDEV_DMA_MAX_LENGTH bytes go out as a single DMA transfer (a full
+ * MPU6050 FIFO drain); longer reads use the blocking SDK path, so nothing is
+ * ever split. If an asynchronous transfer
+ * is still in progress, this waits for it first (up to timeout) and fails
+ * with -1 rather than driving the controller underneath it.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to store read data in
+ * @param timeout Optional read timeout in milliseconds (0 to disable, leave off to use default class value in I2Cdev::readTimeout)
+ * @return Number of bytes read (-1 indicates failure or a length over the limit)
+ */
+int16_t I2Cdev::readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint32_t timeout) {
+    int count = 0;
 
-    i2c_write_blocking(i2c_default, devAddr, &regAddr, 1, true);
-    count = i2c_read_timeout_us(i2c_default, devAddr, data, length, false, timeout * 1000);
+    if (length > I2CDEV_LONG_MAX_LENGTH) return -1;
 
-    return count;
+    if (!waitIdle(timeout)) return -1;
+
+    // long bursts (FIFO drains) go through DMA so the bytes are moved
+    // without the CPU polling the controller for each one
+    if (length >= I2CDEV_DMA_THRESHOLD && startTransfer(devAddr, regAddr, length, data, NULL, NULL, NULL)) {
+        return waitTransfer(timeout);
+    }
+
+    if (i2c_write_blocking(i2cInst, devAddr, &regAddr, 1, true) != 1) return -1;
+    count = i2c_read_timeout_us(i2cInst, devAddr, data, length, false, timeout * 1000);
+
+    return count < 0 ? -1 : count;
 }
 
 /** Read multiple words from a 16-bit device register.
@@ -166,16 +444,16 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
  * @return Number of words read (-1 indicates failure)
  */
 int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint32_t timeout) {
-    uint8_t count = 0;
-    uint8_t data_buf[length*2];
+    // read straight into the caller's buffer and convert in place: word i
+    // only overlaps the two bytes it is decoded from
+    uint8_t *data_buf = (uint8_t *)data;
 
-    i2c_write_blocking(i2c_default, devAddr, &regAddr, 1, true);
-    count = i2c_read_timeout_us(i2c_default, devAddr, data_buf, length*2, false, timeout * 1000);
+    if (readBytesLong(devAddr, regAddr, length*2, data_buf, timeout) != length*2) return -1;
     for(int i=0; i<length; i++){
         data[i] = (data_buf[i*2] << 8) | data_buf[(i*2)+1];
     }
 
-    return count;
+    return length;
 }
 
 /** write a single bit in an 8-bit device register.
@@ -292,16 +570,38 @@ bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t* data) {
-    uint8_t status = 0;
-    uint8_t data_buf[length + 1];
+    return writeBytesLong(devAddr, regAddr, length, data);
+}
+
+/** Write up to I2CDEV_LONG_MAX_LENGTH (32767) bytes to an 8-bit device register in a single transfer.
+ * If an asynchronous transfer is still in progress, this waits for it first
+ * (up to I2Cdev::readTimeout) and fails rather than driving the controller
+ * underneath it.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t* data) {
+    int status = 0;
+
+    if (length > I2CDEV_LONG_MAX_LENGTH) return false;
+
+    if (!waitIdle(readTimeout)) return false;
 
+    if (length >= I2CDEV_DMA_THRESHOLD && startTransfer(devAddr, regAddr, length, NULL, data, NULL, NULL)) {
+        return waitTransfer() == length;
+    }
+
+    uint8_t data_buf[length + 1];
     data_buf[0] = regAddr;
     for(int i=0; i<length; i++){
         data_buf[i+1] = data[i];
     }
-    status = i2c_write_blocking(i2c_default, devAddr, data_buf, length + 1, false);
+    status = i2c_write_blocking(i2cInst, devAddr, data_buf, length + 1, false);
 
-    return status;
+    return status == length + 1;
 }
 
 /** Write multiple words to a 16-bit device register.
@@ -309,19 +609,22 @@ bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_
  * @param regAddr First register address to write to
  * @param length Number of words to write
  * @param data Buffer to copy new data from
+ * Like writeBytesLong(), this waits for an asynchronous transfer to finish first.
  * @return Status of operation (true = success)
  */
 bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t* data) {
     uint8_t status = 0, j = 1, new_len = (length * 2) + 1;
     uint8_t data_buf[new_len];
 
+    if (!waitIdle(readTimeout)) return false;
+
     data_buf[0] = regAddr;
     for(int i=0; i<length; i++){
         data_buf[j] = data[i] >> 8;
         data_buf[j+1] = data[i];
         j += 2;
     }
-    status = i2c_write_blocking(i2c_default, devAddr, data_buf, new_len, false);
+    status = i2c_write_blocking(i2cInst, devAddr, data_buf, new_len, false);
 
     return status;
 }
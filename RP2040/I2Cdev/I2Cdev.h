@@ -5,6 +5,8 @@
 //
 // Changelog:
 //		2021-09-29 - Initial port release by Gino Ipóliti.
+//		2026-10-19 - DMA transfers with completion callback, selectable instance, 1MHz support
+//		2026-10-19 - readBytesLong()/writeBytesLong() up to 32767 bytes, DMA transfers of up to 1 KB
 
 /* ============================================
 I2Cdev device library code is placed under the MIT license
@@ -43,10 +45,41 @@ THE SOFTWARE.
 // 1000ms default read timeout (modify with "I2Cdev::readTimeout = [ms];")
 #define I2CDEV_DEFAULT_READ_TIMEOUT     ((uint32_t)1000000) // RP2040 I2C functions with timeout use microseconds so we have to multiply by 10^3
 
+// bursts of at least this many bytes go through DMA once initialize() has run
+#define I2CDEV_DMA_THRESHOLD            4
+
+// longest single DMA transfer (one full MPU6050 FIFO); each byte takes a
+// 16-bit command word, so this sets the size of the static command buffer
+#ifndef I2CDEV_DMA_MAX_LENGTH
+#define I2CDEV_DMA_MAX_LENGTH           1024
+#endif
+
+// longest readBytesLong()/writeBytesLong() transfer; the byte count comes
+// back as int16_t, so anything longer is rejected
+#define I2CDEV_LONG_MAX_LENGTH          32767
+
+#define I2CDEV_TRANSFER_IDLE            0
+#define I2CDEV_TRANSFER_BUSY            1
+#define I2CDEV_TRANSFER_DONE            2
+#define I2CDEV_TRANSFER_ERROR           3
+
+// called from the I2C interrupt when an asynchronous transfer ends; result is
+// the number of bytes transferred or -1 if the transfer was aborted
+typedef void (*I2CdevCallback)(int16_t result, void *context);
+
 class I2Cdev {
     public:
         I2Cdev();
 
+        static bool initialize(i2c_inst_t *i2c, uint32_t baudrate, uint sda, uint scl);
+        static void setInstance(i2c_inst_t *i2c);
+        static i2c_inst_t *getInstance();
+
+        static bool readBytesAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, I2CdevCallback callback=NULL, void *context=NULL);
+        static bool writeBytesAsync(uint8_t devAddr, uint8_t regAddr, uint16_t length, const uint8_t *data, I2CdevCallback callback=NULL, void *context=NULL);
+        static uint8_t getTransferState();
+        static int16_t waitTransfer(uint32_t timeout=I2Cdev::readTimeout);
+
         static int8_t readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint32_t timeout=I2Cdev::readTimeout);
         static int8_t readBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t *data, uint32_t timeout=I2Cdev::readTimeout);
         static int8_t readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint32_t timeout=I2Cdev::readTimeout);
@@ -55,6 +88,7 @@ class I2Cdev {
         static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint32_t timeout=I2Cdev::readTimeout);
         static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint32_t timeout=I2Cdev::readTimeout);
         static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint32_t timeout=I2Cdev::readTimeout);
+        static int16_t readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data, uint32_t timeout=I2Cdev::readTimeout);
 
         static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
         static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
@@ -64,6 +98,7 @@ class I2Cdev {
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static bool writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
 
         static uint32_t readTimeout;
 
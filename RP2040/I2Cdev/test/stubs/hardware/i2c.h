@@ -0,0 +1,49 @@
+#pragma once
+#include "pico/stdlib.h"
+
+typedef volatile uint32_t io_rw_32;
+typedef const volatile uint32_t io_ro_32;
+
+typedef struct {
+    io_rw_32 enable;
+    io_rw_32 tar;
+    io_rw_32 data_cmd;
+    io_rw_32 intr_mask;
+    io_ro_32 intr_stat;
+    io_ro_32 clr_intr;
+    io_ro_32 clr_tx_abrt;
+    io_ro_32 clr_stop_det;
+    io_rw_32 dma_cr;
+    io_rw_32 dma_tdlr;
+    io_rw_32 dma_rdlr;
+} i2c_hw_t;
+
+typedef struct {
+    i2c_hw_t *hw;
+    bool restart_on_next;
+} i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst, i2c1_inst;
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+#define i2c_default i2c0
+
+#define I2C0_IRQ                            23
+#define I2C_IC_INTR_STAT_R_TX_ABRT_BITS     0x040u
+#define I2C_IC_INTR_STAT_R_STOP_DET_BITS    0x200u
+#define I2C_IC_INTR_MASK_M_TX_ABRT_BITS     0x040u
+#define I2C_IC_INTR_MASK_M_STOP_DET_BITS    0x200u
+#define I2C_IC_DATA_CMD_CMD_BITS            0x100u
+#define I2C_IC_DATA_CMD_STOP_BITS           0x200u
+#define I2C_IC_DATA_CMD_RESTART_BITS        0x400u
+#define I2C_IC_DMA_CR_TDMAE_BITS            0x2u
+#define I2C_IC_DMA_CR_RDMAE_BITS            0x1u
+#define I2C_IC_ENABLE_ABORT_BITS            0x2u
+
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) { return i2c->hw; }
+static inline uint i2c_hw_index(i2c_inst_t *i2c) { return i2c == i2c1; }
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+int i2c_read_timeout_us(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop, uint timeout_us);
@@ -0,0 +1,8 @@
+#pragma once
+#include <stdint.h>
+
+// __wfi() is left out on purpose: waits must go through
+// best_effort_wfe_or_timeout() so they cannot sleep past their deadline
+uint32_t save_and_disable_interrupts();
+void restore_interrupts(uint32_t status);
+void __sev();
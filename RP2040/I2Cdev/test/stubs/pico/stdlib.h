@@ -0,0 +1,23 @@
+// Host stand-in for the parts of the Pico SDK used by I2Cdev.cpp; see
+// ../test_I2Cdev.cpp for the simulated hardware behind it.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+#define at_the_end_of_time ((absolute_time_t)-1)
+
+absolute_time_t make_timeout_time_ms(uint32_t ms);
+bool time_reached(absolute_time_t t);
+bool best_effort_wfe_or_timeout(absolute_time_t t);
+
+enum gpio_function { GPIO_FUNC_I2C };
+enum gpio_drive_strength { GPIO_DRIVE_STRENGTH_12MA };
+enum gpio_slew_rate { GPIO_SLEW_RATE_FAST };
+
+void gpio_set_function(uint gpio, gpio_function fn);
+void gpio_pull_up(uint gpio);
+void gpio_set_drive_strength(uint gpio, gpio_drive_strength drive);
+void gpio_set_slew_rate(uint gpio, gpio_slew_rate slew);
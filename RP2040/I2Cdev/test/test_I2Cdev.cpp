@@ -0,0 +1,223 @@
+// I2Cdev library collection - RP2040 host test
+// Runs I2Cdev.cpp against a simulated I2C controller, DMA and interrupt so
+// the asynchronous request/completion state machine can be checked without
+// a board. Build and run with "make" in this directory.
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "I2Cdev.h"
+
+// ----------------------------------------------------------------------------
+// simulated hardware
+// ----------------------------------------------------------------------------
+
+enum BusMode { BUS_COMPLETE, BUS_NACK, BUS_HANG };
+
+alignas(4) static uint32_t hwRegs[sizeof(i2c_hw_t) / 4];
+static i2c_hw_t &hw0 = *(i2c_hw_t *)hwRegs;
+i2c_inst_t i2c0_inst = { &hw0, false };
+i2c_inst_t i2c1_inst = { NULL, false };
+
+static BusMode busMode = BUS_COMPLETE;
+static irq_handler_t irqHandler = NULL;
+static int channelsClaimed = 0;
+static const volatile uint16_t *txSource = NULL;
+static uint txCount = 0;
+static volatile uint8_t *rxDest = NULL;
+static uint rxCount = 0;
+static int blockingCalls = 0;
+static uint64_t nowUs = 0;
+
+/** Let the bus finish the queued DMA transfer, as the controller would. */
+static bool runBus() {
+    if (!hw0.intr_mask || busMode == BUS_HANG) return false;
+    if (rxDest) for (uint i = 0; i < rxCount; i++) rxDest[i] = i + 1;
+    uint32_t status = I2C_IC_INTR_STAT_R_STOP_DET_BITS;
+    if (busMode == BUS_NACK) status |= I2C_IC_INTR_STAT_R_TX_ABRT_BITS;
+    hwRegs[offsetof(i2c_hw_t, intr_stat) / 4] = status;
+    irqHandler();
+    return true;
+}
+
+absolute_time_t make_timeout_time_ms(uint32_t ms) { return nowUs + (uint64_t)ms * 1000; }
+bool time_reached(absolute_time_t t) { return nowUs >= t; }
+bool best_effort_wfe_or_timeout(absolute_time_t t) {
+    // a woken core returns early; otherwise it sleeps until the deadline
+    if (!runBus()) {
+        assert(t != at_the_end_of_time && "wait would never return");
+        nowUs = t;
+    }
+    return time_reached(t);
+}
+
+uint32_t save_and_disable_interrupts() { return 0; }
+void restore_interrupts(uint32_t) {}
+void __sev() {}
+
+void irq_set_exclusive_handler(uint, irq_handler_t handler) { irqHandler = handler; }
+void irq_set_enabled(uint, bool) {}
+
+int dma_claim_unused_channel(bool) { return channelsClaimed++; }
+void dma_channel_unclaim(uint) {}
+dma_channel_config dma_channel_get_default_config(uint) { return dma_channel_config(); }
+void channel_config_set_transfer_data_size(dma_channel_config *, dma_channel_transfer_size) {}
+void channel_config_set_read_increment(dma_channel_config *, bool) {}
+void channel_config_set_write_increment(dma_channel_config *, bool) {}
+void channel_config_set_dreq(dma_channel_config *, uint) {}
+void dma_channel_configure(uint channel, const dma_channel_config *, volatile void *write_addr, const volatile void *read_addr, uint transfer_count, bool) {
+    if (channel == 0) {
+        txSource = (const volatile uint16_t *)read_addr;
+        txCount = transfer_count;
+    } else {
+        rxDest = (volatile uint8_t *)write_addr;
+        rxCount = transfer_count;
+    }
+}
+void dma_channel_abort(uint) {}
+void dma_channel_wait_for_finish_blocking(uint) {}
+
+void gpio_set_function(uint, gpio_function) {}
+void gpio_pull_up(uint) {}
+void gpio_set_drive_strength(uint, gpio_drive_strength) {}
+void gpio_set_slew_rate(uint, gpio_slew_rate) {}
+
+uint i2c_init(i2c_inst_t *, uint baudrate) { return baudrate; }
+uint i2c_get_dreq(i2c_inst_t *, bool is_tx) { return is_tx; }
+int i2c_write_blocking(i2c_inst_t *, uint8_t, const uint8_t *, size_t len, bool) {
+    blockingCalls++;
+    return len;
+}
+int i2c_read_timeout_us(i2c_inst_t *, uint8_t, uint8_t *dst, size_t len, bool, uint) {
+    blockingCalls++;
+    memset(dst, 0x5A, len);
+    return len;
+}
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+static int callbackResult = 0;
+static int callbackCalls = 0;
+
+static void onTransfer(int16_t result, void *context) {
+    assert(context == &callbackCalls);
+    callbackResult = result;
+    callbackCalls++;
+}
+
+static void newTransfer(BusMode mode) {
+    busMode = mode;
+    rxDest = NULL;
+    rxCount = txCount = 0;
+    blockingCalls = 0;
+    callbackCalls = 0;
+}
+
+static void testBlockingBeforeInitialize() {
+    uint8_t data[14];
+    newTransfer(BUS_COMPLETE);
+    assert(I2Cdev::readBytes(0x68, 0x3B, 14, data, 100) == 14);
+    assert(blockingCalls == 2 && txCount == 0);
+}
+
+static void testDmaRead() {
+    uint8_t data[14] = { 0 };
+    newTransfer(BUS_COMPLETE);
+    assert(I2Cdev::readBytes(0x68, 0x3B, 14, data, 100) == 14);
+    assert(blockingCalls == 0 && hw0.tar == 0x68);
+    assert(txCount == 15 && txSource[0] == 0x3B);
+    assert(txSource[1] == (I2C_IC_DATA_CMD_CMD_BITS | I2C_IC_DATA_CMD_RESTART_BITS));
+    for (int i = 2; i < 14; i++) assert(txSource[i] == I2C_IC_DATA_CMD_CMD_BITS);
+    assert(txSource[14] == (I2C_IC_DATA_CMD_CMD_BITS | I2C_IC_DATA_CMD_STOP_BITS));
+    assert(data[0] == 1 && data[13] == 14);
+    assert(I2Cdev::getTransferState() == I2CDEV_TRANSFER_IDLE);
+}
+
+static void testDmaWrite() {
+    uint8_t data[5] = { 1, 2, 3, 4, 5 };
+    newTransfer(BUS_COMPLETE);
+    assert(I2Cdev::writeBytes(0x68, 0x13, 5, data));
+    assert(txCount == 6 && txSource[0] == 0x13 && txSource[1] == 1);
+    assert(txSource[5] == (5 | I2C_IC_DATA_CMD_STOP_BITS));
+}
+
+static void testNack() {
+    uint8_t data[14];
+    newTransfer(BUS_NACK);
+    assert(I2Cdev::readBytes(0x68, 0x3B, 14, data, 100) == -1);
+    assert(I2Cdev::getTransferState() == I2CDEV_TRANSFER_IDLE);
+}
+
+static void testAsync() {
+    uint8_t data[8];
+    newTransfer(BUS_COMPLETE);
+    assert(I2Cdev::readBytesAsync(0x68, 0x74, 8, data, onTransfer, &callbackCalls));
+    assert(I2Cdev::getTransferState() == I2CDEV_TRANSFER_BUSY);
+    assert(!I2Cdev::readBytesAsync(0x68, 0x74, 8, data));
+    assert(I2Cdev::waitTransfer(10) == 8);
+    assert(callbackCalls == 1 && callbackResult == 8 && data[7] == 8);
+    assert(I2Cdev::getTransferState() == I2CDEV_TRANSFER_IDLE);
+}
+
+static void testTimeoutOnStuckBus() {
+    uint8_t data[8];
+    newTransfer(BUS_HANG);
+    assert(I2Cdev::readBytesAsync(0x68, 0x74, 8, data, onTransfer, &callbackCalls));
+    uint64_t start = nowUs;
+    assert(I2Cdev::waitTransfer(5) == -1);
+    assert(nowUs - start == 5000);
+    assert(hw0.enable & I2C_IC_ENABLE_ABORT_BITS);
+    assert(callbackCalls == 0);
+    assert(I2Cdev::getTransferState() == I2CDEV_TRANSFER_IDLE);
+    hw0.enable = 0;
+}
+
+static void testBlockingWaitsForAsync() {
+    uint8_t data[8], one;
+    newTransfer(BUS_HANG);
+    assert(I2Cdev::readBytesAsync(0x68, 0x74, 8, data, onTransfer, &callbackCalls));
+    uint64_t start = nowUs;
+    assert(I2Cdev::readBytes(0x68, 0x75, 1, &one, 3) == -1);
+    assert(nowUs - start == 3000);
+    assert(!I2Cdev::writeByte(0x68, 0x6B, 0));
+    assert(blockingCalls == 0);
+
+    // the asynchronous transfer's result is still there for its owner
+    busMode = BUS_COMPLETE;
+    assert(I2Cdev::waitTransfer(10) == 8);
+    assert(callbackCalls == 1);
+    assert(I2Cdev::readBytes(0x68, 0x75, 1, &one, 10) == 1 && blockingCalls == 2);
+}
+
+static void testLong() {
+    static uint8_t big[1500];
+    newTransfer(BUS_COMPLETE);
+    assert(I2Cdev::readBytesLong(0x68, 0x74, 1024, big, 100) == 1024);
+    assert(txCount == 1025 && blockingCalls == 0 && big[1023] == (uint8_t)1024);
+    newTransfer(BUS_COMPLETE);
+    assert(I2Cdev::readBytesLong(0x68, 0x74, 1500, big, 100) == 1500);
+    assert(txCount == 0 && blockingCalls == 2);
+    newTransfer(BUS_COMPLETE);
+    assert(I2Cdev::writeBytesLong(0x68, 0x74, 600, big));
+    assert(txCount == 601 && blockingCalls == 0);
+}
+
+int main() {
+    testBlockingBeforeInitialize();
+    assert(I2Cdev::initialize(i2c0, 1000000, 4, 5));
+    testDmaRead();
+    testDmaWrite();
+    testNack();
+    testAsync();
+    testTimeoutOnStuckBus();
+    testBlockingWaitsForAsync();
+    testLong();
+    puts("RP2040 I2Cdev: all tests passed");
+    return 0;
+}
@@ -74,12 +74,9 @@ void  waitForUsbConnect() {
 
 int main() {
     stdio_init_all();
-    // This example will use I2C0 on the default SDA and SCL (pins 6, 7 on a Pico)
-    i2c_init(i2c_default, 400 * 1000);
-    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
-    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
-    gpio_pull_up(PICO_DEFAULT_I2C_SDA_PIN);
-    gpio_pull_up(PICO_DEFAULT_I2C_SCL_PIN);
+    // This example will use I2C0 on the default SDA and SCL (pins 6, 7 on a Pico);
+    // I2Cdev::initialize() also sets up DMA so FIFO reads don't busy-wait
+    I2Cdev::initialize(i2c_default, 400 * 1000, PICO_DEFAULT_I2C_SDA_PIN, PICO_DEFAULT_I2C_SCL_PIN);
     // Make the I2C pins available to picotool
     
     // setup blink led
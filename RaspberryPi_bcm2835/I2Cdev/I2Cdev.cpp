@@ -49,10 +49,10 @@ void I2Cdev::enable(bool isEnabled) {
   }
 }
 
-char sendBuf[256];
-char recvBuf[256];
-
-
+// Largest writeBytes()/writeWords() transfer: register address plus
+// 255 words. Every call builds its own copy on the stack, so there is no
+// shared scratch buffer between callers.
+#define I2CDEV_BCM2835_WRITE_LENGTH (1 + 2 * 255)
 
 /** Read a single bit from an 8-bit device register.
  * @param devAddr I2C slave device address
@@ -63,9 +63,9 @@ char recvBuf[256];
  */
 int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data) {
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1);
-  *data = recvBuf[1] & (1 << bitNum);
+  char reg = regAddr, b = 0;
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, &b, 1);
+  *data = (uint8_t)b & (1 << bitNum);
   return response == BCM2835_I2C_REASON_OK ;
 }
 
@@ -84,9 +84,9 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
   //    010   masked
   //   -> 010 shifted
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1);
-  uint8_t b = (uint8_t) recvBuf[0];
+  char reg = regAddr, raw = 0;
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, &raw, 1);
+  uint8_t b = (uint8_t) raw;
   if (response == BCM2835_I2C_REASON_OK) {
     uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
     b &= mask;
@@ -104,9 +104,8 @@ int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint
  */
 int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1);
-  data[0] = (uint8_t) recvBuf[0];
+  char reg = regAddr;
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, (char *)data, 1);
   return response == BCM2835_I2C_REASON_OK;
 }
 
@@ -119,15 +118,28 @@ int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data) {
  */
 int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, length);
-  int i ;
-  for (i = 0; i < length ; i++) {
-    data[i] = (uint8_t) recvBuf[i];
-  }
+  char reg = regAddr;
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, (char *)data, length);
   return response == BCM2835_I2C_REASON_OK;
 }
 
+/** Read up to I2CDEV_LONG_MAX_LENGTH (32767) bytes from an 8-bit device register.
+ * The BSC controller streams through its FIFO, so the whole length is read
+ * in one repeated-start transfer straight into the caller's buffer.
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to store read data in
+ * @return Number of bytes read (-1 indicates failure or a length over the limit)
+ */
+int16_t I2Cdev::readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data) {
+  if (length > I2CDEV_LONG_MAX_LENGTH) return -1;
+  bcm2835_i2c_setSlaveAddress(devAddr);
+  char reg = regAddr;
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, (char *)data, length);
+  return response == BCM2835_I2C_REASON_OK ? length : -1;
+}
+
 /** write a single bit in an 8-bit device register.
  * @param devAddr I2C slave device address
  * @param regAddr Register regAddr to write to
@@ -138,13 +150,13 @@ int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8
 bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
   bcm2835_i2c_setSlaveAddress(devAddr);
   //first reading registery value
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1 );
+  char buf[2] = { (char)regAddr, 0 };
+  uint8_t response = bcm2835_i2c_write_read_rs(buf, 1, &buf[1], 1 );
   if ( response == BCM2835_I2C_REASON_OK ) {
-    uint8_t b = recvBuf[0] ;
+    uint8_t b = buf[1] ;
     b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
-    sendBuf[1] = b ;
-    response = bcm2835_i2c_write(sendBuf, 2);
+    buf[1] = b ;
+    response = bcm2835_i2c_write(buf, 2);
   }
   return response == BCM2835_I2C_REASON_OK;
 }
@@ -167,17 +179,17 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
   // 10101011 masked | value
   bcm2835_i2c_setSlaveAddress(devAddr);
   //first reading registery value
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 1 );
+  char buf[2] = { (char)regAddr, 0 };
+  uint8_t response = bcm2835_i2c_write_read_rs(buf, 1, &buf[1], 1 );
   if ( response == BCM2835_I2C_REASON_OK ) {
-    uint8_t b = recvBuf[0];
+    uint8_t b = buf[1];
     uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
     data <<= (bitStart - length + 1); // shift data into correct position
     data &= mask; // zero all non-important bits in data
     b &= ~(mask); // zero all important bits in existing byte
     b |= data; // combine data with existing byte
-    sendBuf[1] = b ;
-    response = bcm2835_i2c_write(sendBuf, 2);
+    buf[1] = b ;
+    response = bcm2835_i2c_write(buf, 2);
     }
   return response == BCM2835_I2C_REASON_OK;
 }
@@ -190,9 +202,8 @@ bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8
  */
 bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  sendBuf[1] = data;
-  uint8_t response = bcm2835_i2c_write(sendBuf, 2);
+  char buf[2] = { (char)regAddr, (char)data };
+  uint8_t response = bcm2835_i2c_write(buf, 2);
   return response == BCM2835_I2C_REASON_OK ;
 }
 
@@ -204,9 +215,9 @@ bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
  */
 int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data) {
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, 2 );
-  data[0] = (recvBuf[0] << 8) | recvBuf[1] ;
+  char reg = regAddr, b[2] = { 0, 0 };
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, b, 2 );
+  data[0] = ((uint8_t)b[0] << 8) | (uint8_t)b[1] ;
   return  response == BCM2835_I2C_REASON_OK ;
 }
 
@@ -219,43 +230,68 @@ int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data) {
  */
 int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  uint8_t response = bcm2835_i2c_write_read_rs(sendBuf, 1, recvBuf, length*2 );
+  char reg = regAddr;
+  // read straight into the caller's buffer and convert in place: word i only
+  // overlaps the two bytes it is decoded from
+  uint8_t *b = (uint8_t *)data;
+  uint8_t response = bcm2835_i2c_write_read_rs(&reg, 1, (char *)b, length*2 );
   uint8_t i;
   for (i = 0; i < length; i++) {
-    data[i] = (recvBuf[i*2] << 8) | recvBuf[i*2+1] ;
+    data[i] = (b[i*2] << 8) | b[i*2+1] ;
   }
   return  response == BCM2835_I2C_REASON_OK ;
 }
 
 bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data){
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  sendBuf[1] = (uint8_t) (data >> 8); //MSByte
-  sendBuf[2] = (uint8_t) (data >> 0); //LSByte
-  uint8_t response = bcm2835_i2c_write(sendBuf, 3);
+  char buf[3];
+  buf[0] = regAddr;
+  buf[1] = (uint8_t) (data >> 8); //MSByte
+  buf[2] = (uint8_t) (data >> 0); //LSByte
+  uint8_t response = bcm2835_i2c_write(buf, 3);
   return response == BCM2835_I2C_REASON_OK ;
 }
 
 bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data){
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
-  uint8_t i;
-  for (i = 0; i < length; i++) {
-    sendBuf[i+1] = data[i] ;
-  }
-  uint8_t response = bcm2835_i2c_write(sendBuf, 1+length);
+  char buf[1 + 255];
+  buf[0] = regAddr;
+  memcpy(&buf[1], data, length);
+  uint8_t response = bcm2835_i2c_write(buf, 1+length);
   return response == BCM2835_I2C_REASON_OK ;
 }
 
+/** Write up to I2CDEV_LONG_MAX_LENGTH (32767) bytes to an 8-bit device register.
+ * The register address has to lead the data in one buffer, so writes longer
+ * than one writeBytes() call are split, each piece re-addressing the same
+ * register.
+ * @param devAddr I2C slave device address
+ * @param regAddr Register address to write to
+ * @param length Number of bytes to write (at most I2CDEV_LONG_MAX_LENGTH)
+ * @param data Buffer to copy new data from
+ * @return Status of operation (true = success)
+ */
+bool I2Cdev::writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data){
+  if (length > I2CDEV_LONG_MAX_LENGTH) return false;
+  uint16_t count = 0;
+  do {
+    uint16_t chunk = length - count;
+    if (chunk > 255) chunk = 255;
+    if (!writeBytes(devAddr, regAddr, chunk, data + count)) return false;
+    count += chunk;
+  } while (count < length);
+  return true;
+}
+
 bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data){
   bcm2835_i2c_setSlaveAddress(devAddr);
-  sendBuf[0] = regAddr;
+  char buf[I2CDEV_BCM2835_WRITE_LENGTH];
+  buf[0] = regAddr;
   uint8_t i;
   for (i = 0; i < length; i++) {
-    sendBuf[1+2*i] = (uint8_t) (data[i] >> 8); //MSByte
-    sendBuf[2+2*i] = (uint8_t) (data[i] >> 0); //LSByte
+    buf[1+2*i] = (uint8_t) (data[i] >> 8); //MSByte
+    buf[2+2*i] = (uint8_t) (data[i] >> 0); //LSByte
   }
-  uint8_t response = bcm2835_i2c_write(sendBuf, 1+2*length);
+  uint8_t response = bcm2835_i2c_write(buf, 1+2*length);
   return response == BCM2835_I2C_REASON_OK ;
 }
@@ -45,6 +45,10 @@ THE SOFTWARE.
    setI2Cpin should be false, if the I2C are already configured in alt mode ... */
 
 #define i2c_baudrate 400000
+
+// longest readBytesLong()/writeBytesLong() transfer; the byte count comes
+// back as int16_t, so anything longer is rejected
+#define I2CDEV_LONG_MAX_LENGTH          32767
 //uint32_t i2c_baudrate = 400000 ; //400 kHz, 
 
 class I2Cdev {
@@ -62,6 +66,7 @@ class I2Cdev {
         static int8_t readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data);
         static int8_t readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static int8_t readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static int16_t readBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
 
         static bool writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data);
         //TODO static bool writeBitW(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint16_t data);
@@ -71,6 +76,7 @@ class I2Cdev {
         static bool writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data);
         static bool writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data);
         static bool writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data);
+        static bool writeBytesLong(uint8_t devAddr, uint8_t regAddr, uint16_t length, uint8_t *data);
 };
 
 #endif /* _I2CDEV_H_ */